@@ -128,6 +128,12 @@ void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload);
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be send
 void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload);
 
+/// @brief sends multiple previously allocated chunks in the given order; each subscriber is notified only once
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array with the pointers to the user-payloads of the chunks which should be send
+/// @param[in] numberOfChunks number of chunks in userPayloads
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfChunks);
+
 /// @brief offers the service
 /// @param[in] self handle of the publisher
 void iox_pub_offer(iox_pub_t const self);
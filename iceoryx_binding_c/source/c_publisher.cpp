@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/logging.hpp"
+#include "iox/vector.hpp"
 
 
 using namespace iox;
@@ -165,6 +166,33 @@ void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).sendChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfChunks)
+{
+    if (userPayloads == nullptr)
+    {
+        IOX_LOG(WARN) << "publishing chunks skipped - null pointer provided for userPayloads";
+        return;
+    }
+
+    PublisherPortUser publisherPort(self->m_portData);
+    // a publisher cannot loan more chunks at once, larger batches contain invalid chunks anyway
+    vector<ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        chunkHeaders.emplace_back(ChunkHeader::fromUserPayload(userPayloads[i]));
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            publisherPort.sendChunks(span<ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+    }
+
+    if (!chunkHeaders.empty())
+    {
+        publisherPort.sendChunks(span<ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+    }
+}
+
 void iox_pub_offer(iox_pub_t const self)
 {
     PublisherPortUser(self->m_portData).offer();
@@ -67,7 +67,8 @@ class iox_client_test : public Test
         sutPort->m_connectRequested.store(true);
         sutPort->m_connectionState = iox::ConnectionState::CONNECTED;
 
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&serverChunkQueueData);
+        ChunkDistributor<ClientChunkDistributorData_t> chunkDistributor{&sutPort->m_chunkSenderData};
+        ASSERT_FALSE(chunkDistributor.tryAddQueue(&serverChunkQueueData).has_error());
     }
 
     void receiveChunk(const int64_t chunkValue = 0)
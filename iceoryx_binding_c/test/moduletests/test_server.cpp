@@ -80,7 +80,8 @@ class iox_server_test : public Test
 
     void connectClient()
     {
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&clientResponseQueueData);
+        ChunkDistributor<ServerChunkDistributorData_t> chunkDistributor{&sutPort->m_chunkSenderData};
+        ASSERT_FALSE(chunkDistributor.tryAddQueue(&clientResponseQueueData).has_error());
     }
 
     void prepareServerInit(const ServerOptions& options = ServerOptions())
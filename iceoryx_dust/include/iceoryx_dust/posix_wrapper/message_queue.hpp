@@ -87,6 +87,26 @@ class MessageQueue : public DesignPattern::Creation<MessageQueue, IpcChannelErro
     /// @brief try to send a message to the queue for a given timeout duration using std::string
     expected<IpcChannelError> timedSend(const std::string& msg, const units::Duration& timeout) const noexcept;
 
+    /// @brief send a message which consists of the provided bytes. Unlike the std::string overload no null terminator
+    /// is appended and the bytes may contain null characters.
+    /// @param[in] data pointer to the bytes to send
+    /// @param[in] size number of bytes to send, must not exceed the max message size of the queue
+    expected<IpcChannelError> send(const char* const data, const uint64_t size) const noexcept;
+
+    /// @brief try to send a message which consists of the provided bytes for a given timeout duration
+    expected<IpcChannelError>
+    timedSend(const char* const data, const uint64_t size, const units::Duration& timeout) const noexcept;
+
+    /// @brief receive a message into the provided buffer without any dynamic memory allocation
+    /// @param[in] buffer to store the message
+    /// @param[in] bufferSize size of the buffer, must not be smaller than the max message size of the queue
+    /// @return number of received bytes. In case of an error, IpcChannelError is returned.
+    expected<uint64_t, IpcChannelError> receive(char* const buffer, const uint64_t bufferSize) const noexcept;
+
+    /// @brief try to receive a message into the provided buffer for a given timeout duration
+    expected<uint64_t, IpcChannelError>
+    timedReceive(char* const buffer, const uint64_t bufferSize, const units::Duration& timeout) const noexcept;
+
     static expected<bool, IpcChannelError> isOutdated() noexcept;
 
   private:
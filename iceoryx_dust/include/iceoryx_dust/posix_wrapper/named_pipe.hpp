@@ -100,6 +100,36 @@ class NamedPipe : public DesignPattern::Creation<NamedPipe, IpcChannelError>
     /// @return on success a string containing the message, otherwise an error which describes the failure
     expected<std::string, IpcChannelError> timedReceive(const units::Duration& timeout) const noexcept;
 
+    /// @brief sends a message which consists of the provided bytes via the named pipe. if the pipe is full this call
+    ///        is blocking until the message could be delivered. The bytes may contain null characters.
+    /// @param[in] data pointer to the bytes which should be sent
+    /// @param[in] size number of bytes, is not allowed to be larger then MAX_MESSAGE_SIZE
+    /// @return success when message was sent otherwise an error which describes the failure
+    expected<IpcChannelError> send(const char* const data, const uint64_t size) const noexcept;
+
+    /// @brief sends a message which consists of the provided bytes via the named pipe.
+    /// @param[in] data pointer to the bytes which should be sent
+    /// @param[in] size number of bytes, is not allowed to be larger then MAX_MESSAGE_SIZE
+    /// @param[in] timeout the timeout on how long this method should retry to send the message
+    /// @return success when message was sent otherwise an error which describes the failure
+    expected<IpcChannelError>
+    timedSend(const char* const data, const uint64_t size, const units::Duration& timeout) const noexcept;
+
+    /// @brief receives a message via the named pipe into the provided buffer. if the pipe is empty this call is
+    ///        blocking until a message was received
+    /// @param[in] buffer to store the message, the message is truncated when it is larger than the buffer
+    /// @param[in] bufferSize size of the buffer in bytes
+    /// @return on success the number of received bytes otherwise an error which describes the failure
+    expected<uint64_t, IpcChannelError> receive(char* const buffer, const uint64_t bufferSize) const noexcept;
+
+    /// @brief receives a message via the named pipe into the provided buffer.
+    /// @param[in] buffer to store the message, the message is truncated when it is larger than the buffer
+    /// @param[in] bufferSize size of the buffer in bytes
+    /// @param[in] timeout the timeout on how long this method should retry to receive a message
+    /// @return on success the number of received bytes otherwise an error which describes the failure
+    expected<uint64_t, IpcChannelError>
+    timedReceive(char* const buffer, const uint64_t bufferSize, const units::Duration& timeout) const noexcept;
+
   private:
     friend class DesignPattern::Creation<NamedPipe, IpcChannelError>;
 
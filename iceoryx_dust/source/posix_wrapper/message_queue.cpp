@@ -22,6 +22,7 @@
 #include "iceoryx_platform/platform_correction.hpp"
 
 #include <chrono>
+#include <cstring>
 #include <string>
 
 
@@ -179,14 +180,17 @@ expected<IpcChannelError> MessageQueue::destroy() noexcept
 
 expected<IpcChannelError> MessageQueue::send(const std::string& msg) const noexcept
 {
-    const uint64_t messageSize = msg.size() + NULL_TERMINATOR_SIZE;
-    if (messageSize > static_cast<uint64_t>(m_attributes.mq_msgsize))
+    return send(msg.c_str(), msg.size() + NULL_TERMINATOR_SIZE);
+}
+
+expected<IpcChannelError> MessageQueue::send(const char* const data, const uint64_t size) const noexcept
+{
+    if (size > static_cast<uint64_t>(m_attributes.mq_msgsize))
     {
         return error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
     }
 
-    auto mqCall =
-        posixCall(mq_send)(m_mqDescriptor, msg.c_str(), messageSize, 1U).failureReturnValue(ERROR_CODE).evaluate();
+    auto mqCall = posixCall(mq_send)(m_mqDescriptor, data, size, 1U).failureReturnValue(ERROR_CODE).evaluate();
 
     if (mqCall.has_error())
     {
@@ -202,16 +206,26 @@ expected<std::string, IpcChannelError> MessageQueue::receive() const noexcept
     /// NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
     char message[MAX_MESSAGE_SIZE];
 
-    auto mqCall = posixCall(mq_receive)(m_mqDescriptor, &message[0], MAX_MESSAGE_SIZE, nullptr)
-                      .failureReturnValue(ERROR_CODE)
-                      .evaluate();
+    auto receiveResult = receive(&message[0], MAX_MESSAGE_SIZE);
+    if (receiveResult.has_error())
+    {
+        return error<IpcChannelError>(receiveResult.get_error());
+    }
+
+    return success<std::string>(std::string(&message[0], strnlen(&message[0], receiveResult.value())));
+}
+
+expected<uint64_t, IpcChannelError> MessageQueue::receive(char* const buffer, const uint64_t bufferSize) const noexcept
+{
+    auto mqCall =
+        posixCall(mq_receive)(m_mqDescriptor, buffer, bufferSize, nullptr).failureReturnValue(ERROR_CODE).evaluate();
 
     if (mqCall.has_error())
     {
         return createErrorFromErrnum(mqCall.get_error().errnum);
     }
 
-    return success<std::string>(std::string(&(message[0])));
+    return success<uint64_t>(static_cast<uint64_t>(mqCall->value));
 }
 
 expected<mqd_t, IpcChannelError> MessageQueue::open(const IpcChannelName_t& name,
@@ -278,12 +292,26 @@ expected<IpcChannelError> MessageQueue::unlink() noexcept
 
 expected<std::string, IpcChannelError> MessageQueue::timedReceive(const units::Duration& timeout) const noexcept
 {
-    timespec timeOut = timeout.timespec(units::TimeSpecReference::Epoch);
     /// NOLINTJUSTIFICATION required as internal buffer for receive
     /// NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
     char message[MAX_MESSAGE_SIZE];
 
-    auto mqCall = posixCall(mq_timedreceive)(m_mqDescriptor, &message[0], MAX_MESSAGE_SIZE, nullptr, &timeOut)
+    auto receiveResult = timedReceive(&message[0], MAX_MESSAGE_SIZE, timeout);
+    if (receiveResult.has_error())
+    {
+        return error<IpcChannelError>(receiveResult.get_error());
+    }
+
+    return success<std::string>(std::string(&message[0], strnlen(&message[0], receiveResult.value())));
+}
+
+expected<uint64_t, IpcChannelError> MessageQueue::timedReceive(char* const buffer,
+                                                               const uint64_t bufferSize,
+                                                               const units::Duration& timeout) const noexcept
+{
+    timespec timeOut = timeout.timespec(units::TimeSpecReference::Epoch);
+
+    auto mqCall = posixCall(mq_timedreceive)(m_mqDescriptor, buffer, bufferSize, nullptr, &timeOut)
                       .failureReturnValue(ERROR_CODE)
                       // don't use the suppressErrorMessagesForErrnos method since QNX used EINTR instead of ETIMEDOUT
                       .ignoreErrnos(TIMEOUT_ERRNO)
@@ -299,7 +327,7 @@ expected<std::string, IpcChannelError> MessageQueue::timedReceive(const units::D
         return createErrorFromErrnum(ETIMEDOUT);
     }
 
-    return success<std::string>(std::string(&(message[0])));
+    return success<uint64_t>(static_cast<uint64_t>(mqCall->value));
 }
 
 expected<IpcChannelError> MessageQueue::timedSend(const std::string& msg, const units::Duration& timeout) const noexcept
@@ -312,9 +340,20 @@ expected<IpcChannelError> MessageQueue::timedSend(const std::string& msg, const
         return error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
     }
 
+    return timedSend(msg.c_str(), messageSize, timeout);
+}
+
+expected<IpcChannelError>
+MessageQueue::timedSend(const char* const data, const uint64_t size, const units::Duration& timeout) const noexcept
+{
+    if (size > static_cast<uint64_t>(m_attributes.mq_msgsize))
+    {
+        return error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
+    }
+
     timespec timeOut = timeout.timespec(units::TimeSpecReference::Epoch);
 
-    auto mqCall = posixCall(mq_timedsend)(m_mqDescriptor, msg.c_str(), messageSize, 1U, &timeOut)
+    auto mqCall = posixCall(mq_timedsend)(m_mqDescriptor, data, size, 1U, &timeOut)
                       .failureReturnValue(ERROR_CODE)
                       // don't use the suppressErrorMessagesForErrnos method since QNX used EINTR instead of ETIMEDOUT
                       .ignoreErrnos(TIMEOUT_ERRNO)
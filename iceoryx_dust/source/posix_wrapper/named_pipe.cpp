@@ -21,6 +21,8 @@
 #include "iox/filesystem.hpp"
 #include "iox/into.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <thread>
 
 namespace iox
@@ -341,6 +343,95 @@ expected<std::string, IpcChannelError> NamedPipe::timedReceive(const units::Dura
     return error<IpcChannelError>(IpcChannelError::TIMEOUT);
 }
 
+expected<IpcChannelError> NamedPipe::send(const char* const data, const uint64_t size) const noexcept
+{
+    if (!m_isInitialized)
+    {
+        return error<IpcChannelError>(IpcChannelError::NOT_INITIALIZED);
+    }
+
+    if (size > MAX_MESSAGE_SIZE)
+    {
+        return error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
+    }
+
+    cxx::Expects(!m_data->sendSemaphore().wait().has_error());
+    IOX_DISCARD_RESULT(m_data->messages.push(Message_t(TruncateToCapacity, data, size)));
+    cxx::Expects(!m_data->receiveSemaphore().post().has_error());
+
+    return success<>();
+}
+
+expected<IpcChannelError>
+NamedPipe::timedSend(const char* const data, const uint64_t size, const units::Duration& timeout) const noexcept
+{
+    if (!m_isInitialized)
+    {
+        return error<IpcChannelError>(IpcChannelError::NOT_INITIALIZED);
+    }
+
+    if (size > MAX_MESSAGE_SIZE)
+    {
+        return error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
+    }
+
+    auto result = m_data->sendSemaphore().timedWait(timeout);
+    cxx::Expects(!result.has_error());
+
+    if (*result == SemaphoreWaitState::NO_TIMEOUT)
+    {
+        IOX_DISCARD_RESULT(m_data->messages.push(Message_t(TruncateToCapacity, data, size)));
+        cxx::Expects(!m_data->receiveSemaphore().post().has_error());
+        return success<>();
+    }
+    return error<IpcChannelError>(IpcChannelError::TIMEOUT);
+}
+
+expected<uint64_t, IpcChannelError> NamedPipe::receive(char* const buffer, const uint64_t bufferSize) const noexcept
+{
+    if (!m_isInitialized)
+    {
+        return error<IpcChannelError>(IpcChannelError::NOT_INITIALIZED);
+    }
+
+    cxx::Expects(!m_data->receiveSemaphore().wait().has_error());
+    auto message = m_data->messages.pop();
+    if (message.has_value())
+    {
+        cxx::Expects(!m_data->sendSemaphore().post().has_error());
+        const uint64_t receivedSize = std::min(message->size(), bufferSize);
+        std::memcpy(buffer, message->c_str(), receivedSize);
+        return success<uint64_t>(receivedSize);
+    }
+    return error<IpcChannelError>(IpcChannelError::INTERNAL_LOGIC_ERROR);
+}
+
+expected<uint64_t, IpcChannelError>
+NamedPipe::timedReceive(char* const buffer, const uint64_t bufferSize, const units::Duration& timeout) const noexcept
+{
+    if (!m_isInitialized)
+    {
+        return error<IpcChannelError>(IpcChannelError::NOT_INITIALIZED);
+    }
+
+    auto result = m_data->receiveSemaphore().timedWait(timeout);
+    cxx::Expects(!result.has_error());
+
+    if (*result == SemaphoreWaitState::NO_TIMEOUT)
+    {
+        auto message = m_data->messages.pop();
+        if (message.has_value())
+        {
+            cxx::Expects(!m_data->sendSemaphore().post().has_error());
+            const uint64_t receivedSize = std::min(message->size(), bufferSize);
+            std::memcpy(buffer, message->c_str(), receivedSize);
+            return success<uint64_t>(receivedSize);
+        }
+        return error<IpcChannelError>(IpcChannelError::INTERNAL_LOGIC_ERROR);
+    }
+    return error<IpcChannelError>(IpcChannelError::TIMEOUT);
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init) semaphores are initalized via placementCreate call
 NamedPipe::NamedPipeData::NamedPipeData(bool& isInitialized,
                                         IpcChannelError& error,
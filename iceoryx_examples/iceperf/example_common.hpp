@@ -28,11 +28,21 @@ enum class Technology
 {
     ALL,
     ICEORYX_CPP_API,
+    ICEORYX_CPP_WAIT_SET_API,
     ICEORYX_C_API,
     POSIX_MESSAGE_QUEUE,
     UNIX_DOMAIN_SOCKET
 };
 
+enum class WaitStrategy
+{
+    ALL,
+    BLOCK,
+    SPIN,
+    SPIN_THEN_YIELD,
+    SPIN_THEN_BLOCK
+};
+
 enum class RunFlag
 {
     STOP,
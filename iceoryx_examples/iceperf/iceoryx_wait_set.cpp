@@ -0,0 +1,165 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_wait_set.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+IceoryxWaitSet::IceoryxWaitSet(const iox::capro::IdString_t& publisherName,
+                               const iox::capro::IdString_t& subscriberName,
+                               const WaitStrategy waitStrategy,
+                               const uint64_t spinBudget) noexcept
+    : m_publisher({"IcePerf", publisherName, eventName(waitStrategy)}, iox::popo::PublisherOptions{1U})
+    , m_subscriber({"IcePerf", subscriberName, eventName(waitStrategy)}, iox::popo::SubscriberOptions{1U, 1U})
+    , m_waitset(toWaitSetStrategy(waitStrategy, spinBudget))
+{
+    m_waitset.attachState(m_subscriber, iox::popo::SubscriberState::HAS_DATA).or_else([](auto) {
+        std::cerr << "failed to attach subscriber" << std::endl;
+        std::exit(EXIT_FAILURE);
+    });
+}
+
+std::vector<WaitStrategy> IceoryxWaitSet::selectedWaitStrategies(const PerfSettings& settings) noexcept
+{
+    if (settings.waitStrategy == WaitStrategy::ALL)
+    {
+        return {WaitStrategy::BLOCK, WaitStrategy::SPIN, WaitStrategy::SPIN_THEN_YIELD, WaitStrategy::SPIN_THEN_BLOCK};
+    }
+    return {settings.waitStrategy};
+}
+
+const char* IceoryxWaitSet::asStringLiteral(const WaitStrategy waitStrategy) noexcept
+{
+    switch (waitStrategy)
+    {
+    case WaitStrategy::ALL:
+        return "all";
+    case WaitStrategy::BLOCK:
+        return "block";
+    case WaitStrategy::SPIN:
+        return "spin";
+    case WaitStrategy::SPIN_THEN_YIELD:
+        return "spin-then-yield";
+    case WaitStrategy::SPIN_THEN_BLOCK:
+        return "spin-then-block";
+    }
+    return "unknown";
+}
+
+iox::popo::WaitStrategy IceoryxWaitSet::toWaitSetStrategy(const WaitStrategy waitStrategy,
+                                                          const uint64_t spinBudget) noexcept
+{
+    iox::popo::WaitStrategy waitSetStrategy;
+    waitSetStrategy.spinBudget = spinBudget;
+    switch (waitStrategy)
+    {
+    case WaitStrategy::SPIN:
+        waitSetStrategy.type = iox::popo::WaitStrategyType::SPIN;
+        break;
+    case WaitStrategy::SPIN_THEN_YIELD:
+        waitSetStrategy.type = iox::popo::WaitStrategyType::SPIN_THEN_YIELD;
+        break;
+    case WaitStrategy::SPIN_THEN_BLOCK:
+        waitSetStrategy.type = iox::popo::WaitStrategyType::SPIN_THEN_BLOCK;
+        break;
+    case WaitStrategy::ALL:
+    case WaitStrategy::BLOCK:
+        waitSetStrategy.type = iox::popo::WaitStrategyType::BLOCK;
+        break;
+    }
+    return waitSetStrategy;
+}
+
+iox::capro::IdString_t IceoryxWaitSet::eventName(const WaitStrategy waitStrategy) noexcept
+{
+    // every strategy uses its own service to not interfere with the ports of the previous measurement
+    const std::string name = std::string("C++-API-WaitSet-") + asStringLiteral(waitStrategy);
+    return iox::capro::IdString_t(iox::TruncateToCapacity, name.c_str());
+}
+
+void IceoryxWaitSet::initLeader() noexcept
+{
+    init();
+}
+
+void IceoryxWaitSet::initFollower() noexcept
+{
+    init();
+}
+
+void IceoryxWaitSet::init() noexcept
+{
+    std::cout << "Waiting for: subscription" << std::flush;
+    while (m_subscriber.getSubscriptionState() != iox::SubscribeState::SUBSCRIBED)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::cout << ", subscriber" << std::flush;
+    while (!m_publisher.hasSubscribers())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::cout << " [ success ]" << std::endl;
+}
+
+void IceoryxWaitSet::shutdown() noexcept
+{
+    m_subscriber.unsubscribe();
+
+    std::cout << "Waiting for: unsubscribe " << std::flush;
+    while (!m_publisher.hasSubscribers())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // with stopOffer we disconnect all subscribers and the publisher is no more visible
+    m_publisher.stopOffer();
+    std::cout << " [ finished ]" << std::endl;
+}
+
+void IceoryxWaitSet::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+{
+    m_publisher.loan(payloadSizeInBytes).and_then([&](auto& userPayload) {
+        auto sendSample = static_cast<PerfTopic*>(userPayload);
+        sendSample->payloadSize = payloadSizeInBytes;
+        sendSample->runFlag = runFlag;
+        sendSample->subPackets = 1;
+
+        m_publisher.publish(userPayload);
+    });
+}
+
+PerfTopic IceoryxWaitSet::receivePerfTopic() noexcept
+{
+    bool hasReceivedSample{false};
+    PerfTopic receivedSample;
+
+    do
+    {
+        m_waitset.wait();
+        m_subscriber.take().and_then([&](const void* data) {
+            receivedSample = *(static_cast<const PerfTopic*>(data));
+            hasReceivedSample = true;
+            m_subscriber.release(data);
+        });
+    } while (!hasReceivedSample);
+
+    return receivedSample;
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_EXAMPLES_ICEPERF_ICEORYX_WAIT_SET_HPP
+#define IOX_EXAMPLES_ICEPERF_ICEORYX_WAIT_SET_HPP
+
+#include "base.hpp"
+#include "topic_data.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+
+#include <vector>
+
+/// @brief Like Iceoryx but the subscriber is attached to a WaitSet and the receiver waits for the data instead of
+/// polling. The difference to the Iceoryx measurement is the cost of the notification on every sample. The
+/// WaitSet waits with the given strategy, which allows to compare blocking with spinning for the notification.
+class IceoryxWaitSet : public IcePerfBase
+{
+  public:
+    IceoryxWaitSet(const iox::capro::IdString_t& publisherName,
+                   const iox::capro::IdString_t& subscriberName,
+                   const WaitStrategy waitStrategy,
+                   const uint64_t spinBudget) noexcept;
+
+    /// @brief The wait strategies which shall be measured, i.e. all strategies when WaitStrategy::ALL is set
+    static std::vector<WaitStrategy> selectedWaitStrategies(const PerfSettings& settings) noexcept;
+
+    static const char* asStringLiteral(const WaitStrategy waitStrategy) noexcept;
+
+    void initLeader() noexcept override;
+    void initFollower() noexcept override;
+    void shutdown() noexcept override;
+
+  private:
+    static iox::popo::WaitStrategy toWaitSetStrategy(const WaitStrategy waitStrategy,
+                                                     const uint64_t spinBudget) noexcept;
+    static iox::capro::IdString_t eventName(const WaitStrategy waitStrategy) noexcept;
+
+    void init() noexcept;
+    void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
+    PerfTopic receivePerfTopic() noexcept override;
+
+    iox::popo::UntypedPublisher m_publisher;
+    iox::popo::UntypedSubscriber m_subscriber;
+    iox::popo::WaitSet<> m_waitset;
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_ICEORYX_WAIT_SET_HPP
@@ -19,6 +19,7 @@
 #include "iceoryx.hpp"
 #include "iceoryx_c.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_wait_set.hpp"
 #include "mq.hpp"
 #include "topic_data.hpp"
 #include "uds.hpp"
@@ -113,6 +114,18 @@ int IcePerfFollower::run() noexcept
         doMeasurement(iceoryx);
     }
 
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_WAIT_SET_API)
+    {
+        for (const auto waitStrategy : IceoryxWaitSet::selectedWaitStrategies(m_settings))
+        {
+            std::cout << std::endl
+                      << "******  ICEORYX WAITSET   ******** [" << IceoryxWaitSet::asStringLiteral(waitStrategy) << "]"
+                      << std::endl;
+            IceoryxWaitSet iceoryxWaitSet(PUBLISHER, SUBSCRIBER, waitStrategy, m_settings.spinBudget);
+            doMeasurement(iceoryxWaitSet);
+        }
+    }
+
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API)
     {
         std::cout << std::endl << "******   ICEORYX C API    ********" << std::endl;
@@ -33,10 +33,12 @@ int main(int argc, char* argv[])
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
                                       {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"wait-strategy", required_argument, nullptr, 'w'},
+                                      {"spin-budget", required_argument, nullptr, 's'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:w:s:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -53,6 +55,7 @@ int main(int argc, char* argv[])
             std::cout << "-t, --technology <TYPE>           Selects the type of technology to benchmark" << std::endl;
             std::cout << "                                  <TYPE> {all," << std::endl;
             std::cout << "                                          iceoryx-cpp-api," << std::endl;
+            std::cout << "                                          iceoryx-cpp-wait-set-api," << std::endl;
             std::cout << "                                          iceoryx-c-api," << std::endl;
             std::cout << "                                          posix-message-queue," << std::endl;
             std::cout << "                                          unix-domain-sockets}" << std::endl;
@@ -60,6 +63,18 @@ int main(int argc, char* argv[])
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-w, --wait-strategy <TYPE>        Selects how the WaitSet of iceoryx-cpp-wait-set-api waits"
+                      << std::endl;
+            std::cout << "                                  <TYPE> {all," << std::endl;
+            std::cout << "                                          block," << std::endl;
+            std::cout << "                                          spin," << std::endl;
+            std::cout << "                                          spin-then-yield," << std::endl;
+            std::cout << "                                          spin-then-block}" << std::endl;
+            std::cout << "                                  default = 'block'" << std::endl;
+            std::cout << "-s, --spin-budget <N>             Set the number of polls before spin-then-yield yields"
+                      << std::endl;
+            std::cout << "                                  and spin-then-block blocks" << std::endl;
+            std::cout << "                                  default = '10000'" << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -90,6 +105,10 @@ int main(int argc, char* argv[])
             {
                 settings.technology = Technology::ICEORYX_CPP_API;
             }
+            else if (strcmp(optarg, "iceoryx-cpp-wait-set-api") == 0)
+            {
+                settings.technology = Technology::ICEORYX_CPP_WAIT_SET_API;
+            }
             else if (strcmp(optarg, "iceoryx-c-api") == 0)
             {
                 settings.technology = Technology::ICEORYX_C_API;
@@ -104,8 +123,8 @@ int main(int argc, char* argv[])
             }
             else
             {
-                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-c-api', "
-                             "'posix-message-queue' and 'unix-domain-sockets'!"
+                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-cpp-wait-set-api', "
+                             "'iceoryx-c-api', 'posix-message-queue' and 'unix-domain-sockets'!"
                           << std::endl;
                 return EXIT_FAILURE;
             }
@@ -117,6 +136,42 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
             break;
+        case 'w':
+            if (strcmp(optarg, "all") == 0)
+            {
+                settings.waitStrategy = WaitStrategy::ALL;
+            }
+            else if (strcmp(optarg, "block") == 0)
+            {
+                settings.waitStrategy = WaitStrategy::BLOCK;
+            }
+            else if (strcmp(optarg, "spin") == 0)
+            {
+                settings.waitStrategy = WaitStrategy::SPIN;
+            }
+            else if (strcmp(optarg, "spin-then-yield") == 0)
+            {
+                settings.waitStrategy = WaitStrategy::SPIN_THEN_YIELD;
+            }
+            else if (strcmp(optarg, "spin-then-block") == 0)
+            {
+                settings.waitStrategy = WaitStrategy::SPIN_THEN_BLOCK;
+            }
+            else
+            {
+                std::cerr << "Options for 'wait-strategy' are 'all', 'block', 'spin', 'spin-then-yield' and "
+                             "'spin-then-block'!"
+                          << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 's':
+            if (!iox::cxx::convert::fromString(optarg, settings.spinBudget))
+            {
+                std::cerr << "Could not parse 'spin-budget' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
         default:
             return EXIT_FAILURE;
         };
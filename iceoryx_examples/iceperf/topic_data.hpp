@@ -27,6 +27,8 @@ struct PerfSettings
     Benchmark benchmark{Benchmark::ALL};
     Technology technology{Technology::ALL};
     uint64_t numberOfSamples{10000U};
+    WaitStrategy waitStrategy{WaitStrategy::BLOCK};
+    uint64_t spinBudget{10000U};
 };
 
 struct PerfTopic
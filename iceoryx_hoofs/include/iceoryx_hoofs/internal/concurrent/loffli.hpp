@@ -87,6 +87,12 @@ class LoFFLi
     /// @return true if index is valid, false otherwise
     bool pop(Index_t& index) noexcept;
 
+    /// Pop multiple values from the free-list with a single update of the head of the free-list
+    /// @param [out] indices memory for at least maxNumberOfIndices elements to use
+    /// @param [in] maxNumberOfIndices is the maximum number of values to pop
+    /// @return the number of popped values; less than maxNumberOfIndices if the free-list ran empty
+    uint32_t pop(Index_t* const indices, const uint32_t maxNumberOfIndices) noexcept;
+
     /// Push previously poped element
     /// @param [in] index to previously poped element
     /// @return true if index is valid or not yet pushed, false otherwise
@@ -0,0 +1,157 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONCURRENT_SPSC_RING_HPP
+#define IOX_HOOFS_CONCURRENT_SPSC_RING_HPP
+
+#include "iox/optional.hpp"
+#include "iox/uninitialized_array.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief defines what happens when a value is pushed into a full SpscRing
+enum class SpscRingFullPolicy : uint8_t
+{
+    /// @brief the pushed value is not stored and handed back to the producer, like the FiFo
+    REJECT_NEWEST_VALUE,
+    /// @brief the oldest value is removed from the ring and handed back to the producer, like the SoFi
+    DISCARD_OLDEST_VALUE
+};
+
+/// @brief Single producer single consumer ring buffer which keeps the producer and the consumer state on separate
+/// cache lines. Additionally, each side caches the last observed position of the other side and only reloads it
+/// when the cached value suggests a full (producer) or an empty (consumer) ring. As long as the ring is neither
+/// full nor empty, push and pop therefore only touch the cache line of their own side and the slot they are
+/// writing or reading.
+/// @note the separation is achieved with padding instead of alignas since the ring is placed in shared memory
+/// and heap allocations of over-aligned types are not supported before C++17
+/// @param[in] ValueType        DataType to be stored, must be trivially copyable
+/// @param[in] CapacityValue    Capacity of the SpscRing
+/// @code
+///     concurrent::SpscRing<int, 5> ring(concurrent::SpscRingFullPolicy::DISCARD_OLDEST_VALUE);
+///
+///     auto discardedValue = ring.push(123);
+///     if (discardedValue.has_value())
+///     {
+///         IOX_LOG(INFO) << "element " << discardedValue.value() << " was discarded";
+///     }
+/// @endcode
+template <typename ValueType, uint64_t CapacityValue>
+class SpscRing
+{
+    static_assert(std::is_trivially_copyable<ValueType>::value,
+                  "SpscRing can handle only trivially copyable data types");
+    static_assert(2 <= ATOMIC_LLONG_LOCK_FREE, "SpscRing is not able to run lock free on this data type");
+
+    /// @brief the ring has one more slot than its capacity; with DISCARD_OLDEST_VALUE the value is written before
+    /// the oldest value is discarded and the additional slot ensures that this never overwrites a value the
+    /// consumer is currently reading
+    static constexpr uint64_t INTERNAL_SIZE_ADD_ON{1U};
+    static constexpr uint64_t INTERNAL_RING_SIZE{CapacityValue + INTERNAL_SIZE_ADD_ON};
+
+  public:
+    /// @brief size of the padding which separates the producer and the consumer state
+    static constexpr uint64_t CACHE_LINE_SIZE{64U};
+
+    /// @brief creates an empty ring with the capacity CapacityValue
+    /// @param[in] fullPolicy defines the behavior of a push into a full ring
+    explicit SpscRing(const SpscRingFullPolicy fullPolicy) noexcept;
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing(SpscRing&&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+    SpscRing& operator=(SpscRing&&) = delete;
+    ~SpscRing() noexcept = default;
+
+    /// @brief pushes a value into the ring
+    /// @param[in] value value which should be stored
+    /// @return if the ring was full the optional contains the pushed value (REJECT_NEWEST_VALUE) or the discarded
+    ///         oldest value (DISCARD_OLDEST_VALUE), otherwise nullopt
+    /// @concurrent restricted thread safe: single push, single pop
+    optional<ValueType> push(const ValueType& value) noexcept;
+
+    /// @brief removes the oldest value from the ring
+    /// @return the oldest value if the ring was not empty, otherwise nullopt
+    /// @concurrent restricted thread safe: single push, single pop
+    optional<ValueType> pop() noexcept;
+
+    /// @brief returns true if the ring is empty, otherwise false
+    /// @note the result can be out of date as soon as it is returned when another thread pushes concurrently
+    /// @concurrent unrestricted thread safe
+    bool empty() const noexcept;
+
+    /// @brief returns the current number of values in the ring
+    /// @note the result can be out of date as soon as it is returned when another thread pushes or pops concurrently
+    /// @concurrent unrestricted thread safe
+    uint64_t size() const noexcept;
+
+    /// @brief sets the capacity of the ring
+    /// @param[in] newCapacity valid values are 0 < newCapacity <= CapacityValue
+    /// @return true if the capacity was set, false if the ring is not empty or the capacity is out of range
+    /// @pre no push or pop calls must occur during this call
+    /// @concurrent not thread safe
+    bool setCapacity(const uint64_t newCapacity) noexcept;
+
+    /// @brief returns the capacity of the ring
+    /// @concurrent unrestricted thread safe
+    uint64_t capacity() const noexcept;
+
+  private:
+    optional<ValueType> pushAndRejectNewest(const ValueType& value) noexcept;
+    optional<ValueType> pushAndDiscardOldest(const ValueType& value) noexcept;
+    optional<ValueType> popWithExclusiveReadPosition() noexcept;
+    optional<ValueType> popWithSharedReadPosition() noexcept;
+
+    /// @brief the padding in front of the positions ensures that they never share a cache line with the members
+    /// declared before them, the padding after the consumer state does the same for the slots
+    struct ProducerState
+    {
+        uint8_t paddingBefore[CACHE_LINE_SIZE];
+        std::atomic<uint64_t> writePosition{0U};
+        /// @brief read position as last observed by the producer, it is never ahead of the actual one
+        uint64_t cachedReadPosition{0U};
+    };
+
+    struct ConsumerState
+    {
+        uint8_t paddingBefore[CACHE_LINE_SIZE];
+        /// @brief with DISCARD_OLDEST_VALUE the producer advances the read position on an overflow
+        std::atomic<uint64_t> readPosition{0U};
+        /// @brief write position as last observed by the consumer, it is never ahead of the actual one
+        uint64_t cachedWritePosition{0U};
+        uint8_t paddingAfter[CACHE_LINE_SIZE];
+    };
+
+    const SpscRingFullPolicy m_fullPolicy;
+    uint64_t m_size{INTERNAL_RING_SIZE};
+    ProducerState m_producer;
+    ConsumerState m_consumer;
+    UninitializedArray<ValueType, INTERNAL_RING_SIZE> m_data;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#include "iceoryx_hoofs/internal/concurrent/spsc_ring.inl"
+
+#endif // IOX_HOOFS_CONCURRENT_SPSC_RING_HPP
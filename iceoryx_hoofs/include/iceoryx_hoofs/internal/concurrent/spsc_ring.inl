@@ -0,0 +1,202 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONCURRENT_SPSC_RING_INL
+#define IOX_HOOFS_CONCURRENT_SPSC_RING_INL
+
+#include "iceoryx_hoofs/internal/concurrent/spsc_ring.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+template <typename ValueType, uint64_t CapacityValue>
+inline SpscRing<ValueType, CapacityValue>::SpscRing(const SpscRingFullPolicy fullPolicy) noexcept
+    : m_fullPolicy(fullPolicy)
+{
+}
+
+template <typename ValueType, uint64_t CapacityValue>
+inline optional<ValueType> SpscRing<ValueType, CapacityValue>::push(const ValueType& value) noexcept
+{
+    return (m_fullPolicy == SpscRingFullPolicy::DISCARD_OLDEST_VALUE) ? pushAndDiscardOldest(value)
+                                                                     : pushAndRejectNewest(value);
+}
+
+template <typename ValueType, uint64_t CapacityValue>
+inline optional<ValueType> SpscRing<ValueType, CapacityValue>::pop() noexcept
+{
+    return (m_fullPolicy == SpscRingFullPolicy::DISCARD_OLDEST_VALUE) ? popWithSharedReadPosition()
+                                                                     : popWithExclusiveReadPosition();
+}
+
+template <typename ValueType, uint64_t CapacityValue>
+inline optional<ValueType> SpscRing<ValueType, CapacityValue>::pushAndRejectNewest(const ValueType& value) noexcept
+{
+    const uint64_t currentWritePosition = m_producer.writePosition.load(std::memory_order_relaxed);
+    const uint64_t currentCapacity = m_size - INTERNAL_SIZE_ADD_ON;
+
+    if (currentWritePosition - m_producer.cachedReadPosition >= currentCapacity)
+    {
+        // the ring looks full with the cached read position, only now the consumer cache line is touched
+        m_producer.cachedReadPosition = m_consumer.readPosition.load(std::memory_order_acquire);
+        if (currentWritePosition - m_producer.cachedReadPosition >= currentCapacity)
+        {
+            return value;
+        }
+    }
+
+    m_data[currentWritePosition % m_size] = value;
+    // the release pairs with the acquire of the consumer, the value must be written before it becomes visible
+    m_producer.writePosition.store(currentWritePosition + 1U, std::memory_order_release);
+
+    return nullopt;
+}
+
+template <typename ValueType, uint64_t CapacityValue>
+inline optional<ValueType> SpscRing<ValueType, CapacityValue>::pushAndDiscardOldest(const ValueType& value) noexcept
+{
+    const uint64_t currentWritePosition = m_producer.writePosition.load(std::memory_order_relaxed);
+    const uint64_t nextWritePosition = currentWritePosition + 1U;
+
+    // the additional slot is always free at this point, see INTERNAL_SIZE_ADD_ON
+    m_data[currentWritePosition % m_size] = value;
+    m_producer.writePosition.store(nextWritePosition, std::memory_order_release);
+
+    // the cached read position is never ahead of the actual one, if there is space with the cached one there is
+    // also space with the actual one
+    if (nextWritePosition < m_producer.cachedReadPosition + m_size)
+    {
+        return nullopt;
+    }
+
+    m_producer.cachedReadPosition = m_consumer.readPosition.load(std::memory_order_acquire);
+    if (nextWritePosition < m_producer.cachedReadPosition + m_size)
+    {
+        return nullopt;
+    }
+
+    // the ring is full and the oldest value has to be discarded; this races with the consumer and is therefore
+    // done with a compare and swap like in the SoFi, see SoFi::push for the reasoning about the memory orders
+    uint64_t oldestReadPosition = m_producer.cachedReadPosition;
+    if (m_consumer.readPosition.compare_exchange_strong(
+            oldestReadPosition, oldestReadPosition + 1U, std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+        m_producer.cachedReadPosition = oldestReadPosition + 1U;
+        ValueType discardedValue;
+        std::memcpy(&discardedValue, &m_data[oldestReadPosition % m_size], sizeof(ValueType));
+        return discardedValue;
+    }
+
+    // the consumer took the oldest value in the meantime, the failed compare and swap provides the new position
+    m_producer.cachedReadPosition = oldestReadPosition;
+    return nullopt;
+}
+
+template <typename ValueType, uint64_t CapacityValue>
+inline optional<ValueType> SpscRing<ValueType, CapacityValue>::popWithExclusiveReadPosition() noexcept
+{
+    // only the consumer writes the read position with REJECT_NEWEST_VALUE
+    const uint64_t currentReadPosition = m_consumer.readPosition.load(std::memory_order_relaxed);
+
+    if (currentReadPosition == m_consumer.cachedWritePosition)
+    {
+        // the ring looks empty with the cached write position, only now the producer cache line is touched
+        m_consumer.cachedWritePosition = m_producer.writePosition.load(std::memory_order_acquire);
+        if (currentReadPosition == m_consumer.cachedWritePosition)
+        {
+            return nullopt;
+        }
+    }
+
+    ValueType value = m_data[currentReadPosition % m_size];
+    // the release pairs with the acquire of the producer, the slot must be read before it can be reused
+    m_consumer.readPosition.store(currentReadPosition + 1U, std::memory_order_release);
+
+    return value;
+}
+
+template <typename ValueType, uint64_t CapacityValue>
+inline optional<ValueType> SpscRing<ValueType, CapacityValue>::popWithSharedReadPosition() noexcept
+{
+    uint64_t currentReadPosition = m_consumer.readPosition.load(std::memory_order_acquire);
+    ValueType value;
+
+    do
+    {
+        // the producer may have advanced the read position beyond the cached write position with an overflow
+        if (currentReadPosition >= m_consumer.cachedWritePosition)
+        {
+            m_consumer.cachedWritePosition = m_producer.writePosition.load(std::memory_order_acquire);
+            if (currentReadPosition >= m_consumer.cachedWritePosition)
+            {
+                return nullopt;
+            }
+        }
+
+        // memcpy instead of the copy assignment since the slot might be overwritten concurrently after an overflow;
+        // the value is discarded and read again when the compare and swap detects this, see SoFi::popIf
+        std::memcpy(&value, &m_data[currentReadPosition % m_size], sizeof(ValueType));
+    } while (!m_consumer.readPosition.compare_exchange_weak(
+        currentReadPosition, currentReadPosition + 1U, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return value;
+}
+
+template <typename ValueType, uint64_t CapacityValue>
+inline bool SpscRing<ValueType, CapacityValue>::empty() const noexcept
+{
+    return size() == 0U;
+}
+
+template <typename ValueType, uint64_t CapacityValue>
+inline uint64_t SpscRing<ValueType, CapacityValue>::size() const noexcept
+{
+    // both positions only increase and the read position is never ahead of the write position, loading the read
+    // position first therefore ensures that the difference does not wrap around
+    const uint64_t readPosition = m_consumer.readPosition.load(std::memory_order_acquire);
+    const uint64_t writePosition = m_producer.writePosition.load(std::memory_order_acquire);
+
+    return writePosition - readPosition;
+}
+
+template <typename ValueType, uint64_t CapacityValue>
+inline bool SpscRing<ValueType, CapacityValue>::setCapacity(const uint64_t newCapacity) noexcept
+{
+    if (!empty() || newCapacity == 0U || newCapacity > CapacityValue)
+    {
+        return false;
+    }
+
+    m_size = newCapacity + INTERNAL_SIZE_ADD_ON;
+    m_producer.writePosition.store(0U, std::memory_order_relaxed);
+    m_producer.cachedReadPosition = 0U;
+    m_consumer.readPosition.store(0U, std::memory_order_relaxed);
+    m_consumer.cachedWritePosition = 0U;
+
+    return true;
+}
+
+template <typename ValueType, uint64_t CapacityValue>
+inline uint64_t SpscRing<ValueType, CapacityValue>::capacity() const noexcept
+{
+    return m_size - INTERNAL_SIZE_ADD_ON;
+}
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_SPSC_RING_INL
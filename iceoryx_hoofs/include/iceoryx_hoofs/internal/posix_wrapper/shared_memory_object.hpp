@@ -39,6 +39,8 @@ enum class SharedMemoryObjectError
     MAPPING_SHARED_MEMORY_FAILED,
     UNABLE_TO_VERIFY_MEMORY_SIZE,
     REQUESTED_SIZE_EXCEEDS_ACTUAL_SIZE,
+    PREFAULTING_MEMORY_FAILED,
+    LOCKING_MEMORY_FAILED,
     INTERNAL_LOGIC_FAILURE,
 };
 
@@ -118,6 +120,20 @@ class SharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(access_rights, permissions, perms::none)
 
+    /// @brief Advises the operating system to back the shared memory with huge pages to reduce the TLB misses when
+    ///        a large shared memory is accessed. This is only a hint, when huge pages are not available the shared
+    ///        memory is backed by regular pages. On Linux the transparent huge pages for shared memory must be
+    ///        enabled, see /sys/kernel/mm/transparent_hugepage/shmem_enabled
+    IOX_BUILDER_PARAMETER(bool, hugePages, false)
+
+    /// @brief Maps all pages of the shared memory into the process when it is created or opened instead of on the
+    ///        first access. A newly created shared memory is not set to zero in this case since the operating system
+    ///        provides zeroed pages and reports an error when not enough memory is available.
+    IOX_BUILDER_PARAMETER(bool, prefault, false)
+
+    /// @brief Locks the shared memory in RAM so that it is never paged out
+    IOX_BUILDER_PARAMETER(bool, lockInMemory, false)
+
   public:
     expected<SharedMemoryObject, SharedMemoryObjectError> create() noexcept;
 };
@@ -105,6 +105,35 @@ class UnixDomainSocket
     /// @return received message. In case of an error, IpcChannelError is returned and msg is empty.
     expected<std::string, IpcChannelError> timedReceive(const units::Duration& timeout) const noexcept;
 
+    /// @brief send a message which consists of the provided bytes. Unlike the std::string overload no null terminator
+    /// is appended and the bytes may contain null characters.
+    /// @param data pointer to the bytes to send
+    /// @param size number of bytes to send, must not exceed the max message size
+    /// @return IpcChannelError if error occured
+    expected<IpcChannelError> send(const char* const data, const uint64_t size) const noexcept;
+
+    /// @brief try to send a message which consists of the provided bytes for a given timeout duration
+    /// @param data pointer to the bytes to send
+    /// @param size number of bytes to send, must not exceed the max message size
+    /// @param timout for the send operation
+    /// @return IpcChannelError if error occured
+    expected<IpcChannelError>
+    timedSend(const char* const data, const uint64_t size, const units::Duration& timeout) const noexcept;
+
+    /// @brief receive a message into the provided buffer without any dynamic memory allocation
+    /// @param buffer to store the message, the message is truncated when it is larger than the buffer
+    /// @param bufferSize size of the buffer in bytes
+    /// @return number of received bytes. In case of an error, IpcChannelError is returned.
+    expected<uint64_t, IpcChannelError> receive(char* const buffer, const uint64_t bufferSize) const noexcept;
+
+    /// @brief try to receive a message into the provided buffer for a given timeout duration
+    /// @param buffer to store the message, the message is truncated when it is larger than the buffer
+    /// @param bufferSize size of the buffer in bytes
+    /// @param timout for the receive operation
+    /// @return number of received bytes. In case of an error, IpcChannelError is returned.
+    expected<uint64_t, IpcChannelError>
+    timedReceive(char* const buffer, const uint64_t bufferSize, const units::Duration& timeout) const noexcept;
+
   private:
     UnixDomainSocket(const IpcChannelName_t& name,
                      const IpcChannelSide channelSide,
@@ -125,6 +154,9 @@ class UnixDomainSocket
 
     expected<IpcChannelError> closeFileDescriptor() noexcept;
 
+    expected<IpcChannelError>
+    sendBytes(const char* const data, const uint64_t size, const units::Duration& timeout) const noexcept;
+
   private:
     static constexpr int32_t ERROR_CODE = -1;
     static constexpr int32_t INVALID_FD = -1;
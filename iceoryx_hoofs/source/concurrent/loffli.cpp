@@ -80,6 +80,54 @@ bool LoFFLi::pop(Index_t& index) noexcept
     return true;
 }
 
+uint32_t LoFFLi::pop(Index_t* const indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        if (!m_nextFreeIndex)
+        {
+            return 0U;
+        }
+
+        /// the successors of the head can only change after the head was changed; if the compare exchange
+        /// succeeds, the whole traversed chain was therefore still part of the free-list
+        numberOfIndices = 0U;
+        Index_t nextIndex = oldHead.indexToNextFreeIndex;
+        while (numberOfIndices < maxNumberOfIndices && nextIndex < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by caller
+            indices[numberOfIndices] = nextIndex;
+            ++numberOfIndices;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            nextIndex = m_nextFreeIndex.get()[nextIndex];
+        }
+
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = nextIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) see pop of a single index
+        m_nextFreeIndex.get()[indices[i]] = m_invalidIndex;
+    }
+
+    /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
+    /// check right before push to avoid double free's
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
 bool LoFFLi::push(const Index_t index) noexcept
 {
     /// we synchronize with m_nextFreeIndex in pop to perform the validity check
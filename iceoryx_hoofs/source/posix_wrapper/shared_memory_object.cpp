@@ -16,8 +16,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
 #include "iceoryx_hoofs/posix_wrapper/types.hpp"
+#include "iceoryx_platform/errno.hpp"
 #include "iceoryx_platform/fcntl.hpp"
 #include "iceoryx_platform/unistd.hpp"
 #include "iox/attributes.hpp"
@@ -75,7 +77,9 @@ expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBuilder:
                        << ", access mode = " << asStringLiteral(m_accessMode)
                        << ", open mode = " << asStringLiteral(m_openMode)
                        << ", baseAddressHint = " << logBaseAddressHint
-                       << ", permissions = " << iox::log::oct(m_permissions.value()) << " ]";
+                       << ", permissions = " << iox::log::oct(m_permissions.value())
+                       << ", hugePages = " << m_hugePages << ", prefault = " << m_prefault
+                       << ", lockInMemory = " << m_lockInMemory << " ]";
     };
 
     auto sharedMemory = SharedMemoryBuilder()
@@ -127,11 +131,51 @@ expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBuilder:
         return error<SharedMemoryObjectError>(SharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED);
     }
 
+    if (m_hugePages)
+    {
+        if (posixCall(iox_shm_advise_huge_pages)(memoryMap->getBaseAddress(), realSize)
+                .failureReturnValue(-1)
+                .evaluate()
+                .has_error())
+        {
+            IOX_LOG(WARN) << "Huge pages are not available for the shared memory [" << m_name
+                          << "], it is backed by regular pages";
+        }
+    }
+
+    bool isMemoryPrefaulted{false};
+    if (m_prefault)
+    {
+        auto prefaultResult =
+            posixCall(iox_shm_populate)(memoryMap->getBaseAddress(), realSize, convertToProtFlags(m_accessMode))
+                .failureReturnValue(-1)
+                .evaluate();
+        if (prefaultResult.has_error())
+        {
+            const auto errnum = prefaultResult.get_error().errnum;
+            if (errnum == ENOMEM || errnum == EFAULT)
+            {
+                printErrorDetails();
+                IOX_LOG(ERROR) << "Unable to prefault the shared memory since not enough memory is available";
+                return error<SharedMemoryObjectError>(SharedMemoryObjectError::PREFAULTING_MEMORY_FAILED);
+            }
+            // when prefaulting is not supported by the operating system a newly created shared memory is
+            // prefaulted by writing zeros to it
+            IOX_LOG(DEBUG) << "Prefaulting is not supported for the shared memory [" << m_name << "]";
+        }
+        else
+        {
+            isMemoryPrefaulted = true;
+        }
+    }
+
     if (sharedMemory->hasOwnership())
     {
         IOX_LOG(DEBUG) << "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name
                        << "]";
-        if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
+        // the pages of a newly created shared memory are zeroed by the operating system, writing zeros is only
+        // required to detect a lack of memory during the creation which the prefaulting already reports
+        if (!isMemoryPrefaulted && (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION || m_prefault))
         {
             // this lock is required for the case that multiple threads are creating multiple
             // shared memory objects concurrently
@@ -167,6 +211,17 @@ expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBuilder:
                        << "]";
     }
 
+    if (m_lockInMemory)
+    {
+        if (posixCall(iox_mlock)(memoryMap->getBaseAddress(), realSize).failureReturnValue(-1).evaluate().has_error())
+        {
+            printErrorDetails();
+            IOX_LOG(ERROR) << "Unable to lock the shared memory in RAM, the limit of lockable memory (RLIMIT_MEMLOCK) "
+                              "is maybe exceeded";
+            return error<SharedMemoryObjectError>(SharedMemoryObjectError::LOCKING_MEMORY_FAILED);
+        }
+    }
+
     return success<SharedMemoryObject>(SharedMemoryObject(std::move(*sharedMemory), std::move(*memoryMap)));
 }
 
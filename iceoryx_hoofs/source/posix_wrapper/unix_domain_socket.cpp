@@ -223,6 +223,28 @@ expected<IpcChannelError> UnixDomainSocket::timedSend(const std::string& msg,
         return error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
     }
 
+    return sendBytes(msg.c_str(), msg.size() + NULL_TERMINATOR_SIZE, timeout);
+}
+
+expected<IpcChannelError> UnixDomainSocket::send(const char* const data, const uint64_t size) const noexcept
+{
+    return timedSend(data, size, units::Duration::fromSeconds(0ULL));
+}
+
+expected<IpcChannelError>
+UnixDomainSocket::timedSend(const char* const data, const uint64_t size, const units::Duration& timeout) const noexcept
+{
+    if (size > m_maxMessageSize)
+    {
+        return error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
+    }
+
+    return sendBytes(data, size, timeout);
+}
+
+expected<IpcChannelError>
+UnixDomainSocket::sendBytes(const char* const data, const uint64_t size, const units::Duration& timeout) const noexcept
+{
     if (IpcChannelSide::SERVER == m_channelSide)
     {
         IOX_LOG(ERROR) << "sending on server side not supported for unix domain socket \"" << m_name << "\"";
@@ -239,9 +261,8 @@ expected<IpcChannelError> UnixDomainSocket::timedSend(const std::string& msg,
     {
         return error<IpcChannelError>(convertErrnoToIpcChannelError(setsockoptCall.get_error().errnum));
     }
-    auto sendCall = posixCall(iox_sendto)(m_sockfd, msg.c_str(), msg.size() + NULL_TERMINATOR_SIZE, 0, nullptr, 0)
-                        .failureReturnValue(ERROR_CODE)
-                        .evaluate();
+    auto sendCall =
+        posixCall(iox_sendto)(m_sockfd, data, size, 0, nullptr, 0).failureReturnValue(ERROR_CODE).evaluate();
 
     if (sendCall.has_error())
     {
@@ -262,6 +283,29 @@ expected<std::string, IpcChannelError> UnixDomainSocket::receive() const noexcep
 }
 
 expected<std::string, IpcChannelError> UnixDomainSocket::timedReceive(const units::Duration& timeout) const noexcept
+{
+    // NOLINTJUSTIFICATION needed for recvfrom
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char message[MAX_MESSAGE_SIZE + 1];
+    message[MAX_MESSAGE_SIZE] = 0;
+
+    auto receiveResult = timedReceive(&message[0], MAX_MESSAGE_SIZE, timeout);
+    if (receiveResult.has_error())
+    {
+        return error<IpcChannelError>(receiveResult.get_error());
+    }
+    return success<std::string>(&message[0]);
+}
+
+expected<uint64_t, IpcChannelError> UnixDomainSocket::receive(char* const buffer,
+                                                              const uint64_t bufferSize) const noexcept
+{
+    return timedReceive(buffer, bufferSize, units::Duration::fromSeconds(0ULL));
+}
+
+expected<uint64_t, IpcChannelError> UnixDomainSocket::timedReceive(char* const buffer,
+                                                                   const uint64_t bufferSize,
+                                                                   const units::Duration& timeout) const noexcept
 {
     if (IpcChannelSide::CLIENT == m_channelSide)
     {
@@ -279,21 +323,17 @@ expected<std::string, IpcChannelError> UnixDomainSocket::timedReceive(const unit
     {
         return error<IpcChannelError>(convertErrnoToIpcChannelError(setsockoptCall.get_error().errnum));
     }
-    // NOLINTJUSTIFICATION needed for recvfrom
-    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
-    char message[MAX_MESSAGE_SIZE + 1];
 
-    auto recvCall = posixCall(iox_recvfrom)(m_sockfd, &message[0], MAX_MESSAGE_SIZE, 0, nullptr, nullptr)
+    auto recvCall = posixCall(iox_recvfrom)(m_sockfd, buffer, bufferSize, 0, nullptr, nullptr)
                         .failureReturnValue(ERROR_CODE)
                         .suppressErrorMessagesForErrnos(EAGAIN, EWOULDBLOCK)
                         .evaluate();
-    message[MAX_MESSAGE_SIZE] = 0;
 
     if (recvCall.has_error())
     {
         return error<IpcChannelError>(convertErrnoToIpcChannelError(recvCall.get_error().errnum));
     }
-    return success<std::string>(&message[0]);
+    return success<uint64_t>(static_cast<uint64_t>(recvCall->value));
 }
 
 expected<IpcChannelError> UnixDomainSocket::initalizeSocket() noexcept
@@ -132,6 +132,59 @@ TYPED_TEST(LoFFLi_test, PopFromUninitializedLoFFLi)
     EXPECT_THAT(loFFLi.pop(index), Eq(false));
 }
 
+TYPED_TEST(LoFFLi_test, PopMultipleReturnsRequestedNumberOfIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1d0b5a4-8f3e-4c2d-9b7a-6e5f4d3c2b1a");
+    constexpr uint32_t AFFE = 0xAFFE;
+    constexpr uint32_t NUMBER_OF_INDICES{Size - 1U};
+    std::vector<uint32_t> indices(Size, AFFE);
+
+    EXPECT_THAT(this->m_loffli.pop(indices.data(), NUMBER_OF_INDICES), Eq(NUMBER_OF_INDICES));
+    for (uint32_t i = 0; i < NUMBER_OF_INDICES; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+    EXPECT_THAT(indices[NUMBER_OF_INDICES], Eq(AFFE));
+
+    uint32_t index = AFFE;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(NUMBER_OF_INDICES));
+}
+
+TYPED_TEST(LoFFLi_test, PopMultipleReturnsRemainingIndicesWhenRunningEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7e4a2c90-3b1d-4f6e-8a5c-2d9b0e1f3a47");
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+
+    std::vector<uint32_t> indices(Size + 1U);
+    EXPECT_THAT(this->m_loffli.pop(indices.data(), Size + 1U), Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.pop(indices.data(), Size + 1U), Eq(0U));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopMultipleFromUninitializedLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b95d7c31-6a0e-4d2f-91c8-4e7f2a6b0d58");
+    std::vector<uint32_t> indices(Size);
+
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.pop(indices.data(), Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, IndicesFromPopMultipleCanBePushedOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f8e6d14-5c3b-4a90-b7e2-8d1c0f9a3e65");
+    std::vector<uint32_t> indices(Size);
+    ASSERT_THAT(this->m_loffli.pop(indices.data(), Size), Eq(Size));
+
+    for (const auto& index : indices)
+    {
+        EXPECT_THAT(this->m_loffli.push(index), Eq(true));
+        EXPECT_THAT(this->m_loffli.push(index), Eq(false));
+    }
+}
+
 TYPED_TEST(LoFFLi_test, SinglePush)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0b7bf346-056b-4b1c-a6e9-92b54233598e");
@@ -0,0 +1,231 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/spsc_ring.hpp"
+#include "iox/attributes.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace
+{
+using namespace testing;
+using namespace iox::concurrent;
+
+constexpr uint64_t RING_CAPACITY{10U};
+
+using SpscRing_t = SpscRing<uint64_t, RING_CAPACITY>;
+
+class SpscRing_test : public TestWithParam<SpscRingFullPolicy>
+{
+  public:
+    void fill(const uint64_t firstValue)
+    {
+        for (uint64_t i = 0U; i < sut.capacity(); ++i)
+        {
+            ASSERT_FALSE(sut.push(firstValue + i).has_value());
+        }
+    }
+
+    SpscRing_t sut{GetParam()};
+};
+
+INSTANTIATE_TEST_SUITE_P(SpscRing,
+                         SpscRing_test,
+                         Values(SpscRingFullPolicy::REJECT_NEWEST_VALUE, SpscRingFullPolicy::DISCARD_OLDEST_VALUE));
+
+TEST_P(SpscRing_test, NewRingIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ec05b896-90b3-4621-965e-722d2cf89307");
+    EXPECT_TRUE(sut.empty());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(sut.capacity(), Eq(RING_CAPACITY));
+}
+
+TEST_P(SpscRing_test, PopOnEmptyRingReturnsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a172a78c-ba82-4352-854d-2a308cc77e1d");
+    EXPECT_FALSE(sut.pop().has_value());
+}
+
+TEST_P(SpscRing_test, PushedValueIsPopped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f8c7df6-6860-4eb3-b147-d7458fb8ebc1");
+    EXPECT_FALSE(sut.push(73U).has_value());
+    EXPECT_FALSE(sut.empty());
+    EXPECT_THAT(sut.size(), Eq(1U));
+
+    auto value = sut.pop();
+
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value.value(), Eq(73U));
+    EXPECT_TRUE(sut.empty());
+}
+
+TEST_P(SpscRing_test, ValuesArePoppedInTheOrderTheyWerePushed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5cd4d95-b277-4e8f-9c4d-5d278dd48d56");
+    // more rounds than slots to cover the wrap around
+    for (uint64_t round = 0U; round < 3U * RING_CAPACITY; ++round)
+    {
+        fill(round * RING_CAPACITY);
+        EXPECT_THAT(sut.size(), Eq(RING_CAPACITY));
+        for (uint64_t i = 0U; i < RING_CAPACITY; ++i)
+        {
+            auto value = sut.pop();
+            ASSERT_TRUE(value.has_value());
+            EXPECT_THAT(value.value(), Eq(round * RING_CAPACITY + i));
+        }
+        EXPECT_TRUE(sut.empty());
+    }
+}
+
+TEST_P(SpscRing_test, AlternatingPushAndPopNeverOverflows)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "79093ba3-ba75-4acb-baa3-b8e2efb7a4c4");
+    for (uint64_t i = 0U; i < 5U * RING_CAPACITY; ++i)
+    {
+        EXPECT_FALSE(sut.push(i).has_value());
+        auto value = sut.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(value.value(), Eq(i));
+    }
+}
+
+TEST_P(SpscRing_test, PushIntoFullRingReturnsTheValueWhichIsNotInTheRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26a589e1-7909-4272-8b47-19d337814062");
+    constexpr uint64_t FIRST_VALUE{100U};
+    constexpr uint64_t OVERFLOWING_VALUE{666U};
+    fill(FIRST_VALUE);
+
+    auto returnedValue = sut.push(OVERFLOWING_VALUE);
+
+    ASSERT_TRUE(returnedValue.has_value());
+    EXPECT_THAT(sut.size(), Eq(RING_CAPACITY));
+    auto oldestValue = sut.pop();
+    ASSERT_TRUE(oldestValue.has_value());
+    if (GetParam() == SpscRingFullPolicy::REJECT_NEWEST_VALUE)
+    {
+        EXPECT_THAT(returnedValue.value(), Eq(OVERFLOWING_VALUE));
+        EXPECT_THAT(oldestValue.value(), Eq(FIRST_VALUE));
+    }
+    else
+    {
+        EXPECT_THAT(returnedValue.value(), Eq(FIRST_VALUE));
+        EXPECT_THAT(oldestValue.value(), Eq(FIRST_VALUE + 1U));
+    }
+}
+
+TEST_P(SpscRing_test, RingWithDiscardOldestValueContainsTheNewestValuesAfterMultipleOverflows)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "20a6e686-73ae-4e78-a30f-fbf5eff22ecf");
+    if (GetParam() != SpscRingFullPolicy::DISCARD_OLDEST_VALUE)
+    {
+        GTEST_SKIP() << "Only relevant for DISCARD_OLDEST_VALUE";
+    }
+    constexpr uint64_t NUMBER_OF_PUSHES{3U * RING_CAPACITY + 3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_PUSHES; ++i)
+    {
+        auto discardedValue = sut.push(i);
+        if (i < RING_CAPACITY)
+        {
+            EXPECT_FALSE(discardedValue.has_value());
+        }
+        else
+        {
+            ASSERT_TRUE(discardedValue.has_value());
+            EXPECT_THAT(discardedValue.value(), Eq(i - RING_CAPACITY));
+        }
+    }
+
+    for (uint64_t i = NUMBER_OF_PUSHES - RING_CAPACITY; i < NUMBER_OF_PUSHES; ++i)
+    {
+        auto value = sut.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(value.value(), Eq(i));
+    }
+    EXPECT_TRUE(sut.empty());
+}
+
+TEST_P(SpscRing_test, PopMakesSpaceInFullRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e55e6cde-959b-4c7e-8949-d66bd63e06b7");
+    fill(0U);
+
+    IOX_DISCARD_RESULT(sut.pop());
+
+    EXPECT_FALSE(sut.push(RING_CAPACITY).has_value());
+    EXPECT_THAT(sut.size(), Eq(RING_CAPACITY));
+}
+
+TEST_P(SpscRing_test, SetCapacityOnEmptyRingSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "415beb9c-db37-43e8-8f98-ac34bcc77dfa");
+    constexpr uint64_t NEW_CAPACITY{3U};
+
+    EXPECT_TRUE(sut.setCapacity(NEW_CAPACITY));
+    EXPECT_THAT(sut.capacity(), Eq(NEW_CAPACITY));
+
+    fill(0U);
+    EXPECT_TRUE(sut.push(NEW_CAPACITY).has_value());
+    EXPECT_THAT(sut.size(), Eq(NEW_CAPACITY));
+}
+
+TEST_P(SpscRing_test, SetCapacityOnNonEmptyRingFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8be1744c-5c45-4d4b-baa9-dc00d70f8d93");
+    IOX_DISCARD_RESULT(sut.push(1U));
+
+    EXPECT_FALSE(sut.setCapacity(3U));
+    EXPECT_THAT(sut.capacity(), Eq(RING_CAPACITY));
+}
+
+TEST_P(SpscRing_test, SetCapacityOutOfRangeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf49d922-0e1f-47cd-9c85-f9278d63e0b0");
+    EXPECT_FALSE(sut.setCapacity(0U));
+    EXPECT_FALSE(sut.setCapacity(RING_CAPACITY + 1U));
+    EXPECT_THAT(sut.capacity(), Eq(RING_CAPACITY));
+}
+
+TEST_P(SpscRing_test, SetCapacityAfterUsageStartsWithAnEmptyRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "02cbb08f-e77b-49cd-8053-98998f2caac2");
+    fill(0U);
+    while (sut.pop().has_value())
+    {
+    }
+
+    ASSERT_TRUE(sut.setCapacity(RING_CAPACITY));
+
+    EXPECT_TRUE(sut.empty());
+    EXPECT_FALSE(sut.pop().has_value());
+    fill(0U);
+    EXPECT_THAT(sut.size(), Eq(RING_CAPACITY));
+}
+
+TEST(SpscRingLayout_test, ProducerAndConsumerPositionsAreSeparatedByAtLeastOneCacheLine)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c250848b-475e-4908-b97e-fda50ba34c9b");
+    // the positions are private, but the ring must be larger than the slots by at least three cache lines of
+    // padding; in front of the producer, between the producer and the consumer and behind the consumer
+    EXPECT_THAT(sizeof(SpscRing_t), Ge((RING_CAPACITY + 1U) * sizeof(uint64_t) + 3U * SpscRing_t::CACHE_LINE_SIZE));
+}
+
+} // namespace
@@ -162,6 +162,90 @@ TEST_F(SharedMemoryObject_Test, OpenSutMapsAllMemoryIntoProcess)
     }
 }
 
+TEST_F(SharedMemoryObject_Test, PrefaultedSharedMemoryIsZeroedAndWritable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f17c33ea-722b-46d3-9e3f-42c496959938");
+    const uint64_t MEMORY_SIZE = 1024 * 1024;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmPrefault")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .prefault(true)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint8_t*>(sut.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ASSERT_THAT(data_ptr[i], Eq(0U));
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        data_ptr[i] = static_cast<uint8_t>(i);
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, OpeningPrefaultedSharedMemoryContainsDataOfCreator)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f47f0fc1-772b-48bc-b24f-892c1279cfac");
+    const uint64_t MEMORY_SIZE = 1024;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmPrefault")
+                   .memorySizeInBytes(MEMORY_SIZE * sizeof(uint64_t))
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .prefault(true)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint64_t*>(sut.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        data_ptr[i] = i * 3 + 1;
+    }
+
+    auto sut2 = iox::posix::SharedMemoryObjectBuilder()
+                    .name("shmPrefault")
+                    .memorySizeInBytes(MEMORY_SIZE * sizeof(uint64_t))
+                    .openMode(iox::posix::OpenMode::OPEN_EXISTING)
+                    .prefault(true)
+                    .create()
+                    .expect("failed to open sut");
+
+    auto* data_ptr2 = static_cast<uint64_t*>(sut2.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        EXPECT_THAT(data_ptr2[i], Eq(i * 3 + 1));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryWithHugePagesIsCreatedEvenWhenHugePagesAreNotAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3787c9b-2cfe-49c9-ab8d-e59d3a80fab7");
+    constexpr uint64_t HUGE_PAGE_SIZE = 2U * 1024U * 1024U;
+    const uint64_t MEMORY_SIZE = 2U * HUGE_PAGE_SIZE;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmHugePages")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .hugePages(true)
+                   .prefault(true)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint8_t*>(sut.getBaseAddress());
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    data_ptr[MEMORY_SIZE - 1] = 42U;
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    EXPECT_THAT(data_ptr[MEMORY_SIZE - 1], Eq(42U));
+}
+
 #if !defined(_WIN32) && !defined(__APPLE__)
 TEST_F(SharedMemoryObject_Test, AcquiringOwnerWorks)
 {
@@ -233,6 +317,27 @@ TEST_F(SharedMemoryObject_Test, SettingPermissionsWorks)
     ASSERT_FALSE(result.has_error());
     EXPECT_THAT(*result, Eq(perms::none));
 }
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryLockedInMemoryIsUsable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da1c141a-6ed0-4a62-94ad-a842349577e6");
+    const uint64_t MEMORY_SIZE = 4096;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmLocked")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .lockInMemory(true)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint8_t*>(sut.getBaseAddress());
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    data_ptr[MEMORY_SIZE - 1] = 13U;
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    EXPECT_THAT(data_ptr[MEMORY_SIZE - 1], Eq(13U));
+}
 #endif
 
 
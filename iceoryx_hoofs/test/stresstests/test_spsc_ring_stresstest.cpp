@@ -0,0 +1,174 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/spsc_ring.hpp"
+#include "iceoryx_hoofs/testing/barrier.hpp"
+#include "iceoryx_hoofs/testing/test.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::concurrent;
+
+constexpr uint64_t NUMBER_OF_VALUES{1000000U};
+
+/// @brief the values consist of two identical halves; a value which was read while it was written concurrently
+/// would be torn, i.e. the halves would differ
+struct Data
+{
+    Data() noexcept = default;
+    explicit Data(const uint64_t value) noexcept
+        : value(value)
+        , check(value)
+    {
+    }
+
+    uint64_t value{0U};
+    uint64_t check{0U};
+};
+
+template <typename T>
+class SpscRingStressTest : public Test
+{
+  public:
+    using Ring = T;
+
+    /// @brief consumes until the producer has finished and the ring is empty; every popped value is counted
+    void consume(Ring& ring, std::atomic<bool>& producerIsRunning, std::vector<uint8_t>& seenValues, bool& isOrdered)
+    {
+        m_consumerIsRunning.notify();
+
+        bool hasPoppedAValue{false};
+        uint64_t lastValue{0U};
+        while (producerIsRunning || !ring.empty())
+        {
+            auto popped = ring.pop();
+            if (!popped.has_value())
+            {
+                // gives the producer a chance to run on machines with less cores than threads
+                std::this_thread::yield();
+                continue;
+            }
+
+            const auto& data = popped.value();
+            const bool isOutOfOrder = hasPoppedAValue && data.value <= lastValue;
+            if (data.value != data.check || data.value >= NUMBER_OF_VALUES || isOutOfOrder)
+            {
+                isOrdered = false;
+                continue;
+            }
+            ++seenValues[data.value];
+            lastValue = data.value;
+            hasPoppedAValue = true;
+        }
+    }
+
+    Barrier m_consumerIsRunning{1U};
+    Ring rejectingSut{SpscRingFullPolicy::REJECT_NEWEST_VALUE};
+    Ring discardingSut{SpscRingFullPolicy::DISCARD_OLDEST_VALUE};
+};
+
+template <uint64_t Capacity>
+using TestRing = SpscRing<Data, Capacity>;
+
+// a single slot maximizes the overflows and races on the same slot, the large ring the wrap arounds
+using TestRings = Types<TestRing<1U>, TestRing<10U>, TestRing<1000U>>;
+
+TYPED_TEST_SUITE(SpscRingStressTest, TestRings, );
+
+/// @brief A producer pushes consecutive values and retries when the ring is full, a concurrent consumer pops them.
+/// Every value must be received exactly once, in order and not torn.
+TYPED_TEST(SpscRingStressTest, RejectNewestValueDeliversAllValuesInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a0e9a1fa-7ce3-4ba0-b99c-7ab4b5dbd5e4");
+    std::atomic<bool> producerIsRunning{true};
+    std::vector<uint8_t> seenValues(NUMBER_OF_VALUES, 0U);
+    bool isOrdered{true};
+
+    std::thread consumer([&] { this->consume(this->rejectingSut, producerIsRunning, seenValues, isOrdered); });
+
+    this->m_consumerIsRunning.wait();
+    for (uint64_t i = 0U; i < NUMBER_OF_VALUES; ++i)
+    {
+        while (this->rejectingSut.push(Data(i)).has_value())
+        {
+            std::this_thread::yield();
+        }
+    }
+    producerIsRunning = false;
+    consumer.join();
+
+    EXPECT_TRUE(isOrdered);
+    uint64_t numberOfMissingValues{0U};
+    for (const auto seen : seenValues)
+    {
+        numberOfMissingValues += (seen == 1U) ? 0U : 1U;
+    }
+    EXPECT_THAT(numberOfMissingValues, Eq(0U));
+}
+
+/// @brief A producer pushes consecutive values into a ring which discards the oldest value on an overflow while a
+/// concurrent consumer pops them. Every value must either be received by the consumer or be returned to the producer
+/// as discarded, never both and never torn. The values received by the consumer must be in order.
+TYPED_TEST(SpscRingStressTest, DiscardOldestValueEitherDeliversOrReturnsEveryValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b8b55f6-c6c1-4ff1-bd63-d0b8f5d01d85");
+    std::atomic<bool> producerIsRunning{true};
+    std::vector<uint8_t> seenValues(NUMBER_OF_VALUES, 0U);
+    bool isOrdered{true};
+    bool isDiscardedValueValid{true};
+    uint64_t numberOfDiscardedValues{0U};
+
+    std::vector<uint8_t> discardedValues(NUMBER_OF_VALUES, 0U);
+    std::thread consumer([&] { this->consume(this->discardingSut, producerIsRunning, seenValues, isOrdered); });
+
+    this->m_consumerIsRunning.wait();
+    for (uint64_t i = 0U; i < NUMBER_OF_VALUES; ++i)
+    {
+        auto discarded = this->discardingSut.push(Data(i));
+        if (discarded.has_value())
+        {
+            const auto& data = discarded.value();
+            if (data.value != data.check || data.value >= NUMBER_OF_VALUES)
+            {
+                isDiscardedValueValid = false;
+                continue;
+            }
+            ++discardedValues[data.value];
+            ++numberOfDiscardedValues;
+        }
+    }
+    producerIsRunning = false;
+    consumer.join();
+
+    EXPECT_TRUE(isOrdered);
+    EXPECT_TRUE(isDiscardedValueValid);
+    uint64_t numberOfLostOrDuplicatedValues{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_VALUES; ++i)
+    {
+        numberOfLostOrDuplicatedValues += (seenValues[i] + discardedValues[i] == 1U) ? 0U : 1U;
+    }
+    EXPECT_THAT(numberOfLostOrDuplicatedValues, Eq(0U));
+    ::testing::Test::RecordProperty("numberOfDiscardedValues", std::to_string(numberOfDiscardedValues));
+}
+
+} // namespace
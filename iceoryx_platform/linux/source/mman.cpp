@@ -16,6 +16,7 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <errno.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -34,3 +35,28 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_shm_advise_huge_pages(void* addr, size_t length)
+{
+    return madvise(addr, length, MADV_HUGEPAGE);
+}
+
+int iox_shm_populate(void* addr, size_t length, int prot)
+{
+#if defined(MADV_POPULATE_READ) && defined(MADV_POPULATE_WRITE)
+    // NOLINTNEXTLINE(hicpp-signed-bitwise) flags are defined by POSIX
+    return madvise(addr, length, ((prot & PROT_WRITE) != 0) ? MADV_POPULATE_WRITE : MADV_POPULATE_READ);
+#else
+    // the kernel headers are older than Linux 5.14 which introduced prefaulting with madvise
+    (void)addr;
+    (void)length;
+    (void)prot;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
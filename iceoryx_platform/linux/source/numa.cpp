@@ -0,0 +1,108 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/numa.hpp"
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <errno.h>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+constexpr int MAX_NUMBER_OF_NODES{1024};
+constexpr int BITS_PER_MASK_ENTRY{static_cast<int>(sizeof(unsigned long) * CHAR_BIT)};
+
+struct NodeMask
+{
+    unsigned long bits[MAX_NUMBER_OF_NODES / BITS_PER_MASK_ENTRY]{};
+    // the kernel expects the number of bits plus one
+    unsigned long maxNode{MAX_NUMBER_OF_NODES + 1};
+};
+
+bool createNodeMask(int node, NodeMask& mask)
+{
+    if (node < 0 || node >= MAX_NUMBER_OF_NODES)
+    {
+        errno = EINVAL;
+        return false;
+    }
+    mask.bits[node / BITS_PER_MASK_ENTRY] = 1UL << static_cast<unsigned long>(node % BITS_PER_MASK_ENTRY);
+    return true;
+}
+} // namespace
+
+int iox_numa_number_of_nodes(void)
+{
+    // the file contains the possible nodes as list of ranges, e.g. '0-1', the last number is the highest node
+    FILE* file = fopen("/sys/devices/system/node/possible", "r");
+    if (file == nullptr)
+    {
+        return 1;
+    }
+
+    char buffer[256] = {};
+    const bool hasContent = (fgets(buffer, sizeof(buffer), file) != nullptr);
+    fclose(file);
+    if (!hasContent)
+    {
+        return 1;
+    }
+
+    long highestNode{0};
+    const char* position = buffer;
+    while (*position != '\0')
+    {
+        if (*position < '0' || *position > '9')
+        {
+            ++position;
+            continue;
+        }
+        char* end = nullptr;
+        highestNode = strtol(position, &end, 10);
+        position = end;
+    }
+
+    return (highestNode >= 0 && highestNode < MAX_NUMBER_OF_NODES) ? static_cast<int>(highestNode) + 1 : 1;
+}
+
+int iox_numa_bind_thread_memory(int node)
+{
+    if (node < 0)
+    {
+        return static_cast<int>(syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0UL));
+    }
+
+    NodeMask mask;
+    if (!createNodeMask(node, mask))
+    {
+        return -1;
+    }
+    return static_cast<int>(syscall(SYS_set_mempolicy, MPOL_BIND, mask.bits, mask.maxNode));
+}
+
+int iox_numa_bind_memory(void* addr, size_t length, int node)
+{
+    NodeMask mask;
+    if (!createNodeMask(node, mask))
+    {
+        return -1;
+    }
+    return static_cast<int>(syscall(SYS_mbind, addr, length, MPOL_BIND, mask.bits, mask.maxNode, MPOL_MF_MOVE));
+}
@@ -0,0 +1,48 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/numa.hpp"
+
+#include <errno.h>
+
+// the platform has no NUMA support, node 0 is the only node and contains all memory
+
+int iox_numa_number_of_nodes(void)
+{
+    return 1;
+}
+
+int iox_numa_bind_thread_memory(int node)
+{
+    if (node > 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
+int iox_numa_bind_memory(void* addr, size_t length, int node)
+{
+    (void)addr;
+    (void)length;
+    if (node > 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
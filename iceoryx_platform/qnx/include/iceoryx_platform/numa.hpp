@@ -0,0 +1,31 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_QNX_PLATFORM_NUMA_HPP
+#define IOX_HOOFS_QNX_PLATFORM_NUMA_HPP
+
+#include <cstddef>
+
+/// @brief returns the number of NUMA nodes, a system without NUMA support has a single node
+int iox_numa_number_of_nodes(void);
+
+/// @brief binds the memory which is allocated by the calling thread to a NUMA node, a negative node restores the
+/// default policy of the thread
+int iox_numa_bind_thread_memory(int node);
+
+/// @brief binds the pages of a mapped memory range to a NUMA node, pages which are already allocated are moved
+int iox_numa_bind_memory(void* addr, size_t length, int node);
+
+#endif // IOX_HOOFS_QNX_PLATFORM_NUMA_HPP
@@ -23,4 +23,8 @@ int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 int iox_shm_close(int fd);
 
+int iox_shm_advise_huge_pages(void* addr, size_t length);
+int iox_shm_populate(void* addr, size_t length, int prot);
+int iox_mlock(const void* addr, size_t length);
+
 #endif // IOX_HOOFS_UNIX_PLATFORM_MMAN_HPP
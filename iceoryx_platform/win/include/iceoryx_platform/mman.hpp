@@ -48,6 +48,12 @@ int iox_shm_unlink(const char* name);
 
 int iox_shm_close(int fd);
 
+int iox_shm_advise_huge_pages(void* addr, size_t length);
+
+int iox_shm_populate(void* addr, size_t length, int prot);
+
+int iox_mlock(const void* addr, size_t length);
+
 void internal_iox_shm_set_size(int fd, off_t length);
 
 off_t internal_iox_shm_get_size(int fd);
@@ -255,3 +255,21 @@ off_t internal_iox_shm_get_size(int fd)
     fclose(shm_state);
     return shm_size;
 }
+
+int iox_shm_advise_huge_pages(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_shm_populate(void*, size_t, int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mlock(const void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
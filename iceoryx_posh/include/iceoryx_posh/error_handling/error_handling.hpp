@@ -78,10 +78,14 @@ namespace iox
     error(POPO__BASE_SERVER_OVERRIDING_WITH_EVENT_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__BASE_SERVER_OVERRIDING_WITH_STATE_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION) \
+    error(POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
+    error(POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED_IN_WAIT_FOR_SPACE) \
+    error(POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED_IN_WAKE_UP) \
     error(POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER) \
     error(POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER) \
+    error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_RESIZE_FROM_USER) \
     error(POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER) \
     error(POPO__CHUNK_TRY_LOCK_ERROR) \
     error(POPO__CHUNK_LOCKING_ERROR) \
@@ -117,6 +121,7 @@ namespace iox
     error(MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY) \
     error(MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT) \
     error(MEPOO__SEGMENT_INSUFFICIENT_SEGMENT_IDS) \
+    error(MEPOO__SEGMENT_NUMA_NODE_NOT_AVAILABLE) \
     error(MEPOO__INTROSPECTION_CONTAINER_FULL) \
     error(MEPOO__CANNOT_ALLOCATE_CHUNK) \
     error(MEPOO__MAXIMUM_NUMBER_OF_MEMPOOLS_REACHED) \
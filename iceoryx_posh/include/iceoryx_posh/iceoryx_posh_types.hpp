@@ -30,6 +30,7 @@
 #include "iox/vector.hpp"
 
 #include <cstdint>
+#include <type_traits>
 
 namespace iox
 {
@@ -70,9 +71,10 @@ constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBE
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
-// 3x publisherPort port introspection
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+// 4x publisherPort port introspection
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 6;
+// the full service registry and the changes of the service registry
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -114,6 +116,8 @@ constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = build::IOX_MAX_NUMBER_OF_MEMPOOLS;
 constexpr uint32_t MAX_SHM_SEGMENTS = build::IOX_MAX_SHM_SEGMENTS;
 
+constexpr uint32_t MAX_CHUNK_MAGAZINE_CAPACITY = 32U;
+
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
 
@@ -122,11 +126,15 @@ constexpr uint32_t CHUNK_NO_USER_HEADER_SIZE{0U};
 constexpr uint32_t CHUNK_NO_USER_HEADER_ALIGNMENT{1U};
 
 // Message Queue
+// the message sizes fit into the smallest unix domain socket message size of the supported platforms; the binary
+// messages for the port creation are packed with as many requests as fit into one message
 constexpr uint32_t ROUDI_MAX_MESSAGES = 5U;
-constexpr uint32_t ROUDI_MESSAGE_SIZE = 512U;
+constexpr uint32_t ROUDI_MESSAGE_SIZE = 1000U;
 constexpr uint32_t APP_MAX_MESSAGES = 5U;
-constexpr uint32_t APP_MESSAGE_SIZE = 512U;
+constexpr uint32_t APP_MESSAGE_SIZE = 1000U;
 
+// Port creation
+constexpr uint32_t MAX_PORTS_PER_CREATION_BATCH = 128U;
 
 // Processes
 constexpr uint32_t MAX_PROCESS_NUMBER = build::IOX_MAX_PROCESS_NUMBER;
@@ -138,6 +146,7 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_CHANGES_EVENT_NAME[] = "ServiceRegistryChanges";
 
 // Nodes
 constexpr uint32_t MAX_NODE_NUMBER = build::IOX_MAX_NODE_NUMBER;
@@ -195,6 +204,9 @@ struct DefaultChunkDistributorConfig
 struct DefaultChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    /// @brief with 1:n communication a subscriber is connected to a single publisher and its queue can be an SPSC queue
+    static constexpr bool HAS_SINGLE_PRODUCER =
+        std::is_same<build::CommunicationPolicy, build::OneToManyPolicy>::value;
 };
 
 // alias for string
@@ -228,8 +240,15 @@ constexpr uint16_t DEFAULT_UNIQUE_ROUDI_ID{0U};
 using namespace units::duration_literals;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
+/// @brief interval of the process monitoring in RouDi; the discovery is triggered by the ports when their CaPro state
+/// changes and is additionally run with every monitoring cycle
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
 
+/// @brief the messages of the runtimes are processed by a pool of worker threads; the messages of one runtime are
+/// always processed by the same worker to preserve their order
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIME_MESSAGES_WORKERS{4U};
+constexpr uint32_t MAX_NUMBER_OF_RUNTIME_MESSAGES_WORKERS{32U};
+
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
 /// Contrarily, unmonitored processes can be restarted but registration will fail.
@@ -0,0 +1,117 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHUNK_CHAIN_INL
+#define IOX_POSH_MEPOO_CHUNK_CHAIN_INL
+
+#include "iceoryx_posh/mepoo/chunk_chain.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+template <typename ByteType>
+inline ChunkChainView<ByteType>::Iterator::Iterator(ChunkHeader_t* const link) noexcept
+    : m_link(link)
+{
+}
+
+template <typename ByteType>
+inline span<ByteType> ChunkChainView<ByteType>::Iterator::operator*() const noexcept
+{
+    return span<ByteType>(static_cast<ByteType*>(m_link->userPayload()), m_link->userPayloadSize());
+}
+
+template <typename ByteType>
+inline typename ChunkChainView<ByteType>::Iterator& ChunkChainView<ByteType>::Iterator::operator++() noexcept
+{
+    m_link = chainHeader(m_link)->nextLink.get();
+    return *this;
+}
+
+template <typename ByteType>
+inline typename ChunkChainView<ByteType>::Iterator ChunkChainView<ByteType>::Iterator::operator++(int) noexcept
+{
+    Iterator current{*this};
+    ++(*this);
+    return current;
+}
+
+template <typename ByteType>
+inline bool ChunkChainView<ByteType>::Iterator::operator==(const Iterator& rhs) const noexcept
+{
+    return m_link == rhs.m_link;
+}
+
+template <typename ByteType>
+inline bool ChunkChainView<ByteType>::Iterator::operator!=(const Iterator& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template <typename ByteType>
+inline ChunkChainView<ByteType>::ChunkChainView(ChunkHeader_t* const firstLink) noexcept
+    : m_firstLink(firstLink)
+{
+}
+
+template <typename ByteType>
+inline optional<ChunkChainView<ByteType>>
+ChunkChainView<ByteType>::fromUserPayload(UserPayload_t* const userPayload) noexcept
+{
+    ChunkHeader_t* chunkHeader = ChunkHeader::fromUserPayload(userPayload);
+    if (chunkHeader == nullptr || chunkHeader->userHeaderId() != ChunkHeader::CHUNK_CHAIN_USER_HEADER
+        || chainHeader(chunkHeader)->linkIndex != 0U)
+    {
+        return nullopt;
+    }
+    return ChunkChainView(chunkHeader);
+}
+
+template <typename ByteType>
+inline uint64_t ChunkChainView<ByteType>::size() const noexcept
+{
+    return chainHeader(m_firstLink)->chainPayloadSize;
+}
+
+template <typename ByteType>
+inline uint32_t ChunkChainView<ByteType>::numberOfLinks() const noexcept
+{
+    return chainHeader(m_firstLink)->numberOfLinks;
+}
+
+template <typename ByteType>
+inline typename ChunkChainView<ByteType>::Iterator ChunkChainView<ByteType>::begin() const noexcept
+{
+    return Iterator(m_firstLink);
+}
+
+template <typename ByteType>
+inline typename ChunkChainView<ByteType>::Iterator ChunkChainView<ByteType>::end() const noexcept
+{
+    return Iterator(nullptr);
+}
+
+template <typename ByteType>
+inline const ChunkChainHeader* ChunkChainView<ByteType>::chainHeader(const ChunkHeader* const link) noexcept
+{
+    return static_cast<const ChunkChainHeader*>(link->userHeader());
+}
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_CHAIN_INL
@@ -0,0 +1,90 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHUNK_MAGAZINE_HPP
+#define IOX_POSH_MEPOO_CHUNK_MAGAZINE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iox/optional.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief The memory of a reserved chunk and of its chunk management
+struct ReservedChunk
+{
+    void* chunk{nullptr};
+    void* chunkManagement{nullptr};
+};
+
+/// @brief Caches reserved chunks of a single mempool for a port. The chunks are reserved and returned in batches to
+/// reduce the number of accesses to the free lists and statistics of the mempools, which are shared by all processes.
+/// The ChunkMagazine is not thread-safe. It is located in the shared memory so that RouDi can return the reserved
+/// chunks to the mempools when the owning port is destroyed.
+class ChunkMagazine
+{
+  public:
+    /// @brief Creates a ChunkMagazine
+    /// @param[in] capacity is the number of chunks which are reserved at once, it is clamped to
+    /// MAX_CHUNK_MAGAZINE_CAPACITY; a capacity of 0 disables the magazine
+    explicit ChunkMagazine(const uint32_t capacity) noexcept;
+
+    ChunkMagazine(const ChunkMagazine&) = delete;
+    ChunkMagazine(ChunkMagazine&&) = delete;
+    ChunkMagazine& operator=(const ChunkMagazine&) = delete;
+    ChunkMagazine& operator=(ChunkMagazine&&) = delete;
+    ~ChunkMagazine() noexcept = default;
+
+    /// @brief Returns the number of chunks which are reserved at once
+    uint32_t capacity() const noexcept;
+
+    /// @brief Returns the number of currently reserved chunks
+    uint32_t size() const noexcept;
+
+    /// @brief Takes a reserved chunk of the provided mempool. If there is none, the magazine is refilled with a single
+    /// access to the free lists of the mempools. Chunks of a previously used mempool are returned to it beforehand.
+    /// @param[in] memPool is the mempool to take the chunk from
+    /// @param[in] chunkManagementPool is the mempool to take the chunk management from
+    /// @return the reserved chunk or nullopt if the magazine is disabled or the mempools ran out of chunks
+    optional<ReservedChunk> take(MemPool& memPool, MemPool& chunkManagementPool) noexcept;
+
+    /// @brief Returns all reserved chunks to their mempools
+    void drain() noexcept;
+
+  private:
+    void refill() noexcept;
+    void markTakenChunksAsUsed() noexcept;
+
+  private:
+    RelativePointer<MemPool> m_memPool;
+    RelativePointer<MemPool> m_chunkManagementPool;
+    uint32_t m_capacity{0U};
+    uint32_t m_size{0U};
+    /// @brief the number of chunks taken since the statistics of the mempools were updated the last time
+    uint32_t m_numberOfTakenChunks{0U};
+    uint32_t m_chunkIndices[MAX_CHUNK_MAGAZINE_CAPACITY];
+    uint32_t m_chunkManagementIndices[MAX_CHUNK_MAGAZINE_CAPACITY];
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_MAGAZINE_HPP
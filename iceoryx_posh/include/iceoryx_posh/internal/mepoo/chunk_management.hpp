@@ -45,6 +45,13 @@ struct ChunkManagement
 
     iox::RelativePointer<MemPool> m_mempool;
     iox::RelativePointer<MemPool> m_chunkManagementPool;
+
+    /// @brief the monotonic time in nanoseconds when the chunk was sent; 0 if the publisher does not stamp the chunks
+    uint64_t m_sendTimestamp{0U};
+
+    /// @brief the next link if the chunk is a link of a chunk chain; the chunk owns one reference of the next link
+    /// which is released when the chunk is freed
+    iox::RelativePointer<ChunkManagement> m_nextLink;
 };
 } // namespace mepoo
 } // namespace iox
@@ -36,12 +36,15 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint32_t chunkSize) noexcept;
+                const uint32_t chunkSize,
+                const uint32_t cachedChunks = 0U) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    /// @brief the number of used chunks which are reserved in a ChunkMagazine
+    uint32_t m_cachedChunks{0};
 };
 
 class MemPool
@@ -69,6 +72,29 @@ class MemPool
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Reserves multiple chunks with a single operation on the free list. The reserved chunks count as used
+    /// and additionally as cached until they are marked as used with markReservedChunksAsUsed
+    /// @param[out] chunkIndices memory for at least maxNumberOfChunks chunk indices
+    /// @param[in] maxNumberOfChunks is the maximum number of chunks to reserve
+    /// @return the number of reserved chunks
+    uint32_t reserveChunks(uint32_t* const chunkIndices, const uint32_t maxNumberOfChunks) noexcept;
+
+    /// @brief Returns the chunk for an index obtained by reserveChunks
+    /// @param[in] chunkIndex is the index of the chunk
+    /// @return pointer to the chunk
+    void* getReservedChunk(const uint32_t chunkIndex) const noexcept;
+
+    /// @brief Updates the statistics for reserved chunks which were handed out to a user
+    /// @param[in] numberOfChunks is the number of reserved chunks which are in use now
+    void markReservedChunksAsUsed(const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Returns reserved chunks which were not handed out to a user back to the free list
+    /// @param[in] chunkIndices are the indices of the reserved chunks
+    /// @param[in] numberOfChunks is the number of chunk indices
+    void releaseReservedChunks(const uint32_t* const chunkIndices, const uint32_t numberOfChunks) noexcept;
+
+    uint32_t getCachedChunks() const noexcept;
+
   private:
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
@@ -82,6 +108,7 @@ class MemPool
 
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
+    std::atomic<uint32_t> m_cachedChunks{0U};
 
     freeList_t m_freeIndices;
 };
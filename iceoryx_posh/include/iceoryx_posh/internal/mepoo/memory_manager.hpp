@@ -18,6 +18,7 @@
 #define IOX_POSH_MEPOO_MEMORY_MANAGER_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_magazine.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
@@ -72,6 +73,27 @@ class MemoryManager
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Obtains a chunk from the mempools via a ChunkMagazine, which reserves the chunks of the mempools in
+    /// batches. If the magazine is disabled, the chunk is obtained directly from the mempools.
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkMagazine which caches the reserved chunks of the caller
+    /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
+    expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings, ChunkMagazine& chunkMagazine) noexcept;
+
+    /// @brief Obtains the links of a chunk chain from the mempools, see ChunkChainHeader. The links are obtained from
+    /// the mempools which fit their user-payload, i.e. the last link which carries the remainder of the user-payload
+    /// is usually obtained from a smaller mempool. If one of the links cannot be obtained, the already obtained links
+    /// are returned to the mempools.
+    /// @param[in] chainPayloadSize is the user-payload size of the whole chain, must not be 0
+    /// @param[in] linkSettings are the chunk settings of a link with the maximal user-payload size of a link and a
+    /// ChunkChainHeader as user-header
+    /// @param[in] chunkMagazine which caches the reserved chunks of the caller
+    /// @return a SharedChunk of the first link which owns the remaining links if successful, otherwise a
+    /// MemoryManager::Error
+    expected<SharedChunk, Error> getChunkChain(const uint64_t chainPayloadSize,
+                                               const ChunkSettings& linkSettings,
+                                               ChunkMagazine& chunkMagazine) noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
@@ -80,15 +102,39 @@ class MemoryManager
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
 
+    /// @brief Every power of two range of chunk sizes is split into this number of linear size classes
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASS_SUB_BUCKETS_LOG2{3U};
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASS_SUB_BUCKETS{1U << NUMBER_OF_SIZE_CLASS_SUB_BUCKETS_LOG2};
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{
+        (std::numeric_limits<uint32_t>::digits - NUMBER_OF_SIZE_CLASS_SUB_BUCKETS_LOG2 + 1U)
+        * NUMBER_OF_SIZE_CLASS_SUB_BUCKETS};
+
+    /// @brief Maps a chunk size to its size class. The size classes are ordered like the chunk sizes and cover a
+    /// relative chunk size range of at most 1/NUMBER_OF_SIZE_CLASS_SUB_BUCKETS
+    /// @param[in] chunkSize is the chunk size to map
+    /// @return the index of the size class the chunk size belongs to
+    static constexpr uint32_t sizeClassIndex(const uint32_t chunkSize) noexcept;
+
+    /// @brief Returns the smallest chunk size which belongs to a size class
+    /// @param[in] sizeClassIndex is the index of the size class, must be less than NUMBER_OF_SIZE_CLASSES
+    /// @return the smallest chunk size of the size class
+    static constexpr uint32_t sizeClassLowerBound(const uint32_t sizeClassIndex) noexcept;
+
   private:
     static uint32_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
 
+    static constexpr uint32_t indexOfMostSignificantBit(const uint32_t value) noexcept;
+
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(BumpAllocator& managementAllocator,
                     BumpAllocator& chunkMemoryAllocator,
                     const greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
+    void generateSizeClassTable() noexcept;
+    uint32_t findMemPoolIndex(const uint32_t requiredChunkSize) const noexcept;
+    expected<SharedChunk, Error> acquireChunk(const ChunkSettings& chunkSettings,
+                                              ChunkMagazine* const chunkMagazine) noexcept;
 
   private:
     bool m_denyAddMemPool{false};
@@ -96,6 +142,10 @@ class MemoryManager
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     vector<MemPool, 1> m_chunkManagementPool;
+
+    /// @brief index of the first mempool whose chunk size is not smaller than the lower bound of the size class; the
+    /// mempool index equals the number of mempools if there is no such mempool
+    uint32_t m_sizeClassToMemPoolIndex[NUMBER_OF_SIZE_CLASSES]{};
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
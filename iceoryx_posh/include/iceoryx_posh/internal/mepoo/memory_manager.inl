@@ -21,6 +21,46 @@ namespace iox
 {
 namespace mepoo
 {
+inline constexpr uint32_t MemoryManager::indexOfMostSignificantBit(const uint32_t value) noexcept
+{
+    // value must not be 0
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(std::numeric_limits<uint32_t>::digits - 1 - __builtin_clz(value));
+#else
+    uint32_t index{0U};
+    for (uint32_t shiftedValue = value >> 1U; shiftedValue != 0U; shiftedValue >>= 1U)
+    {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+inline constexpr uint32_t MemoryManager::sizeClassIndex(const uint32_t chunkSize) noexcept
+{
+    // the chunk sizes below NUMBER_OF_SIZE_CLASS_SUB_BUCKETS map directly to a size class; every power of two range
+    // above is split into NUMBER_OF_SIZE_CLASS_SUB_BUCKETS size classes by the bits following the most significant bit
+    if (chunkSize < NUMBER_OF_SIZE_CLASS_SUB_BUCKETS)
+    {
+        return chunkSize;
+    }
+
+    const uint32_t shift = indexOfMostSignificantBit(chunkSize) - NUMBER_OF_SIZE_CLASS_SUB_BUCKETS_LOG2;
+    return ((shift + 1U) << NUMBER_OF_SIZE_CLASS_SUB_BUCKETS_LOG2)
+           + ((chunkSize >> shift) & (NUMBER_OF_SIZE_CLASS_SUB_BUCKETS - 1U));
+}
+
+inline constexpr uint32_t MemoryManager::sizeClassLowerBound(const uint32_t sizeClassIndex) noexcept
+{
+    if (sizeClassIndex < NUMBER_OF_SIZE_CLASS_SUB_BUCKETS)
+    {
+        return sizeClassIndex;
+    }
+
+    const uint32_t shift = (sizeClassIndex >> NUMBER_OF_SIZE_CLASS_SUB_BUCKETS_LOG2) - 1U;
+    return (NUMBER_OF_SIZE_CLASS_SUB_BUCKETS + (sizeClassIndex & (NUMBER_OF_SIZE_CLASS_SUB_BUCKETS - 1U))) << shift;
+}
+
 inline constexpr const char* asStringLiteral(const MemoryManager::Error value) noexcept
 {
     switch (value)
@@ -20,9 +20,11 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/access_control.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/segment_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/filesystem.hpp"
 
@@ -38,18 +40,34 @@ class MePooSegment
                  BumpAllocator& managementAllocator,
                  const posix::PosixGroup& readerGroup,
                  const posix::PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const SegmentMemoryOptions& memoryOptions = SegmentMemoryOptions()) noexcept;
 
     posix::PosixGroup getWriterGroup() const noexcept;
     posix::PosixGroup getReaderGroup() const noexcept;
     const SharedMemoryObjectType& getSharedMemoryObject() const noexcept;
     MemoryManagerType& getMemoryManager() noexcept;
+    const iox::mepoo::MemoryInfo& getMemoryInfo() const noexcept;
+
+    /// @brief returns the name of the shared memory, this is the name of the writer group and for segments which are
+    /// bound to a NUMA node additionally the node
+    ShmName_t getSharedMemoryName() const noexcept;
 
     uint64_t getSegmentId() const noexcept;
 
   protected:
+    static ShmName_t sharedMemoryName(const posix::PosixGroup& writerGroup,
+                                      const iox::mepoo::MemoryInfo& memoryInfo) noexcept;
+
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
-                                                    const posix::PosixGroup& writerGroup) noexcept;
+                                                    const posix::PosixGroup& writerGroup,
+                                                    const iox::mepoo::MemoryInfo& memoryInfo,
+                                                    const SegmentMemoryOptions& memoryOptions) noexcept;
+
+    /// @brief binds the memory which is allocated while creating the shared memory to the NUMA node of the segment
+    /// @return true if the segment is bound to a NUMA node, the memory binding of the thread must then be reset after
+    /// the creation
+    static bool bindCreationToNumaNode(const iox::mepoo::MemoryInfo& memoryInfo) noexcept;
 
   protected:
     SharedMemoryObjectType m_sharedMemoryObject;
@@ -21,10 +21,14 @@
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/numa_topology.hpp"
+#include "iceoryx_posh/mepoo/segment_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/logging.hpp"
 #include "iox/relative_pointer.hpp"
 
+#include <string>
+
 namespace iox
 {
 namespace mepoo
@@ -38,8 +42,9 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
-    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const SegmentMemoryOptions& memoryOptions) noexcept
+    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup, memoryInfo, memoryOptions)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
@@ -65,17 +70,65 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, allocator);
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline ShmName_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::sharedMemoryName(
+    const posix::PosixGroup& writerGroup, const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+{
+    const auto numaNode = memoryInfo.getNumaNode();
+    if (numaNode == MemoryInfo::NO_NUMA_NODE)
+    {
+        return ShmName_t(TruncateToCapacity, writerGroup.getName().c_str());
+    }
+
+    // there can be one segment per NUMA node for the same writer group, the node makes the names unique
+    const std::string name = std::string(writerGroup.getName().c_str()) + "_numa" + std::to_string(numaNode);
+    return ShmName_t(TruncateToCapacity, name.c_str());
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::bindCreationToNumaNode(
+    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+{
+    const auto numaNode = memoryInfo.getNumaNode();
+    if (numaNode == MemoryInfo::NO_NUMA_NODE)
+    {
+        return false;
+    }
+
+    auto& numaTopology = NumaTopology::getInstance();
+    if (numaNode >= numaTopology.numberOfNodes())
+    {
+        IOX_LOG(ERROR) << "The segment shall be bound to the NUMA node " << numaNode << " but the system has only "
+                       << numaTopology.numberOfNodes() << " nodes";
+        errorHandler(PoshError::MEPOO__SEGMENT_NUMA_NODE_NOT_AVAILABLE, ErrorLevel::SEVERE);
+        return false;
+    }
+
+    // the memory which is written while the shared memory is created, i.e. by zeroing or prefaulting, is allocated on
+    // the node right away instead of being moved there afterwards
+    IOX_DISCARD_RESULT(numaTopology.bindThreadMemoryToNode(numaNode));
+    return true;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const posix::PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const posix::PosixGroup& writerGroup,
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const SegmentMemoryOptions& memoryOptions) noexcept
 {
-    return std::move(
+    const bool isBoundToNumaNode = bindCreationToNumaNode(memoryInfo);
+
+    auto sharedMemoryObject = std::move(
         typename SharedMemoryObjectType::Builder()
-            .name(writerGroup.getName())
+            .name(sharedMemoryName(writerGroup, memoryInfo))
             .memorySizeInBytes(MemoryManager::requiredChunkMemorySize(mempoolConfig))
             .accessMode(posix::AccessMode::READ_WRITE)
             .openMode(posix::OpenMode::PURGE_AND_CREATE)
             .permissions(SEGMENT_PERMISSIONS)
+            .hugePages(memoryOptions.hugePages)
+            .prefault(memoryOptions.prefault)
+            .lockInMemory(memoryOptions.lockInMemory)
             .create()
             .and_then([this](auto& sharedMemoryObject) {
                 auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
@@ -94,6 +147,27 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
             })
             .or_else([](auto&) { errorHandler(PoshError::MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT); })
             .value());
+
+    if (isBoundToNumaNode)
+    {
+        auto& numaTopology = NumaTopology::getInstance();
+        IOX_DISCARD_RESULT(numaTopology.resetThreadMemoryBinding());
+
+        // the policy of the shared memory ensures that pages which are allocated later on by any process are
+        // also located on the node
+        if (numaTopology
+                .bindMemoryToNode(sharedMemoryObject.getBaseAddress(),
+                                  sharedMemoryObject.get_size().expect("Failed to get SHM size."),
+                                  memoryInfo.getNumaNode())
+                .has_error())
+        {
+            IOX_LOG(WARN) << "The pages of the segment for the writer group '" << writerGroup.getName()
+                          << "' which are not yet allocated might not be located on the NUMA node "
+                          << memoryInfo.getNumaNode();
+        }
+    }
+
+    return sharedMemoryObject;
 }
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
@@ -114,6 +188,19 @@ inline MemoryManagerType& MePooSegment<SharedMemoryObjectType, MemoryManagerType
     return m_memoryManager;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const iox::mepoo::MemoryInfo&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getMemoryInfo() const noexcept
+{
+    return m_memoryInfo;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline ShmName_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryName() const noexcept
+{
+    return sharedMemoryName(m_writerGroup, m_memoryInfo);
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline const SharedMemoryObjectType&
 MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryObject() const noexcept
@@ -89,6 +89,14 @@ class SegmentManager
     SegmentMappingContainer getSegmentMappings(const posix::PosixUser& user) noexcept;
     SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept;
 
+    /// @brief returns the writable segment of the user with the given kind of memory, e.g. the segment which is bound
+    /// to a specific NUMA node
+    /// @param[in] user the user which needs write access to the segment
+    /// @param[in] memoryInfo the properties of the memory of the segment
+    /// @return the information of the segment, the memory manager is empty if there is no such segment
+    SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user,
+                                                                       const MemoryInfo& memoryInfo) noexcept;
+
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
@@ -96,6 +104,10 @@ class SegmentManager
   private:
     void createSegment(const SegmentConfig::SegmentEntry& segmentEntry) noexcept;
 
+    template <typename Predicate>
+    SegmentUserInformation findSegmentWithWriteAccessForUser(const posix::PosixUser& user,
+                                                             const Predicate& isRequestedSegment) noexcept;
+
   private:
     template <typename MemoryManger, typename SegmentManager, typename PublisherPort>
     friend class roudi::MemPoolIntrospection;
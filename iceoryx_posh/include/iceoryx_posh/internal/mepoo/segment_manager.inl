@@ -42,8 +42,12 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
 {
     auto readerGroup = iox::posix::PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = iox::posix::PosixGroup(segmentEntry.m_writerGroup);
-    m_segmentContainer.emplace_back(
-        segmentEntry.m_mempoolConfig, *m_managementAllocator, readerGroup, writerGroup, segmentEntry.m_memoryInfo);
+    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+                                    *m_managementAllocator,
+                                    readerGroup,
+                                    writerGroup,
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_memoryOptions);
 }
 
 template <typename SegmentType>
@@ -54,7 +58,6 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
     auto groupContainer = user.getGroups();
 
     SegmentManager::SegmentMappingContainer mappingContainer;
-    bool foundInWriterGroup = false;
 
     // with the groups we can get all the segments (read or write) for the user
     for (const auto& groupID : groupContainer)
@@ -63,17 +66,21 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
         {
             if (segment.getWriterGroup() == groupID)
             {
-                // a user is allowed to be only in one writer group, as we currently only support one memory manager per
-                // process
-                if (!foundInWriterGroup)
+                // a user is allowed to have only one writable segment per kind of memory, e.g. one per NUMA node, as
+                // the memory manager for a port is selected by the memory info
+                auto hasSameMemoryInfo = [&](const SegmentMapping& mapping) {
+                    return mapping.m_memoryInfo == segment.getMemoryInfo();
+                };
+                if (std::find_if(mappingContainer.begin(), mappingContainer.end(), hasSameMemoryInfo)
+                    == mappingContainer.end())
                 {
                     mappingContainer.emplace_back(
-                        segment.getWriterGroup().getName(),
+                        segment.getSharedMemoryName(),
                         segment.getSharedMemoryObject().getBaseAddress(),
                         segment.getSharedMemoryObject().get_size().expect("failed to get SHM size"),
                         true,
-                        segment.getSegmentId());
-                    foundInWriterGroup = true;
+                        segment.getSegmentId(),
+                        segment.getMemoryInfo());
                 }
                 else
                 {
@@ -95,11 +102,12 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                    }) == mappingContainer.end())
             {
                 mappingContainer.emplace_back(
-                    segment.getWriterGroup().getName(),
+                    segment.getSharedMemoryName(),
                     segment.getSharedMemoryObject().getBaseAddress(),
                     segment.getSharedMemoryObject().get_size().expect("Failed to get SHM size."),
                     false,
-                    segment.getSegmentId());
+                    segment.getSegmentId(),
+                    segment.getMemoryInfo());
             }
         }
     }
@@ -110,6 +118,24 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
 template <typename SegmentType>
 inline typename SegmentManager<SegmentType>::SegmentUserInformation
 SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept
+{
+    return findSegmentWithWriteAccessForUser(user, [](const SegmentType&) { return true; });
+}
+
+template <typename SegmentType>
+inline typename SegmentManager<SegmentType>::SegmentUserInformation
+SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user,
+                                                                         const MemoryInfo& memoryInfo) noexcept
+{
+    return findSegmentWithWriteAccessForUser(
+        user, [&](const SegmentType& segment) { return segment.getMemoryInfo() == memoryInfo; });
+}
+
+template <typename SegmentType>
+template <typename Predicate>
+inline typename SegmentManager<SegmentType>::SegmentUserInformation
+SegmentManager<SegmentType>::findSegmentWithWriteAccessForUser(const posix::PosixUser& user,
+                                                               const Predicate& isRequestedSegment) noexcept
 {
     auto groupContainer = user.getGroups();
 
@@ -120,7 +146,7 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const p
     {
         for (auto& segment : m_segmentContainer)
         {
-            if (segment.getWriterGroup() == groupID)
+            if (segment.getWriterGroup() == groupID && isRequestedSegment(segment))
             {
                 segmentInfo.m_memoryManager = segment.getMemoryManager();
                 segmentInfo.m_segmentID = segment.getSegmentId();
@@ -47,8 +47,18 @@ class SharedChunk
     ChunkHeader* getChunkHeader() const noexcept;
     void* getUserPayload() const noexcept;
 
+    /// @brief Returns the monotonic time in nanoseconds when the chunk was sent or 0 if the publisher does not stamp
+    /// the chunks with PublisherOptions::stampSendTime
+    uint64_t getSendTimestamp() const noexcept;
+    void setSendTimestamp(const uint64_t sendTimestamp) noexcept;
+
     ChunkManagement* release() noexcept;
 
+    /// @brief Makes a chunk the next link of this chunk in a chunk chain; the reference of the next link is
+    /// transferred to this chunk and released when this chunk is freed
+    /// @param[in] nextLink is the chunk which becomes the next link, must not be a nullptr
+    void setNextLink(SharedChunk&& nextLink) noexcept;
+
     bool operator==(const SharedChunk& rhs) const noexcept;
     /// @todo iox-#1617 use the newtype pattern to avoid the void pointer
     bool operator==(const void* const rhs) const noexcept;
@@ -20,9 +20,11 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
 #include <thread>
 
@@ -48,6 +50,10 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
+/// The lock serializes the modifications of the stored queues and the history. The delivery to all stored queues
+/// does not take the lock for the queue container but reads a snapshot of it which is published by every
+/// modification (read-copy-update). Removing a queue returns only after every delivery which could still see the
+/// removed queue has finished, i.e. the queue can be destroyed afterwards.
 /// @todo iox-#1713 There are currently some challenges:
 /// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
 /// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
@@ -97,13 +103,24 @@ class ChunkDistributor
     bool hasStoredQueues() const noexcept;
 
     /// @brief Deliver the provided shared chunk to all the stored chunk queues. The chunk will be added to the chunk
-    /// history
+    /// history. With ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER it waits for space in full queues with
+    /// QueueFullPolicy::BLOCK_PRODUCER until the consumer took a chunk out of the queue or the consumer too slow
+    /// timeout has passed. On timeout the chunk is dropped for the blocking queue and the queue is reported in the log.
     /// @param[in] chunk is the SharedChunk to be delivered
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks in the given order to all the stored chunk queues. In contrast to
+    /// calling deliverToAllStoredQueues for every chunk, the queue snapshot is entered once, all chunks are pushed to
+    /// one queue after the other and an attached condition variable is notified once per queue. The chunks will be
+    /// added to the chunk history. Waiting for full queues behaves like in deliverToAllStoredQueues with a single
+    /// consumer too slow timeout for the whole batch; on timeout the remaining chunks are dropped for the queue.
+    /// @param[in] chunks are the SharedChunks to be delivered
+    /// @return the number of queues the chunks were delivered to
+    uint64_t deliverBatchToAllStoredQueues(const span<const mepoo::SharedChunk> chunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
-    /// to the chunk history
+    /// to the chunk history. Waiting for a full queue behaves like in deliverToAllStoredQueues
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
     /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId
     /// @param[in] chunk is the SharedChunk to be delivered
@@ -143,6 +160,45 @@ class ChunkDistributor
 
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Waits for space in a full queue and pushes the chunk afterwards
+    /// @param[in] queue is the queue from the entered queue snapshot to wait for
+    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @param[in] snapshotIndex is the index of the entered queue snapshot
+    /// @param[in] blockingTimer limits the waiting time
+    /// @return true if the chunk was pushed, false if the chunk could not be pushed and the delivery shall be retried
+    bool waitForSpaceAndPushToQueue(not_null<ChunkQueueData_t* const> queue,
+                                    mepoo::SharedChunk chunk,
+                                    const uint64_t snapshotIndex,
+                                    const deadline_timer& blockingTimer) noexcept;
+
+    /// @brief Reports a delivery which timed out due to a too slow consumer and marks the chunk as lost for the queue
+    /// @param[in] queue is the queue of the too slow consumer
+    void dropChunkForTooSlowConsumer(not_null<ChunkQueueData_t* const> queue) noexcept;
+
+    static optional<uint32_t> findQueueIndex(const typename MemberType_t::QueueContainer_t& queues,
+                                             const UniqueId uniqueQueueId,
+                                             const uint32_t lastKnownQueueIndex) noexcept;
+
+    /// @brief Publishes the current state of the stored queues to the lock-free readers. Must be called with the
+    /// lock held after every modification of the stored queues
+    void publishQueueSnapshot() noexcept;
+
+    /// @brief Enters the currently active queue snapshot; it is not modified until releaseQueueSnapshot is called
+    /// @return the index of the entered queue snapshot
+    uint64_t acquireQueueSnapshot() noexcept;
+
+    /// @brief Leaves a queue snapshot which was entered with acquireQueueSnapshot
+    /// @param[in] snapshotIndex is the index returned by acquireQueueSnapshot
+    void releaseQueueSnapshot(const uint64_t snapshotIndex) noexcept;
+
+    /// @brief Waits until all readers have left the queue snapshot with the provided index
+    /// @param[in] snapshotIndex is the index of the queue snapshot
+    void waitForQueueSnapshotReaders(const uint64_t snapshotIndex) const noexcept;
+
+  private:
+    /// @brief Adds the chunk to the chunk history. Must be called with the lock held
+    void storeInHistory(mepoo::SharedChunk chunk) noexcept;
+
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
@@ -82,6 +82,10 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
                 pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
             }
 
+            // the queue becomes visible for the delivery only after the history was pushed; this ensures that the
+            // queue has just one producer at a time
+            publishQueueSnapshot();
+
             return success<void>();
         }
         else
@@ -110,6 +114,7 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
     {
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
         getMembers()->m_queues.erase(iter);
+        publishQueueSnapshot();
 
         return success<void>();
     }
@@ -125,6 +130,7 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
     getMembers()->m_queues.clear();
+    publishQueueSnapshot();
 }
 
 template <typename ChunkDistributorDataType>
@@ -141,11 +147,11 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
     typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        const auto snapshotIndex = acquireQueueSnapshot();
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
         // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+        for (auto& queue : getMembers()->m_queueSnapshots[snapshotIndex])
         {
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
@@ -166,49 +172,57 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
                 }
             }
         }
+
+        releaseQueueSnapshot(snapshotIndex);
     }
 
-    // busy waiting until every queue is served
-    iox::detail::adaptive_wait adaptiveWait;
+    // wait until every blocking queue is served or the timeout has passed
+    deadline_timer blockingTimer(getMembers()->m_consumerTooSlowTimeout);
     while (!remainingQueues.empty())
     {
-        adaptiveWait.wait();
+        const auto snapshotIndex = acquireQueueSnapshot();
+        const auto& queues = getMembers()->m_queueSnapshots[snapshotIndex];
+
+        // deliver to remaining queues
+        for (uint64_t i = remainingQueues.size(); i > 0U; --i)
         {
-            // create intersection of current queues and remainingQueues
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            typename ChunkDistributorDataType::QueueContainer_t queueIntersection(remainingQueues.size());
-            auto greaterThan = [](RelativePointer<ChunkQueueData_t>& a, RelativePointer<ChunkQueueData_t>& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-            std::sort(remainingQueues.begin(), remainingQueues.end(), greaterThan);
-
-            auto iter = std::set_intersection(getMembers()->m_queues.begin(),
-                                              getMembers()->m_queues.end(),
-                                              remainingQueues.begin(),
-                                              remainingQueues.end(),
-                                              queueIntersection.begin(),
-                                              greaterThan);
-            queueIntersection.resize(static_cast<uint64_t>(iter - queueIntersection.begin()));
-            remainingQueues = queueIntersection;
-
-            // deliver to remaining queues
-            for (uint64_t i = remainingQueues.size() - 1U; !remainingQueues.empty(); --i)
+            auto remainingQueue = remainingQueues.begin() + (i - 1U);
+
+            // it is possible that since the last iteration some subscriber have already unsubscribed
+            // and without this check we would deliver to dead queues
+            const bool isQueueStillStored =
+                std::find_if(queues.begin(), queues.end(), [&](const RelativePointer<ChunkQueueData_t>& queue) {
+                    return queue.get() == remainingQueue->get();
+                }) != queues.end();
+
+            if (!isQueueStillStored)
             {
-                if (pushToQueue(remainingQueues[i].get(), chunk))
-                {
-                    remainingQueues.erase(remainingQueues.begin() + i);
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                }
+                remainingQueues.erase(remainingQueue);
+            }
+            else if (pushToQueue(remainingQueue->get(), chunk))
+            {
+                remainingQueues.erase(remainingQueue);
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+            }
+        }
 
-                // don't move this up since the for loop counts downwards and the algorithm would break
-                if (i == 0U)
-                {
-                    break;
-                }
+        // all remaining queues must be served, therefore it does not matter on which one we wait first
+        if (!remainingQueues.empty()
+            && waitForSpaceAndPushToQueue(remainingQueues.front().get(), chunk, snapshotIndex, blockingTimer))
+        {
+            remainingQueues.erase(remainingQueues.begin());
+            ++numberOfQueuesTheChunkWasDeliveredTo;
+        }
+
+        releaseQueueSnapshot(snapshotIndex);
+
+        if (!remainingQueues.empty() && blockingTimer.hasExpired())
+        {
+            for (auto& queue : remainingQueues)
+            {
+                dropChunkForTooSlowConsumer(queue.get());
             }
+            break;
         }
     }
 
@@ -217,6 +231,115 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverBatchToAllStoredQueues(
+    const span<const mepoo::SharedChunk> chunks) noexcept
+{
+    uint64_t numberOfQueuesTheChunksWereDeliveredTo{0U};
+    if (chunks.empty())
+    {
+        return numberOfQueuesTheChunksWereDeliveredTo;
+    }
+
+    typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
+    // the index of the next chunk which has to be delivered to the remaining queue with the same position
+    vector<uint64_t, ChunkDistributorDataType::ChunkDistributorDataProperties_t::MAX_QUEUES> nextChunkIndices;
+    {
+        const auto snapshotIndex = acquireQueueSnapshot();
+
+        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+        for (auto& queue : getMembers()->m_queueSnapshots[snapshotIndex])
+        {
+            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+            // chunks which cause an overflow of a non-blocking queue are reported as lost by the pusher
+            const auto numberOfPushedChunks = ChunkQueuePusher_t(queue.get()).push(chunks, isBlockingQueue);
+            if (numberOfPushedChunks < chunks.size())
+            {
+                remainingQueues.emplace_back(queue);
+                nextChunkIndices.emplace_back(numberOfPushedChunks);
+            }
+            else
+            {
+                ++numberOfQueuesTheChunksWereDeliveredTo;
+            }
+        }
+
+        releaseQueueSnapshot(snapshotIndex);
+    }
+
+    // wait until every blocking queue got all chunks or the timeout has passed
+    deadline_timer blockingTimer(getMembers()->m_consumerTooSlowTimeout);
+    while (!remainingQueues.empty())
+    {
+        const auto snapshotIndex = acquireQueueSnapshot();
+        const auto& queues = getMembers()->m_queueSnapshots[snapshotIndex];
+
+        for (uint64_t i = remainingQueues.size(); i > 0U; --i)
+        {
+            auto remainingQueue = remainingQueues.begin() + (i - 1U);
+            auto nextChunkIndex = nextChunkIndices.begin() + (i - 1U);
+
+            // queues which were removed in the meantime must not be served anymore
+            const bool isQueueStillStored =
+                std::find_if(queues.begin(), queues.end(), [&](const RelativePointer<ChunkQueueData_t>& queue) {
+                    return queue.get() == remainingQueue->get();
+                }) != queues.end();
+
+            if (isQueueStillStored)
+            {
+                *nextChunkIndex +=
+                    ChunkQueuePusher_t(remainingQueue->get()).push(chunks.subspan(*nextChunkIndex), true);
+                if (*nextChunkIndex == chunks.size())
+                {
+                    ++numberOfQueuesTheChunksWereDeliveredTo;
+                }
+            }
+
+            if (!isQueueStillStored || *nextChunkIndex == chunks.size())
+            {
+                remainingQueues.erase(remainingQueue);
+                nextChunkIndices.erase(nextChunkIndex);
+            }
+        }
+
+        // the chunks after the one which was pushed after waiting are delivered in the next iteration
+        if (!remainingQueues.empty()
+            && waitForSpaceAndPushToQueue(
+                remainingQueues.front().get(), chunks[nextChunkIndices.front()], snapshotIndex, blockingTimer))
+        {
+            ++nextChunkIndices.front();
+            if (nextChunkIndices.front() == chunks.size())
+            {
+                remainingQueues.erase(remainingQueues.begin());
+                nextChunkIndices.erase(nextChunkIndices.begin());
+                ++numberOfQueuesTheChunksWereDeliveredTo;
+            }
+        }
+
+        releaseQueueSnapshot(snapshotIndex);
+
+        if (!remainingQueues.empty() && blockingTimer.hasExpired())
+        {
+            for (auto& queue : remainingQueues)
+            {
+                dropChunkForTooSlowConsumer(queue.get());
+            }
+            break;
+        }
+    }
+
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        for (const auto& chunk : chunks)
+        {
+            storeInHistory(chunk);
+        }
+    }
+
+    return numberOfQueuesTheChunksWereDeliveredTo;
+}
+
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<ChunkQueueData_t* const> queue,
                                                                     mepoo::SharedChunk chunk) noexcept
@@ -224,43 +347,157 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<Chu
     return ChunkQueuePusher_t(queue).push(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::waitForSpaceAndPushToQueue(
+    not_null<ChunkQueueData_t* const> queue,
+    mepoo::SharedChunk chunk,
+    const uint64_t snapshotIndex,
+    const deadline_timer& blockingTimer) noexcept
+{
+    if (blockingTimer.hasExpired())
+    {
+        return false;
+    }
+
+    ChunkQueuePusher_t pusher(queue);
+    pusher.startWaitingForSpace();
+
+    bool wasPushed = pushToQueue(queue, chunk);
+    // the snapshot stays entered while waiting, this keeps the queue alive; when the queue is removed in the meantime,
+    // the waiting producers are woken up after the switch of the snapshot
+    if (!wasPushed && getMembers()->m_activeQueueSnapshot.load(std::memory_order_seq_cst) == snapshotIndex)
+    {
+        const auto timeout = getMembers()->m_consumerTooSlowTimeout;
+        pusher.waitForSpace((timeout == units::Duration::max()) ? timeout : blockingTimer.remainingTime());
+        wasPushed = pushToQueue(queue, chunk);
+    }
+
+    pusher.stopWaitingForSpace();
+    return wasPushed;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::dropChunkForTooSlowConsumer(
+    not_null<ChunkQueueData_t* const> queue) noexcept
+{
+    const ChunkQueueData_t* const queueData = queue;
+    IOX_LOG(WARN) << "The delivery to the queue with id " << static_cast<UniqueId::value_type>(queueData->m_uniqueId)
+                  << " timed out after " << getMembers()->m_consumerTooSlowTimeout
+                  << " since the consumer is too slow! Dropping the chunk for this queue.";
+    ChunkQueuePusher_t(queue).lostAChunk();
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::publishQueueSnapshot() noexcept
+{
+    // only called with the lock held, therefore there is no concurrent writer of m_activeQueueSnapshot
+    const auto activeIndex = getMembers()->m_activeQueueSnapshot.load(std::memory_order_relaxed);
+    const auto nextIndex = (activeIndex + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+
+    // a reader which raced with the previous publication might have entered the unused snapshot for a moment
+    waitForQueueSnapshotReaders(nextIndex);
+    getMembers()->m_queueSnapshots[nextIndex] = getMembers()->m_queues;
+    getMembers()->m_activeQueueSnapshot.store(nextIndex, std::memory_order_seq_cst);
+
+    // producers which are waiting for space in a removed queue would delay the grace period
+    const auto& newQueues = getMembers()->m_queueSnapshots[nextIndex];
+    for (auto& queue : getMembers()->m_queueSnapshots[activeIndex])
+    {
+        if (std::find_if(newQueues.begin(), newQueues.end(), [&](const RelativePointer<ChunkQueueData_t>& newQueue) {
+                return newQueue.get() == queue.get();
+            })
+            == newQueues.end())
+        {
+            ChunkQueuePusher_t(queue.get()).wakeUpWaitingProducers();
+        }
+    }
+
+    // grace period; afterwards no reader can access a queue which is not in the new snapshot
+    waitForQueueSnapshotReaders(activeIndex);
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::acquireQueueSnapshot() noexcept
+{
+    while (true)
+    {
+        const auto snapshotIndex = getMembers()->m_activeQueueSnapshot.load(std::memory_order_acquire);
+        getMembers()->m_queueSnapshotReaders[snapshotIndex].fetch_add(1U, std::memory_order_seq_cst);
+
+        // if the snapshot was switched in the meantime, the writer might already have finished the grace period for
+        // the entered snapshot and could overwrite it
+        if (getMembers()->m_activeQueueSnapshot.load(std::memory_order_seq_cst) == snapshotIndex)
+        {
+            return snapshotIndex;
+        }
+
+        getMembers()->m_queueSnapshotReaders[snapshotIndex].fetch_sub(1U, std::memory_order_release);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseQueueSnapshot(const uint64_t snapshotIndex) noexcept
+{
+    getMembers()->m_queueSnapshotReaders[snapshotIndex].fetch_sub(1U, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::waitForQueueSnapshotReaders(const uint64_t snapshotIndex) const noexcept
+{
+    iox::detail::adaptive_wait adaptiveWait;
+    while (getMembers()->m_queueSnapshotReaders[snapshotIndex].load(std::memory_order_seq_cst) != 0U)
+    {
+        adaptiveWait.wait();
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline expected<ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId uniqueQueueId,
                                                            const uint32_t lastKnownQueueIndex,
                                                            mepoo::SharedChunk chunk IOX_MAYBE_UNUSED) noexcept
 {
-    bool retry{false};
+    deadline_timer blockingTimer(getMembers()->m_consumerTooSlowTimeout);
+    bool isDeliveryFinished{false};
     do
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        const auto snapshotIndex = acquireQueueSnapshot();
+        const auto& queues = getMembers()->m_queueSnapshots[snapshotIndex];
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+        auto queueIndex = findQueueIndex(queues, uniqueQueueId, lastKnownQueueIndex);
 
         if (!queueIndex.has_value())
         {
+            releaseQueueSnapshot(snapshotIndex);
             return error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
         }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+        auto& queue = queues[queueIndex.value()];
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
 
         bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-        retry = false;
-        if (!pushToQueue(queue.get(), chunk))
+        isDeliveryFinished = pushToQueue(queue.get(), chunk)
+                             || (isBlockingQueue
+                                 && waitForSpaceAndPushToQueue(queue.get(), chunk, snapshotIndex, blockingTimer));
+        if (!isDeliveryFinished)
         {
-            if (isBlockingQueue)
+            if (!isBlockingQueue)
             {
-                retry = true;
+                ChunkQueuePusher_t(queue.get()).lostAChunk();
+                isDeliveryFinished = true;
             }
-            else
+            else if (blockingTimer.hasExpired())
             {
-                ChunkQueuePusher_t(queue.get()).lostAChunk();
+                dropChunkForTooSlowConsumer(queue.get());
+                isDeliveryFinished = true;
             }
         }
-    } while (retry);
+
+        releaseQueueSnapshot(snapshotIndex);
+    } while (!isDeliveryFinished);
 
     return success<>();
 }
@@ -272,8 +509,15 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    auto& queues = getMembers()->m_queues;
+    return findQueueIndex(getMembers()->m_queues, uniqueQueueId, lastKnownQueueIndex);
+}
 
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndex(const typename MemberType_t::QueueContainer_t& queues,
+                                                           const UniqueId uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex) noexcept
+{
     if (queues.size() > lastKnownQueueIndex && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
     {
         return lastKnownQueueIndex;
@@ -296,6 +540,12 @@ inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDeliv
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    storeInHistory(chunk);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::storeInHistory(mepoo::SharedChunk chunk) noexcept
+{
     if (0u < getMembers()->m_historyCapacity)
     {
         if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
@@ -343,6 +593,13 @@ inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
     if (getMembers()->tryLock())
     {
+        // the readers of the queue snapshots are the threads of the owning process which do not deliver chunks
+        // anymore when the cleanup is done; a reader which was terminated while delivering would otherwise block
+        // the removal of queues forever
+        for (auto& readers : getMembers()->m_queueSnapshotReaders)
+        {
+            readers.store(0U, std::memory_order_relaxed);
+        }
         clearHistory();
         getMembers()->unlock();
     }
@@ -23,10 +23,12 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/duration.hpp"
 #include "iox/logging.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iox/vector.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -43,13 +45,24 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
-    ChunkDistributorData(const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+    ChunkDistributorData(const ConsumerTooSlowPolicy policy,
+                         const uint64_t historyCapacity = 0u,
+                         const units::Duration consumerTooSlowTimeout = units::Duration::max()) noexcept;
 
     const uint64_t m_historyCapacity;
 
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
     QueueContainer_t m_queues;
 
+    /// @brief Read-copy-update snapshots of m_queues which are used by the publish path without taking the lock.
+    /// Modifications of m_queues are done under the lock and published by copying m_queues into the currently
+    /// unused snapshot and switching m_activeQueueSnapshot to it. The previous snapshot is reused only after all of
+    /// its readers, which are counted in m_queueSnapshotReaders, have left it.
+    static constexpr uint64_t NUMBER_OF_QUEUE_SNAPSHOTS{2U};
+    QueueContainer_t m_queueSnapshots[NUMBER_OF_QUEUE_SNAPSHOTS];
+    std::atomic<uint64_t> m_activeQueueSnapshot{0U};
+    std::atomic<uint64_t> m_queueSnapshotReaders[NUMBER_OF_QUEUE_SNAPSHOTS];
+
     /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
     /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
@@ -58,6 +71,8 @@ struct ChunkDistributorData : public LockingPolicy
         vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+    /// @brief With ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER the maximum time a delivery waits for a full queue
+    const units::Duration m_consumerTooSlowTimeout;
 };
 
 } // namespace popo
@@ -33,13 +33,25 @@ constexpr T min(const T left, const T right) noexcept
 }
 } // namespace internal
 
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+constexpr uint64_t ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::
+    NUMBER_OF_QUEUE_SNAPSHOTS;
+
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::ChunkDistributorData(
-    const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
+    const ConsumerTooSlowPolicy policy,
+    const uint64_t historyCapacity,
+    const units::Duration consumerTooSlowTimeout) noexcept
     : LockingPolicy()
     , m_historyCapacity(internal::min(historyCapacity, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY))
     , m_consumerTooSlowPolicy(policy)
+    , m_consumerTooSlowTimeout(consumerTooSlowTimeout)
 {
+    for (auto& readers : m_queueSnapshotReaders)
+    {
+        readers.store(0U, std::memory_order_relaxed);
+    }
+
     if (m_historyCapacity != historyCapacity)
     {
         IOX_LOG(WARN) << "Chunk history too large, reducing from " << historyCapacity << " to " << m_historyCapacity;
@@ -18,6 +18,8 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
+#include "iceoryx_hoofs/internal/concurrent/spsc_ring.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
@@ -25,12 +27,33 @@
 #include "iox/detail/unique_id.hpp"
 #include "iox/relative_pointer.hpp"
 
+#include <atomic>
 #include <mutex>
 
 namespace iox
 {
 namespace popo
 {
+/// @brief Selects the queue of a ChunkQueueData at compile time. Queues with multiple producers use the VariantQueue
+/// whose underlying queue is chosen at runtime.
+template <typename ValueType, uint64_t Capacity, bool HasSingleProducer>
+struct ChunkQueueSelector
+{
+    using Queue_t = cxx::VariantQueue<ValueType, Capacity>;
+
+    static cxx::VariantQueueTypes constructorArgument(const cxx::VariantQueueTypes queueType) noexcept;
+};
+
+/// @brief Queues with a single producer use the SpscRing, i.e. push and pop need no dispatch over the queue types
+template <typename ValueType, uint64_t Capacity>
+struct ChunkQueueSelector<ValueType, Capacity, true>
+{
+    using Queue_t = concurrent::SpscRing<ValueType, Capacity>;
+
+    /// @brief the SoFi types discard the oldest value on an overflow and the FiFo types reject the pushed value
+    static concurrent::SpscRingFullPolicy constructorArgument(const cxx::VariantQueueTypes queueType) noexcept;
+};
+
 template <typename ChunkQueueDataProperties, typename LockingPolicy>
 struct ChunkQueueData : public LockingPolicy
 {
@@ -43,12 +66,25 @@ struct ChunkQueueData : public LockingPolicy
     UniqueId m_uniqueId{};
 
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
-    cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
+    using ChunkQueueSelector_t = ChunkQueueSelector<mepoo::ShmSafeUnmanagedChunk,
+                                                    MAX_CAPACITY,
+                                                    ChunkQueueDataProperties_t::HAS_SINGLE_PRODUCER>;
+    using Queue_t = typename ChunkQueueSelector_t::Queue_t;
+    Queue_t m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
 
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
+    /// @brief Mirrors whether m_conditionVariableDataPtr is set. A pusher checks it without taking the lock, i.e. a
+    /// queue without an attached condition variable is pushed to without acquiring the inter-process mutex.
+    std::atomic_bool m_isConditionVariableSet{false};
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief Producers which wait for space in a full queue are parked on this semaphore. It only exists with
+    /// QueueFullPolicy::BLOCK_PRODUCER and is only posted when m_numberOfWaitingProducers is not zero, i.e. a consumer
+    /// which is not blocking any producer does not pay for a syscall.
+    optional<posix::UnnamedSemaphore> m_spaceAvailableSemaphore;
+    std::atomic<uint64_t> m_numberOfWaitingProducers{0U};
 };
 
 } // namespace popo
@@ -21,12 +21,39 @@ namespace iox
 {
 namespace popo
 {
+template <typename ValueType, uint64_t Capacity, bool HasSingleProducer>
+inline cxx::VariantQueueTypes ChunkQueueSelector<ValueType, Capacity, HasSingleProducer>::constructorArgument(
+    const cxx::VariantQueueTypes queueType) noexcept
+{
+    return queueType;
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline concurrent::SpscRingFullPolicy
+ChunkQueueSelector<ValueType, Capacity, true>::constructorArgument(const cxx::VariantQueueTypes queueType) noexcept
+{
+    return (queueType == cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer
+            || queueType == cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer)
+               ? concurrent::SpscRingFullPolicy::DISCARD_OLDEST_VALUE
+               : concurrent::SpscRingFullPolicy::REJECT_NEWEST_VALUE;
+}
+
 template <typename ChunkQueueProperties, typename LockingPolicy>
 inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(
     const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept
-    : m_queue(queueType)
+    : m_queue(ChunkQueueSelector_t::constructorArgument(queueType))
     , m_queueFullPolicy(policy)
 {
+    if (m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER)
+    {
+        posix::UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(true)
+            .create(m_spaceAvailableSemaphore)
+            .or_else([](auto) {
+                errorHandler(PoshError::POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
+            });
+    }
 }
 
 } // namespace popo
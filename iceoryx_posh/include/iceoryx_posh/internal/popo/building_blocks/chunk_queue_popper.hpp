@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -46,10 +47,18 @@ class ChunkQueuePopper
     ChunkQueuePopper& operator=(ChunkQueuePopper&& rhs) noexcept = default;
     virtual ~ChunkQueuePopper() noexcept = default;
 
-    /// @brief pop a chunk from the chunk queue
+    /// @brief pop a chunk from the chunk queue; producers which are waiting for space in the queue are woken up
     /// @return optional for a shared chunk that is set if the queue is not empty
     optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief pop all chunks from the chunk queue with a single wake up of the producers which are waiting for space in
+    /// the queue
+    /// @param[out] chunks is the container the popped chunks are appended to; the chunks remaining in the queue when
+    /// the container is full can be taken with another call
+    /// @return the number of chunks which were appended to the container
+    template <uint64_t Capacity>
+    uint64_t takeAll(vector<mepoo::SharedChunk, Capacity>& chunks) noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
@@ -96,6 +105,10 @@ class ChunkQueuePopper
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+  private:
+    void wakeUpWaitingProducers() noexcept;
+    static bool hasCompatibleChunkHeaderVersion(const mepoo::SharedChunk& chunk) noexcept;
+
   private:
     MemberType_t* m_chunkQueueDataPtr;
 };
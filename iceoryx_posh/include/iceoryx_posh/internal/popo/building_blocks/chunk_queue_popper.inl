@@ -52,15 +52,12 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        wakeUpWaitingProducers();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
-        auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
-        if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+        if (!hasCompatibleChunkHeaderVersion(chunk))
         {
-            IOX_LOG(ERROR) << "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion
-                           << "' but expected '" << mepoo::ChunkHeader::CHUNK_HEADER_VERSION << "'! Dropping chunk!";
-            errorHandler(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
-                         ErrorLevel::SEVERE);
             return nullopt_t();
         }
         return make_optional<mepoo::SharedChunk>(chunk);
@@ -71,6 +68,54 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     }
 }
 
+template <typename ChunkQueueDataType>
+template <uint64_t Capacity>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::takeAll(vector<mepoo::SharedChunk, Capacity>& chunks) noexcept
+{
+    uint64_t numberOfTakenChunks{0U};
+    uint64_t numberOfPoppedChunks{0U};
+    while (chunks.size() < chunks.capacity())
+    {
+        auto retVal = getMembers()->m_queue.pop();
+        if (!retVal.has_value())
+        {
+            break;
+        }
+        ++numberOfPoppedChunks;
+
+        auto chunk = retVal.value().releaseToSharedChunk();
+        if (hasCompatibleChunkHeaderVersion(chunk))
+        {
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we checked the capacity, so pushing will be fine
+            chunks.emplace_back(chunk);
+            ++numberOfTakenChunks;
+        }
+    }
+
+    if (numberOfPoppedChunks > 0U)
+    {
+        wakeUpWaitingProducers();
+    }
+
+    return numberOfTakenChunks;
+}
+
+template <typename ChunkQueueDataType>
+inline bool
+ChunkQueuePopper<ChunkQueueDataType>::hasCompatibleChunkHeaderVersion(const mepoo::SharedChunk& chunk) noexcept
+{
+    auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
+    if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        IOX_LOG(ERROR) << "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion
+                       << "' but expected '" << mepoo::ChunkHeader::CHUNK_HEADER_VERSION << "'! Dropping chunk!";
+        errorHandler(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
+                     ErrorLevel::SEVERE);
+        return false;
+    }
+    return true;
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
@@ -121,6 +166,7 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
     }
+    wakeUpWaitingProducers();
 }
 
 template <typename ChunkQueueDataType>
@@ -131,6 +177,10 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::setConditionVariable(Condition
 
     getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
     getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+    getMembers()->m_isConditionVariableSet.store(true, std::memory_order_relaxed);
+    // pairs with the fence in ChunkQueuePusher::notify, chunks which are pushed without a notification are visible
+    // to the subsequent checks of the queue state
+    std::atomic_thread_fence(std::memory_order_seq_cst);
 }
 
 template <typename ChunkQueueDataType>
@@ -138,6 +188,7 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::unsetConditionVariable() noexc
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    getMembers()->m_isConditionVariableSet.store(false, std::memory_order_relaxed);
     getMembers()->m_conditionVariableDataPtr = nullptr;
     getMembers()->m_conditionVariableNotificationIndex.reset();
 }
@@ -145,7 +196,29 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::unsetConditionVariable() noexc
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const noexcept
 {
-    return getMembers()->m_conditionVariableDataPtr.operator bool();
+    return getMembers()->m_isConditionVariableSet.load(std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::wakeUpWaitingProducers() noexcept
+{
+    auto& semaphore = getMembers()->m_spaceAvailableSemaphore;
+    if (!semaphore.has_value())
+    {
+        return;
+    }
+
+    // pairs with ChunkQueuePusher::startWaitingForSpace; either the producer sees the space freed by the pop or this
+    // load sees the producer which is going to wait
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto numberOfWaitingProducers = getMembers()->m_numberOfWaitingProducers.load(std::memory_order_relaxed);
+    for (uint64_t i = 0U; i < numberOfWaitingProducers; ++i)
+    {
+        if (semaphore->post().has_error())
+        {
+            errorHandler(PoshError::POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED_IN_WAKE_UP, ErrorLevel::FATAL);
+        }
+    }
 }
 
 } // namespace popo
@@ -20,8 +20,10 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -50,13 +52,43 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push multiple chunks to the chunk queue and notify an attached condition variable only once
+    /// @param[in] chunks to push in the given order
+    /// @param[in] stopAtOverflow if true, the push stops at the first chunk which causes a queue overflow, e.g. to wait
+    /// for space and retry this chunk; if false, the overflows are reported with lostAChunk and all chunks are pushed
+    /// @return the number of processed chunks; if it is smaller than the number of chunks, it is the index of the chunk
+    /// which caused the overflow
+    uint64_t push(const span<const mepoo::SharedChunk> chunks, const bool stopAtOverflow) noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
+    /// @brief Announces that the caller is about to wait for space in the full queue. Must be called before the last
+    /// push attempt in front of waitForSpace, otherwise the consumer could free space without waking up the caller
+    /// @note only applicable for queues with QueueFullPolicy::BLOCK_PRODUCER
+    void startWaitingForSpace() noexcept;
+
+    /// @brief Blocks until the consumer took a chunk out of the queue, wakeUpWaitingProducers was called or the
+    /// timeout has passed. Spurious wake ups are possible, i.e. the caller has to retry the push and wait again
+    /// @param[in] timeout is the maximum time to wait, with units::Duration::max() it waits without a timeout
+    /// @note only applicable between startWaitingForSpace and stopWaitingForSpace
+    void waitForSpace(const units::Duration timeout) noexcept;
+
+    /// @brief Revokes the announcement of startWaitingForSpace
+    void stopWaitingForSpace() noexcept;
+
+    /// @brief Wakes up all producers which are currently waiting for space in this queue, e.g. because the queue
+    /// is removed from the producer
+    void wakeUpWaitingProducers() noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+  private:
+    bool pushWithoutNotification(const mepoo::SharedChunk& chunk) noexcept;
+    void notify() noexcept;
+
   private:
     MemberType_t* m_chunkQueueDataPtr{nullptr};
 };
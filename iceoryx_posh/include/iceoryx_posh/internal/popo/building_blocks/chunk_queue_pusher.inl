@@ -44,29 +44,71 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+{
+    const bool hasQueueOverflow = !pushWithoutNotification(chunk);
+    notify();
+
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline uint64_t ChunkQueuePusher<ChunkQueueDataType>::push(const span<const mepoo::SharedChunk> chunks,
+                                                           const bool stopAtOverflow) noexcept
+{
+    uint64_t numberOfProcessedChunks{0U};
+    for (const auto& chunk : chunks)
+    {
+        if (!pushWithoutNotification(chunk))
+        {
+            if (stopAtOverflow)
+            {
+                break;
+            }
+            lostAChunk();
+        }
+        ++numberOfProcessedChunks;
+    }
+
+    notify();
+
+    return numberOfProcessedChunks;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(const mepoo::SharedChunk& chunk) noexcept
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
-    bool hasQueueOverflow = false;
 
     // drop the chunk if one is returned by an overflow
     if (pushRet.has_value())
     {
         pushRet.value().releaseToSharedChunk();
-        // tell the ChunkDistributor that we had an overflow and dropped a sample
-        hasQueueOverflow = true;
+        // tell the caller that we had an overflow and dropped a sample
+        return false;
     }
 
+    return true;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify() noexcept
+{
+    // pairs with the fence in ChunkQueuePopper::setConditionVariable; either the pushed chunks are seen by whoever
+    // attaches the condition variable or the condition variable is seen here
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!getMembers()->m_isConditionVariableSet.load(std::memory_order_relaxed))
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
-        {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
-        }
+        return;
     }
 
-    return !hasQueueOverflow;
+    // the lock prevents that the condition variable is detached and destroyed while it is notified
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (getMembers()->m_conditionVariableDataPtr)
+    {
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
+    }
 }
 
 template <typename ChunkQueueDataType>
@@ -75,6 +117,51 @@ inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::startWaitingForSpace() noexcept
+{
+    // pairs with the fence in ChunkQueuePopper::wakeUpWaitingProducers; either the consumer sees the waiting producer
+    // or the subsequent push attempt sees the space freed by the consumer
+    getMembers()->m_numberOfWaitingProducers.fetch_add(1U, std::memory_order_seq_cst);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::waitForSpace(const units::Duration timeout) noexcept
+{
+    auto& semaphore = getMembers()->m_spaceAvailableSemaphore;
+    if (!semaphore.has_value())
+    {
+        return;
+    }
+
+    const bool hasWaitFailed = (timeout == units::Duration::max()) ? semaphore->wait().has_error()
+                                                                   : semaphore->timedWait(timeout).has_error();
+    if (hasWaitFailed)
+    {
+        errorHandler(PoshError::POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED_IN_WAIT_FOR_SPACE, ErrorLevel::FATAL);
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::stopWaitingForSpace() noexcept
+{
+    getMembers()->m_numberOfWaitingProducers.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::wakeUpWaitingProducers() noexcept
+{
+    auto& semaphore = getMembers()->m_spaceAvailableSemaphore;
+    const auto numberOfWaitingProducers = getMembers()->m_numberOfWaitingProducers.load(std::memory_order_seq_cst);
+    for (uint64_t i = 0U; semaphore.has_value() && i < numberOfWaitingProducers; ++i)
+    {
+        if (semaphore->post().has_error())
+        {
+            errorHandler(PoshError::POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED_IN_WAKE_UP, ErrorLevel::FATAL);
+        }
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
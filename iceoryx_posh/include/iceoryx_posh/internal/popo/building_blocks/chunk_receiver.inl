@@ -81,6 +81,13 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
         // if the application holds too many chunks, don't provide more
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
         {
+            const auto sendTimestamp = sharedChunk.getSendTimestamp();
+            if (sendTimestamp != 0U)
+            {
+                const auto takeTimestamp = LatencyHistogram::currentTimestamp();
+                getMembers()->m_latencyHistogram.record(
+                    (takeTimestamp > sendTimestamp) ? takeTimestamp - sendTimestamp : 0U);
+            }
             return success<const mepoo::ChunkHeader*>(
                 const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
         }
@@ -22,13 +22,18 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
+#include "iceoryx_posh/mepoo/chunk_chain.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/attributes.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/expected.hpp"
 #include "iox/into.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
 
+#include <cstring>
+#include <limits>
+
 namespace iox
 {
 namespace popo
@@ -104,6 +109,29 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                                                                const uint32_t userHeaderSize,
                                                                const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief allocate a chunk chain for a user-payload which is larger than the chunks of the mempools, see
+    /// mepoo::ChunkChainHeader; only the first link is tracked by the ChunkSender, it owns the remaining links
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] chainPayloadSize, user-payload size of the whole chain
+    /// @param[in] linkPayloadSize, maximal user-payload size of a link
+    /// @param[in] userPayloadAlignment, alignment of the user-payload of every link
+    /// @return on success pointer to the ChunkHeader of the first link, error if not
+    expected<mepoo::ChunkHeader*, AllocationError> tryAllocateChain(const UniquePortId originId,
+                                                                    const uint64_t chainPayloadSize,
+                                                                    const uint32_t linkPayloadSize,
+                                                                    const uint32_t userPayloadAlignment) noexcept;
+
+    /// @brief Changes the user-payload size of an allocated chunk. The chunk is resized in place if the new
+    /// user-payload fits into the chunk, otherwise the user-header and the part of the user-payload which is covered
+    /// by both sizes are moved to a new chunk from a fitting mempool and the old chunk is released
+    /// @param[in] chunkHeader, pointer to the ChunkHeader of the allocated chunk; the first link of a chunk chain cannot
+    /// be resized
+    /// @param[in] userPayloadSize, the new size of the user-payload
+    /// @return on success pointer to the ChunkHeader of the resized chunk which replaces the provided one, error if
+    /// not; on error the provided chunk stays allocated and unchanged
+    expected<mepoo::ChunkHeader*, AllocationError> tryResize(mepoo::ChunkHeader* const chunkHeader,
+                                                             const uint32_t userPayloadSize) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -114,6 +142,13 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in the given order to all connected ChunkQueuePopper with a single
+    /// delivery pass, see ChunkDistributor::deliverBatchToAllStoredQueues
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send; the ownership of the pointers is transferred to
+    /// this method
+    /// @return the number of receivers the chunks were sent to
+    uint64_t sendBatch(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
@@ -135,7 +170,7 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
 
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
-    /// chunks in the system
+    /// chunks in the system. The chunks which are reserved by the chunk magazine are returned to the mempools as well.
     void releaseAll() noexcept;
 
   private:
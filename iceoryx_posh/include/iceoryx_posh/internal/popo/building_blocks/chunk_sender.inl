@@ -19,6 +19,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_INL
 
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
 
 namespace iox
 {
@@ -118,6 +119,11 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     auto& lastChunkUnmanaged = getMembers()->m_lastChunkUnmanaged;
     mepoo::ChunkHeader* lastChunkChunkHeader =
         lastChunkUnmanaged.isNotLogicalNullptrAndHasNoOtherOwners() ? lastChunkUnmanaged.getChunkHeader() : nullptr;
+    // the first link of a chunk chain is not reused since it would keep the remaining links alive
+    if (lastChunkChunkHeader && lastChunkChunkHeader->userHeaderId() == mepoo::ChunkHeader::CHUNK_CHAIN_USER_HEADER)
+    {
+        lastChunkChunkHeader = nullptr;
+    }
 
     if (lastChunkChunkHeader && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize))
     {
@@ -139,7 +145,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkMagazine);
 
         if (!getChunkResult.has_error())
         {
@@ -167,6 +173,112 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
 }
 
+template <typename ChunkSenderDataType>
+inline expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocateChain(const UniquePortId originId,
+                                                   const uint64_t chainPayloadSize,
+                                                   const uint32_t linkPayloadSize,
+                                                   const uint32_t userPayloadAlignment) noexcept
+{
+    const auto linkSettingsResult = mepoo::ChunkSettings::create(linkPayloadSize,
+                                                                 userPayloadAlignment,
+                                                                 sizeof(mepoo::ChunkChainHeader),
+                                                                 alignof(mepoo::ChunkChainHeader));
+    const bool isLinkPayloadSizeValid = (linkPayloadSize > 0U);
+    const bool isNumberOfLinksValid = isLinkPayloadSizeValid && (chainPayloadSize > 0U)
+                                      && ((chainPayloadSize - 1U) / linkPayloadSize
+                                          < static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()));
+    if (linkSettingsResult.has_error() || !isNumberOfLinksValid)
+    {
+        return error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // BEGIN of critical section, the chain will be lost if the process terminates in this section
+    auto getChainResult = getMembers()->m_memoryMgr->getChunkChain(
+        chainPayloadSize, linkSettingsResult.value(), getMembers()->m_chunkMagazine);
+    if (getChainResult.has_error())
+    {
+        /// @todo iox-#1012 use error<E2>::from(E1); once available
+        return error<AllocationError>(into<AllocationError>(getChainResult.get_error()));
+    }
+
+    auto& chain = getChainResult.value();
+    if (!getMembers()->m_chunksInUse.insert(chain))
+    {
+        // release the allocated chain
+        chain = nullptr;
+        return error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+    // END of critical section
+
+    chain.getChunkHeader()->setOriginId(originId);
+    return success<mepoo::ChunkHeader*>(chain.getChunkHeader());
+}
+
+template <typename ChunkSenderDataType>
+inline expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryResize(mepoo::ChunkHeader* const chunkHeader,
+                                            const uint32_t userPayloadSize) noexcept
+{
+    mepoo::SharedChunk chunk(nullptr);
+    if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
+    {
+        errorHandler(PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_RESIZE_FROM_USER, ErrorLevel::SEVERE);
+        return error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+    // the chunk was removed from m_chunksInUse, i.e. its slot is free and it can always be inserted again; the chunk is
+    // lost if the process terminates before that, like a chunk which is allocated in tryAllocate
+
+    if (chunkHeader->userHeaderId() == mepoo::ChunkHeader::CHUNK_CHAIN_USER_HEADER)
+    {
+        IOX_DISCARD_RESULT(getMembers()->m_chunksInUse.insert(chunk));
+        return error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    const uint64_t userPayloadOffset = chunkHeader->usedSizeOfChunk() - chunkHeader->userPayloadSize();
+    if (userPayloadOffset + userPayloadSize <= chunkHeader->chunkSize())
+    {
+        chunkHeader->setUserPayloadSize(userPayloadSize);
+        IOX_DISCARD_RESULT(getMembers()->m_chunksInUse.insert(chunk));
+        return success<mepoo::ChunkHeader*>(chunkHeader);
+    }
+
+    // the user-header is adjacent to the ChunkHeader and its alignment is therefore only relevant for the validation
+    // of the settings, which were already validated with the original alignment when the chunk was allocated
+    auto chunkSettingsResult = mepoo::ChunkSettings::create(userPayloadSize,
+                                                            chunkHeader->userPayloadAlignment(),
+                                                            chunkHeader->userHeaderSize(),
+                                                            iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (chunkSettingsResult.has_error())
+    {
+        IOX_DISCARD_RESULT(getMembers()->m_chunksInUse.insert(chunk));
+        return error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    auto getChunkResult =
+        getMembers()->m_memoryMgr->getChunk(chunkSettingsResult.value(), getMembers()->m_chunkMagazine);
+    if (getChunkResult.has_error())
+    {
+        IOX_DISCARD_RESULT(getMembers()->m_chunksInUse.insert(chunk));
+        /// @todo iox-#1012 use error<E2>::from(E1); once available
+        return error<AllocationError>(into<AllocationError>(getChunkResult.get_error()));
+    }
+
+    auto& resizedChunk = getChunkResult.value();
+    auto resizedChunkHeader = resizedChunk.getChunkHeader();
+    resizedChunkHeader->setOriginId(chunkHeader->originId());
+    if (chunkHeader->userHeaderSize() > 0U)
+    {
+        std::memcpy(resizedChunkHeader->userHeader(), chunkHeader->userHeader(), chunkHeader->userHeaderSize());
+    }
+    // only the part of the user-payload which was written so far is copied, which is at most the old size
+    std::memcpy(resizedChunkHeader->userPayload(), chunkHeader->userPayload(), chunkHeader->userPayloadSize());
+    IOX_DISCARD_RESULT(getMembers()->m_chunksInUse.insert(resizedChunk));
+
+    // the d'tor of the old SharedChunk releases the old chunk
+    return success<mepoo::ChunkHeader*>(resizedChunkHeader);
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -196,6 +308,35 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::sendBatch(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    uint64_t numberOfReceiverTheChunksWereDelivered{0};
+    // there cannot be more valid chunk headers than chunks in use
+    vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY> chunks;
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    for (auto chunkHeader : chunkHeaders)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeader, chunk))
+        {
+            chunks.emplace_back(chunk);
+        }
+    }
+
+    if (!chunks.empty())
+    {
+        numberOfReceiverTheChunksWereDelivered =
+            this->deliverBatchToAllStoredQueues(span<const mepoo::SharedChunk>(chunks.begin(), chunks.size()));
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunks.back();
+    }
+    // END of critical section
+
+    return numberOfReceiverTheChunksWereDelivered;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const UniqueId uniqueQueueId,
@@ -251,6 +392,7 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_chunkMagazine.drain();
 }
 
 template <typename ChunkSenderDataType>
@@ -260,6 +402,10 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        if (getMembers()->m_stampSendTime)
+        {
+            chunk.setSendTimestamp(LatencyHistogram::currentTimestamp());
+        }
         return true;
     }
     else
@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_DATA_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_magazine.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
@@ -36,15 +37,23 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const units::Duration consumerTooSlowTimeout = units::Duration::max(),
+                             const uint32_t chunkMagazineCapacity = 0U,
+                             const bool stampSendTime = false) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY{MaxChunksAllocatedSimultaneously};
+
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    mepoo::ChunkMagazine m_chunkMagazine;
+    /// @brief whether the chunks are stamped with the send time to let the subscribers record the latency
+    const bool m_stampSendTime{false};
 };
 
 } // namespace popo
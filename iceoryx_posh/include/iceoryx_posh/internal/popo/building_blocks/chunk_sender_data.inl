@@ -21,15 +21,24 @@ namespace iox
 {
 namespace popo
 {
+template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
+constexpr uint32_t ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataType>::
+    MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY;
+
 template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
 inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataType>::ChunkSenderData(
     not_null<mepoo::MemoryManager* const> memoryManager,
     const ConsumerTooSlowPolicy consumerTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity)
+    const mepoo::MemoryInfo& memoryInfo,
+    const units::Duration consumerTooSlowTimeout,
+    const uint32_t chunkMagazineCapacity,
+    const bool stampSendTime) noexcept
+    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity, consumerTooSlowTimeout)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
+    , m_chunkMagazine(chunkMagazineCapacity)
+    , m_stampSendTime(stampSendTime)
 {
 }
 
@@ -19,19 +19,24 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/optional.hpp"
 
 namespace iox
 {
 namespace popo
 {
-/// @brief ConditionListener allows one to wait using a shared memory condition variable
+/// @brief ConditionListener allows one to wait using a shared memory condition variable. Depending on the
+/// WaitStrategy it polls the active notifications before or instead of blocking on the semaphore.
 class ConditionListener
 {
   public:
     using NotificationVector_t = vector<BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
-    explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
+    explicit ConditionListener(ConditionVariableData& condVarData,
+                               const WaitStrategy waitStrategy = WaitStrategy()) noexcept;
     ~ConditionListener() noexcept = default;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
@@ -69,13 +74,22 @@ class ConditionListener
     ConditionVariableData* getMembers() noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
+    bool hasActiveNotifications() const noexcept;
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
 
-    NotificationVector_t waitImpl(const function_ref<bool()>& waitCall) noexcept;
+    /// @brief polls the active notifications according to the WaitStrategy
+    /// @param[in] deadline the end of a timed wait, nullopt for an unbounded wait
+    /// @return true if the spin budget of SPIN_THEN_BLOCK is exhausted and the caller has to block, false if a
+    /// notification is active, destroy() was called or the deadline has expired
+    bool pollActiveNotifications(const optional<deadline_timer>& deadline) const noexcept;
+
+    NotificationVector_t waitImpl(const optional<deadline_timer>& deadline,
+                                  const function_ref<bool()>& waitCall) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
+    WaitStrategy m_waitStrategy;
     std::atomic_bool m_toBeDestroyed{false};
 };
 
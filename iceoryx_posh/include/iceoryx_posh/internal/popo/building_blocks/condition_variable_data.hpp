@@ -29,6 +29,10 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    static constexpr uint64_t NOTIFICATIONS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(MAX_NUMBER_OF_NOTIFIERS + NOTIFICATIONS_PER_WORD - 1U)
+                                                           / NOTIFICATIONS_PER_WORD};
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -38,11 +42,21 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    /// @brief checks whether the notification with the given index is active
+    /// @param[in] index of the notification, must be smaller than MAX_NUMBER_OF_NOTIFIERS
+    /// @return true if the notification was set by a ConditionNotifier and not yet collected by the ConditionListener
+    bool isNotificationActive(const uint64_t index) const noexcept;
+
     optional<posix::UnnamedSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief bitset of the active notifications, the notification with index i is bit i % NOTIFICATIONS_PER_WORD of
+    /// word i / NOTIFICATIONS_PER_WORD
+    std::atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     std::atomic_bool m_wasNotified{false};
+    /// @brief number of ConditionListener which are about to block on the semaphore; the semaphore is only posted
+    /// by a ConditionNotifier when this is not zero
+    std::atomic<uint64_t> m_numberOfWaiters{0U};
 };
 
 } // namespace popo
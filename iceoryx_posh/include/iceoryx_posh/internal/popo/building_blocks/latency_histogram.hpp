@@ -0,0 +1,101 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+class LatencyHistogramSnapshot;
+
+/// @brief Lock-free histogram of latencies in nanoseconds. The buckets are logarithmic, every power of two range is
+/// split into SUB_BUCKETS_PER_RANGE linear sub-buckets, i.e. a bucket is at most 1/SUB_BUCKETS_PER_RANGE wider than
+/// its lower bound. The histogram is located in the shared memory, the subscriber records the latencies and RouDi
+/// collects them periodically.
+class LatencyHistogram
+{
+  public:
+    static constexpr uint64_t SUB_BUCKET_BITS{3U};
+    static constexpr uint64_t SUB_BUCKETS_PER_RANGE{1U << SUB_BUCKET_BITS};
+    /// @brief latencies of 2^NUMBER_OF_RANGES nanoseconds (about 4.3 seconds) and more are counted in the last bucket
+    static constexpr uint64_t NUMBER_OF_RANGES{32U};
+    static constexpr uint64_t NUMBER_OF_BUCKETS{(NUMBER_OF_RANGES - SUB_BUCKET_BITS + 1U) * SUB_BUCKETS_PER_RANGE};
+
+    LatencyHistogram() noexcept = default;
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+    ~LatencyHistogram() noexcept = default;
+
+    /// @brief Counts a latency; this is wait-free and can be called concurrently to collect
+    /// @param[in] latencyInNanoseconds is the latency to count
+    void record(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief Moves the counted latencies into the snapshot, i.e. the next collect only returns the latencies which
+    /// were recorded in the meantime. The latencies are added to the ones which are already in the snapshot.
+    /// @param[in] snapshot to add the counted latencies to
+    void collect(LatencyHistogramSnapshot& snapshot) noexcept;
+
+    /// @brief Returns the current time in nanoseconds of the monotonic clock which is used for the send timestamps of
+    /// the chunks; the clock is the same for all processes
+    static uint64_t currentTimestamp() noexcept;
+
+    /// @brief Returns the index of the bucket which counts the provided latency
+    static uint64_t bucketIndex(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief Returns the largest latency which is counted in the bucket with the provided index
+    static uint64_t bucketUpperBound(const uint64_t index) noexcept;
+
+  private:
+    std::atomic<uint32_t> m_counts[NUMBER_OF_BUCKETS]{};
+    std::atomic<uint64_t> m_maxLatency{0U};
+};
+
+/// @brief The latencies which were collected from one or more LatencyHistograms
+class LatencyHistogramSnapshot
+{
+  public:
+    /// @brief Returns the number of collected latencies
+    uint64_t numberOfSamples() const noexcept;
+
+    /// @brief Returns the largest collected latency in nanoseconds
+    uint64_t maxLatency() const noexcept;
+
+    /// @brief Returns the latency in nanoseconds which is not exceeded by the provided fraction of the collected
+    /// latencies. It is the upper bound of the corresponding bucket, limited to the largest collected latency.
+    /// @param[in] fraction of the collected latencies, e.g. 0.99 for the 99th percentile
+    /// @return the percentile or 0 if no latency was collected
+    uint64_t percentile(const double fraction) const noexcept;
+
+  private:
+    friend class LatencyHistogram;
+
+    uint64_t m_counts[LatencyHistogram::NUMBER_OF_BUCKETS]{};
+    uint64_t m_numberOfSamples{0U};
+    uint64_t m_maxLatency{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
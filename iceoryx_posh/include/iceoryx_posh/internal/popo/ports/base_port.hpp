@@ -44,6 +44,9 @@ class BasePort
   public:
     using MemberType_t = BasePortData;
 
+    /// @brief the notification index which is used to wake up RouDi's discovery loop
+    static constexpr uint64_t DISCOVERY_NOTIFICATION_INDEX{0U};
+
     explicit BasePort(MemberType_t* const basePortDataPtr) noexcept;
 
     BasePort(const BasePort& other) = delete;
@@ -79,6 +82,14 @@ class BasePort
     /// @return true if it shall be destroyed, false if not
     bool toBeDestroyed() const noexcept;
 
+    /// @brief Marks the port for the next discovery run of RouDi and wakes up RouDi's discovery loop; must be called
+    /// after every change of the CaPro state which RouDi has to process
+    void requestDiscovery() noexcept;
+
+    /// @brief Resets the discovery request of the port, used by RouDi to process only the ports which changed
+    /// @return true if a discovery run was requested since the last call, false if not
+    bool takeDiscoveryRequest() noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iox/relative_pointer.hpp"
 
@@ -54,6 +55,11 @@ struct BasePortData
     NodeName_t m_nodeName;
     UniquePortId m_uniqueId;
     std::atomic_bool m_toBeDestroyed{false};
+    /// @brief is set when the CaPro state of the port was changed and RouDi has to run the discovery for this port;
+    /// a new port always requires a discovery run
+    std::atomic_bool m_discoveryRequested{true};
+    /// @brief the condition variable of RouDi's discovery loop which is notified on a discovery request
+    RelativePointer<ConditionVariableData> m_discoveryConditionVariable;
 };
 
 } // namespace popo
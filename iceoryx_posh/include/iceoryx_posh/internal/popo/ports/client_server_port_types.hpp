@@ -44,11 +44,13 @@ struct ServerChunkDistributorConfig
 struct ClientChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_RESPONSE_QUEUE_CAPACITY;
+    static constexpr bool HAS_SINGLE_PRODUCER = false;
 };
 
 struct ServerChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_REQUEST_QUEUE_CAPACITY;
+    static constexpr bool HAS_SINGLE_PRODUCER = false;
 };
 
 using ClientChunkQueueData_t = ChunkQueueData<ClientChunkQueueConfig, ThreadSafePolicy>;
@@ -25,6 +25,7 @@
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -61,6 +62,23 @@ class PublisherPortUser : public BasePort
                                                                     const uint32_t userHeaderSize = 0U,
                                                                     const uint32_t userHeaderAlignment = 1U) noexcept;
 
+    /// @brief Allocate a chunk chain for a user-payload which is larger than the chunks of the mempools, see
+    /// mepoo::ChunkChainHeader; the ownership of the first link remains in the PublisherPortUser
+    /// @param[in] chainPayloadSize, user-payload size of the whole chain
+    /// @param[in] linkPayloadSize, maximal user-payload size of a link
+    /// @param[in] userPayloadAlignment, alignment of the user-payload of every link
+    /// @return on success pointer to the ChunkHeader of the first link, error if not
+    expected<mepoo::ChunkHeader*, AllocationError> tryAllocateChunkChain(const uint64_t chainPayloadSize,
+                                                                         const uint32_t linkPayloadSize,
+                                                                         const uint32_t userPayloadAlignment) noexcept;
+
+    /// @brief Change the user-payload size of an allocated chunk, see ChunkSender::tryResize
+    /// @param[in] chunkHeader, pointer to the ChunkHeader of the allocated chunk
+    /// @param[in] userPayloadSize, the new size of the user-payload
+    /// @return on success pointer to the ChunkHeader of the resized chunk which replaces the provided one, error if not
+    expected<mepoo::ChunkHeader*, AllocationError> tryResizeChunk(mepoo::ChunkHeader* const chunkHeader,
+                                                                  const uint32_t userPayloadSize) noexcept;
+
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -69,6 +87,11 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in the given order to all connected subscriber ports with a single
+    /// delivery pass; each subscriber is notified once for all chunks
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send
+    void sendChunks(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/popo/publisher_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/span.hpp"
 #include "iox/type_traits.hpp"
 
 namespace iox
@@ -61,6 +62,14 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief publishBatch Publishes the given samples in the given order and then releases their loans.
+    /// @param samples The samples to publish; they are empty afterwards.
+    /// @details All samples are delivered with a single pass over the subscribers and each subscriber is notified
+    /// only once. Empty samples are reported and skipped.
+    ///
+    void publishBatch(const span<Sample<T, H>> samples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
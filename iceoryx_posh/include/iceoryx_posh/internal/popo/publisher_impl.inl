@@ -92,6 +92,35 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishBatch(const span<Sample<T, H>> samples) noexcept
+{
+    // a publisher cannot loan more chunks at once, larger batches contain invalid samples anyway
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (auto& sample : samples)
+    {
+        if (!sample)
+        {
+            IOX_LOG(ERROR) << "Tried to publish empty Sample! Might be an already published or moved Sample!";
+            errorHandler(PoshError::POSH__PUBLISHING_EMPTY_SAMPLE, ErrorLevel::MODERATE);
+            continue;
+        }
+
+        // release the Samples ownership of the chunk before publishing
+        chunkHeaders.emplace_back(mepoo::ChunkHeader::fromUserPayload(sample.release()));
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+    }
+
+    if (!chunkHeaders.empty())
+    {
+        port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+    }
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
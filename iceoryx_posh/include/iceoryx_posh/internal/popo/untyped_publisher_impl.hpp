@@ -19,7 +19,10 @@
 #define IOX_POSH_POPO_UNTYPED_PUBLISHER_IMPL_HPP
 
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
+#include "iceoryx_posh/mepoo/chunk_chain.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -43,6 +46,9 @@ class UntypedPublisherImpl : public BasePublisherType
     /// @brief Get a chunk from loaned shared memory.
     /// @param usePayloadSize The expected user-payload size of the chunk.
     /// @param userPayloadAlignment The expected user-payload alignment of the chunk.
+    /// @param userPayloadCapacity The user-payload size the chunk shall be able to hold. If it is larger than the
+    ///        user-payload size, the chunk is taken from a mempool which fits the capacity and a later resize up to the
+    ///        capacity is done in place.
     /// @return A pointer to the user-payload of a chunk of memory with the requested size or
     ///         an AllocationError if no chunk could be loaned.
     /// @note An AllocationError occurs if no chunk is available in the shared memory.
@@ -51,7 +57,39 @@ class UntypedPublisherImpl : public BasePublisherType
     loan(const uint32_t userPayloadSize,
          const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
          const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
-         const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
+         const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT,
+         const uint32_t userPayloadCapacity = 0U) noexcept;
+
+    ///
+    /// @brief Change the user-payload size of a loaned chunk.
+    /// @param userPayload Pointer to the user-payload of the loaned chunk.
+    /// @param userPayloadSize The new user-payload size.
+    /// @return A pointer to the user-payload of the resized chunk, which replaces the provided pointer, or an
+    ///         AllocationError if the chunk could not be resized. On error the loaned chunk stays unchanged.
+    /// @details Shrinking and growing within the chunk only update the user-payload size. Growing beyond the chunk
+    ///          moves the user-header and the user-payload to a chunk from a larger mempool and releases the old
+    ///          chunk; only the user-payload up to the previous size is copied. The first link of a chunk chain cannot
+    ///          be resized.
+    ///
+    expected<void*, AllocationError> resize(void* const userPayload, const uint32_t userPayloadSize) noexcept;
+
+    ///
+    /// @brief Get a chunk chain from loaned shared memory for a user-payload which is larger than the chunks of the
+    /// mempools.
+    /// @param chainPayloadSize The user-payload size of the whole chain.
+    /// @param linkPayloadSize The maximal user-payload size of a link, i.e. of one chunk of the chain.
+    /// @param userPayloadAlignment The expected user-payload alignment of every link.
+    /// @return A pointer to the user-payload of the first link or an AllocationError if the chain could not be
+    ///         loaned.
+    /// @details The links are accessed with mepoo::ChunkChain::fromUserPayload. Only the last link is smaller than
+    ///          the link size, i.e. the chain occupies only the chunks it needs. The returned pointer is published or
+    ///          released like the pointer of a single chunk and the whole chain is released with the first link.
+    ///          Subscribers access the links with mepoo::ConstChunkChain::fromUserPayload.
+    ///
+    expected<void*, AllocationError>
+    loanChain(const uint64_t chainPayloadSize,
+              const uint32_t linkPayloadSize,
+              const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT) noexcept;
 
     ///
     /// @brief Publish the provided memory chunk.
@@ -60,6 +98,14 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Publish the provided memory chunks in the given order.
+    /// @param userPayloads Pointers to the user-payloads of the allocated shared memory chunks.
+    /// @details All chunks are delivered with a single pass over the subscribers and each subscriber is notified
+    /// only once.
+    ///
+    void publishBatch(const span<void* const> userPayloads) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -38,14 +38,76 @@ inline void UntypedPublisherImpl<BasePublisherType>::publish(void* const userPay
     port().sendChunk(chunkHeader);
 }
 
+template <typename BasePublisherType>
+inline void UntypedPublisherImpl<BasePublisherType>::publishBatch(const span<void* const> userPayloads) noexcept
+{
+    // a publisher cannot loan more chunks at once, larger batches contain invalid chunks anyway
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (auto userPayload : userPayloads)
+    {
+        chunkHeaders.emplace_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+    }
+
+    if (!chunkHeaders.empty())
+    {
+        port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+    }
+}
+
 template <typename BasePublisherType>
 inline expected<void*, AllocationError>
 UntypedPublisherImpl<BasePublisherType>::loan(const uint32_t userPayloadSize,
                                               const uint32_t userPayloadAlignment,
                                               const uint32_t userHeaderSize,
-                                              const uint32_t userHeaderAlignment) noexcept
+                                              const uint32_t userHeaderAlignment,
+                                              const uint32_t userPayloadCapacity) noexcept
+{
+    const uint32_t chunkUserPayloadSize = algorithm::maxVal(userPayloadSize, userPayloadCapacity);
+    auto result =
+        port().tryAllocateChunk(chunkUserPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (result.has_error())
+    {
+        return error<AllocationError>(result.get_error());
+    }
+    else if (chunkUserPayloadSize != userPayloadSize)
+    {
+        // shrinking is done in place and keeps the chunk which fits the capacity
+        return resize(result.value()->userPayload(), userPayloadSize);
+    }
+    else
+    {
+        return success<void*>(result.value()->userPayload());
+    }
+}
+
+template <typename BasePublisherType>
+inline expected<void*, AllocationError>
+UntypedPublisherImpl<BasePublisherType>::resize(void* const userPayload, const uint32_t userPayloadSize) noexcept
+{
+    auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+    auto result = port().tryResizeChunk(chunkHeader, userPayloadSize);
+    if (result.has_error())
+    {
+        return error<AllocationError>(result.get_error());
+    }
+    else
+    {
+        return success<void*>(result.value()->userPayload());
+    }
+}
+
+template <typename BasePublisherType>
+inline expected<void*, AllocationError>
+UntypedPublisherImpl<BasePublisherType>::loanChain(const uint64_t chainPayloadSize,
+                                                   const uint32_t linkPayloadSize,
+                                                   const uint32_t userPayloadAlignment) noexcept
 {
-    auto result = port().tryAllocateChunk(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    auto result = port().tryAllocateChunkChain(chainPayloadSize, linkPayloadSize, userPayloadAlignment);
     if (result.has_error())
     {
         return error<AllocationError>(result.get_error());
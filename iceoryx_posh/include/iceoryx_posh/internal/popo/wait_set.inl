@@ -78,9 +78,15 @@ inline WaitSet<Capacity>::WaitSet() noexcept
 }
 
 template <uint64_t Capacity>
-inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData) noexcept
+inline WaitSet<Capacity>::WaitSet(const WaitStrategy waitStrategy) noexcept
+    : WaitSet(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitStrategy)
+{
+}
+
+template <uint64_t Capacity>
+inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData, const WaitStrategy waitStrategy) noexcept
     : m_conditionVariableDataPtr(&condVarData)
-    , m_conditionListener(condVarData)
+    , m_conditionListener(condVarData, waitStrategy)
 {
     for (uint64_t i = 0U; i < Capacity; ++i)
     {
@@ -0,0 +1,150 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_HASH_MULTI_INDEX_HPP
+#define IOX_POSH_ROUDI_HASH_MULTI_INDEX_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Returns the FNV-1a hash of an id string
+/// @param[in] id string to hash
+/// @return the hash of the string
+uint64_t hashIdString(const capro::IdString_t& id) noexcept;
+
+/// @brief Returns the hash of the service, instance and event string of a service description, i.e. all service
+/// descriptions which compare equal have the same hash
+/// @param[in] serviceDescription to hash
+/// @return the hash of the service description
+uint64_t hashServiceDescription(const capro::ServiceDescription& serviceDescription) noexcept;
+
+namespace detail
+{
+/// @brief returns the smallest power of two which is not smaller than the provided value
+constexpr uint64_t nextPowerOfTwo(const uint64_t value) noexcept
+{
+    return (value <= 1U) ? 1U : 2U * nextPowerOfTwo((value + 1U) / 2U);
+}
+} // namespace detail
+
+/// @brief Fixed capacity index which maps a key to all values which were added with this key (multimap semantics)
+/// without dynamic memory. The buckets use open addressing with linear probing, every used bucket stores the hash of
+/// one key and the first and last node of the values with this key. The values of a key are linked in the order they
+/// were added.
+/// The keys itself are not stored, the caller provides the hash of the key together with a predicate which tells if
+/// a stored value belongs to the key. This keeps the index small when the key is part of the value, e.g. the service
+/// description of a port.
+/// The index contains no pointers, it can be copied and placed in the shared memory as long as the values can.
+/// @tparam Value type of the values, must be default constructible and equality comparable
+/// @tparam Capacity maximum number of values in the index
+template <typename Value, uint64_t Capacity>
+class HashMultiIndex
+{
+  public:
+    static_assert(Capacity > 0U, "The capacity of the HashMultiIndex must be greater than 0");
+    static_assert(Capacity < std::numeric_limits<uint32_t>::max(), "The capacity of the HashMultiIndex is too large");
+
+    /// @brief the buckets are at most half full, this keeps the probe sequences short
+    static constexpr uint64_t NUMBER_OF_BUCKETS{detail::nextPowerOfTwo(2U * Capacity)};
+
+    HashMultiIndex() noexcept;
+
+    HashMultiIndex(const HashMultiIndex&) noexcept = default;
+    HashMultiIndex(HashMultiIndex&&) noexcept = default;
+    HashMultiIndex& operator=(const HashMultiIndex&) noexcept = default;
+    HashMultiIndex& operator=(HashMultiIndex&&) noexcept = default;
+    ~HashMultiIndex() noexcept = default;
+
+    /// @brief Adds a value under a key, the values of a key are kept in insertion order
+    /// @param[in] hash of the key
+    /// @param[in] value to add
+    /// @param[in] hasKey predicate with the signature bool(const Value&), returns true if a value belongs to the key
+    /// @return true if the value was added, false if the index already contains Capacity values
+    template <typename HasKey>
+    bool insert(const uint64_t hash, const Value& value, const HasKey& hasKey) noexcept;
+
+    /// @brief Removes the first value which is equal to the provided one from the values of a key
+    /// @param[in] hash of the key
+    /// @param[in] value to remove
+    /// @param[in] hasKey predicate with the signature bool(const Value&), returns true if a value belongs to the key
+    /// @return true if the value was removed, false if it was not found
+    template <typename HasKey>
+    bool erase(const uint64_t hash, const Value& value, const HasKey& hasKey) noexcept;
+
+    /// @brief Calls the callable with every value of a key in insertion order; the index must not be modified by the
+    /// callable
+    /// @param[in] hash of the key
+    /// @param[in] hasKey predicate with the signature bool(const Value&), returns true if a value belongs to the key
+    /// @param[in] callable with the signature void(const Value&)
+    template <typename HasKey, typename Callable>
+    void forEach(const uint64_t hash, const HasKey& hasKey, const Callable& callable) const noexcept;
+
+    /// @brief Returns the number of values of a key
+    /// @param[in] hash of the key
+    /// @param[in] hasKey predicate with the signature bool(const Value&), returns true if a value belongs to the key
+    /// @return the number of values which were added with the key
+    template <typename HasKey>
+    uint64_t count(const uint64_t hash, const HasKey& hasKey) const noexcept;
+
+    /// @brief Returns the number of values in the index
+    uint64_t size() const noexcept;
+
+  private:
+    static constexpr uint64_t BUCKET_MASK{NUMBER_OF_BUCKETS - 1U};
+    static constexpr uint32_t INVALID_NODE{std::numeric_limits<uint32_t>::max()};
+
+    struct Bucket
+    {
+        uint64_t hash{0U};
+        uint32_t firstNode{INVALID_NODE};
+        uint32_t lastNode{INVALID_NODE};
+        uint32_t numberOfValues{0U};
+
+        bool isUsed() const noexcept;
+    };
+
+    struct Node
+    {
+        Value value{};
+        uint32_t next{INVALID_NODE};
+    };
+
+    /// @brief returns the bucket of the key or NUMBER_OF_BUCKETS if the key has no values
+    template <typename HasKey>
+    uint64_t findBucket(const uint64_t hash, const HasKey& hasKey) const noexcept;
+
+    /// @brief releases a bucket and moves the following buckets of the probe sequence back (backward shift deletion)
+    /// so that no tombstones are required
+    void releaseBucket(uint64_t index) noexcept;
+
+    Bucket m_buckets[NUMBER_OF_BUCKETS];
+    Node m_nodes[Capacity];
+    uint32_t m_freeNode{0U};
+    uint64_t m_size{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/hash_multi_index.inl"
+
+#endif // IOX_POSH_ROUDI_HASH_MULTI_INDEX_HPP
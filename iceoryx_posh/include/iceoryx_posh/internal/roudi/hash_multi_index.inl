@@ -0,0 +1,212 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_HASH_MULTI_INDEX_INL
+#define IOX_POSH_ROUDI_HASH_MULTI_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/hash_multi_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <typename Value, uint64_t Capacity>
+constexpr uint64_t HashMultiIndex<Value, Capacity>::NUMBER_OF_BUCKETS;
+
+template <typename Value, uint64_t Capacity>
+constexpr uint64_t HashMultiIndex<Value, Capacity>::BUCKET_MASK;
+
+template <typename Value, uint64_t Capacity>
+constexpr uint32_t HashMultiIndex<Value, Capacity>::INVALID_NODE;
+
+template <typename Value, uint64_t Capacity>
+inline bool HashMultiIndex<Value, Capacity>::Bucket::isUsed() const noexcept
+{
+    return firstNode != INVALID_NODE;
+}
+
+template <typename Value, uint64_t Capacity>
+inline HashMultiIndex<Value, Capacity>::HashMultiIndex() noexcept
+{
+    // all nodes are linked in the free list
+    for (uint32_t i = 0U; i < Capacity - 1U; ++i)
+    {
+        m_nodes[i].next = i + 1U;
+    }
+}
+
+template <typename Value, uint64_t Capacity>
+template <typename HasKey>
+inline uint64_t HashMultiIndex<Value, Capacity>::findBucket(const uint64_t hash, const HasKey& hasKey) const noexcept
+{
+    // there are more buckets than values, therefore every probe sequence ends at an unused bucket
+    for (uint64_t index = hash & BUCKET_MASK;; index = (index + 1U) & BUCKET_MASK)
+    {
+        const auto& bucket = m_buckets[index];
+        if (!bucket.isUsed())
+        {
+            return NUMBER_OF_BUCKETS;
+        }
+        if (bucket.hash == hash && hasKey(m_nodes[bucket.firstNode].value))
+        {
+            return index;
+        }
+    }
+}
+
+template <typename Value, uint64_t Capacity>
+template <typename HasKey>
+inline bool
+HashMultiIndex<Value, Capacity>::insert(const uint64_t hash, const Value& value, const HasKey& hasKey) noexcept
+{
+    if (m_freeNode == INVALID_NODE)
+    {
+        return false;
+    }
+
+    const uint32_t node = m_freeNode;
+    m_freeNode = m_nodes[node].next;
+    m_nodes[node].value = value;
+    m_nodes[node].next = INVALID_NODE;
+    ++m_size;
+
+    auto index = findBucket(hash, hasKey);
+    if (index != NUMBER_OF_BUCKETS)
+    {
+        auto& bucket = m_buckets[index];
+        m_nodes[bucket.lastNode].next = node;
+        bucket.lastNode = node;
+        ++bucket.numberOfValues;
+        return true;
+    }
+
+    index = hash & BUCKET_MASK;
+    while (m_buckets[index].isUsed())
+    {
+        index = (index + 1U) & BUCKET_MASK;
+    }
+    auto& bucket = m_buckets[index];
+    bucket.hash = hash;
+    bucket.firstNode = node;
+    bucket.lastNode = node;
+    bucket.numberOfValues = 1U;
+    return true;
+}
+
+template <typename Value, uint64_t Capacity>
+template <typename HasKey>
+inline bool
+HashMultiIndex<Value, Capacity>::erase(const uint64_t hash, const Value& value, const HasKey& hasKey) noexcept
+{
+    const auto index = findBucket(hash, hasKey);
+    if (index == NUMBER_OF_BUCKETS)
+    {
+        return false;
+    }
+
+    auto& bucket = m_buckets[index];
+    uint32_t previousNode = INVALID_NODE;
+    for (uint32_t node = bucket.firstNode; node != INVALID_NODE; node = m_nodes[node].next)
+    {
+        if (m_nodes[node].value == value)
+        {
+            const uint32_t nextNode = m_nodes[node].next;
+            if (previousNode == INVALID_NODE)
+            {
+                bucket.firstNode = nextNode;
+            }
+            else
+            {
+                m_nodes[previousNode].next = nextNode;
+            }
+            if (bucket.lastNode == node)
+            {
+                bucket.lastNode = previousNode;
+            }
+
+            m_nodes[node].value = Value{};
+            m_nodes[node].next = m_freeNode;
+            m_freeNode = node;
+            --m_size;
+
+            if (--bucket.numberOfValues == 0U)
+            {
+                releaseBucket(index);
+            }
+            return true;
+        }
+        previousNode = node;
+    }
+    return false;
+}
+
+template <typename Value, uint64_t Capacity>
+inline void HashMultiIndex<Value, Capacity>::releaseBucket(uint64_t index) noexcept
+{
+    m_buckets[index] = Bucket{};
+
+    for (uint64_t next = (index + 1U) & BUCKET_MASK; m_buckets[next].isUsed(); next = (next + 1U) & BUCKET_MASK)
+    {
+        // the bucket can stay when its preferred position lies cyclically in (index, next], otherwise it would not
+        // be found anymore since the probe sequence from its preferred position now stops at the released bucket
+        const uint64_t preferred = m_buckets[next].hash & BUCKET_MASK;
+        const bool canStay =
+            (index <= next) ? (index < preferred && preferred <= next) : (index < preferred || preferred <= next);
+        if (!canStay)
+        {
+            m_buckets[index] = m_buckets[next];
+            m_buckets[next] = Bucket{};
+            index = next;
+        }
+    }
+}
+
+template <typename Value, uint64_t Capacity>
+template <typename HasKey, typename Callable>
+inline void HashMultiIndex<Value, Capacity>::forEach(const uint64_t hash,
+                                                     const HasKey& hasKey,
+                                                     const Callable& callable) const noexcept
+{
+    const auto index = findBucket(hash, hasKey);
+    if (index == NUMBER_OF_BUCKETS)
+    {
+        return;
+    }
+
+    for (uint32_t node = m_buckets[index].firstNode; node != INVALID_NODE; node = m_nodes[node].next)
+    {
+        callable(m_nodes[node].value);
+    }
+}
+
+template <typename Value, uint64_t Capacity>
+template <typename HasKey>
+inline uint64_t HashMultiIndex<Value, Capacity>::count(const uint64_t hash, const HasKey& hasKey) const noexcept
+{
+    const auto index = findBucket(hash, hasKey);
+    return (index == NUMBER_OF_BUCKETS) ? 0U : m_buckets[index].numberOfValues;
+}
+
+template <typename Value, uint64_t Capacity>
+inline uint64_t HashMultiIndex<Value, Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_HASH_MULTI_INDEX_INL
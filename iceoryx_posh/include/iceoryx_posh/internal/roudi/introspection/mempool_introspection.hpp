@@ -76,15 +76,17 @@ class MemPoolIntrospection
     PublisherPort m_publisherPort{nullptr};
     void send() noexcept;
 
+    /// @brief copy data fro internal struct into interface struct
+    void copyMemPoolInfo(const MemoryManager& memoryManager,
+                         const uint32_t numaNode,
+                         MemPoolInfoContainer& dest) noexcept;
+
   private:
     static void prepareIntrospectionSample(MemPoolIntrospectionInfo& sample,
                                            const posix::PosixGroup& readerGroup,
                                            const posix::PosixGroup& writerGroup,
                                            uint32_t id) noexcept;
 
-    /// @brief copy data fro internal struct into interface struct
-    void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
-
   private:
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
     concurrent::PeriodicTask<function<void()>> m_publishingTask{
@@ -108,7 +108,8 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                                        posix::PosixGroup::getGroupOfCurrentProcess(),
                                        posix::PosixGroup::getGroupOfCurrentProcess(),
                                        id);
-            copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
+            copyMemPoolInfo(
+                *m_rouDiInternalMemoryManager, mepoo::MemoryInfo::NO_NUMA_NODE, memPoolIntrospectionInfo.m_mempoolInfo);
             ++id;
 
             // User shm segments
@@ -119,7 +120,9 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                     auto& memPoolIntrospectionInfo = sample->back();
                     prepareIntrospectionSample(
                         memPoolIntrospectionInfo, segment.getReaderGroup(), segment.getWriterGroup(), id);
-                    copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo);
+                    copyMemPoolInfo(segment.getMemoryManager(),
+                                    segment.getMemoryInfo().getNumaNode(),
+                                    memPoolIntrospectionInfo.m_mempoolInfo);
                 }
                 else
                 {
@@ -149,6 +152,7 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
 inline void
 MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolInfo(const MemoryManager& memoryManager,
+                                                                                    const uint32_t numaNode,
                                                                                     MemPoolInfoContainer& dest) noexcept
 {
     auto numOfMemPools = memoryManager.getNumberOfMemPools();
@@ -158,10 +162,12 @@ MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolI
         auto src = memoryManager.getMemPoolInfo(i);
         auto& dst = dest[i];
         dst.m_usedChunks = src.m_usedChunks;
+        dst.m_cachedChunks = src.m_cachedChunks;
         dst.m_minFreeChunks = src.m_minFreeChunks;
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+        dst.m_numaNode = numaNode;
     }
 }
 
@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/function.hpp"
 
@@ -181,6 +182,10 @@ class PortIntrospection
 
         void prepareTopic(SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept;
 
+        /// @brief prepare the latency topic and reset the latency histograms of the subscribers
+        /// @param[out] topic data structure to be prepared for sending
+        void prepareTopic(SubscriberLatencyIntrospectionFieldTopic& topic) noexcept;
+
         /// @brief compute the next connection state based on the current connection state and a capro message type when
         /// the communication policy is OneToMany
         /// @param[in] currentState current connection state (e.g. CONNECTED)
@@ -282,7 +287,8 @@ class PortIntrospection
     /// @return true if registration was successful, false otherwise
     bool registerPublisherPort(PublisherPort&& publisherPortGeneric,
                                PublisherPort&& publisherPortThroughput,
-                               PublisherPort&& publisherPortSubscriberPortsData) noexcept;
+                               PublisherPort&& publisherPortSubscriberPortsData,
+                               PublisherPort&& publisherPortSubscriberLatency) noexcept;
 
     /// @brief set the time interval used to send new introspection data
     /// @param[in] interval duration between two send invocations
@@ -305,13 +311,17 @@ class PortIntrospection
     /// @brief sends the subscriberport changing data, this is used from the unittests
     void sendSubscriberPortsData() noexcept;
 
-    /// @brief calls the three specific send functions from above, this is used from the periodic task
+    /// @brief sends the subscriber latency data, this is used from the unittests
+    void sendSubscriberLatencyData() noexcept;
+
+    /// @brief calls the four specific send functions from above, this is used from the periodic task
     void send() noexcept;
 
   protected:
     optional<PublisherPort> m_publisherPort;
     optional<PublisherPort> m_publisherPortThroughput;
     optional<PublisherPort> m_publisherPortSubscriberPortsData;
+    optional<PublisherPort> m_publisherPortSubscriberLatency;
 
   private:
     PortData m_portData;
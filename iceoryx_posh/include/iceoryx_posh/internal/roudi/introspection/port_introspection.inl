@@ -57,9 +57,11 @@ template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerPublisherPort(
     PublisherPort&& publisherPortGeneric,
     PublisherPort&& publisherPortThroughput,
-    PublisherPort&& publisherPortSubscriberPortsData) noexcept
+    PublisherPort&& publisherPortSubscriberPortsData,
+    PublisherPort&& publisherPortSubscriberLatency) noexcept
 {
-    if (m_publisherPort || m_publisherPortThroughput || m_publisherPortSubscriberPortsData)
+    if (m_publisherPort || m_publisherPortThroughput || m_publisherPortSubscriberPortsData
+        || m_publisherPortSubscriberLatency)
     {
         return false;
     }
@@ -67,6 +69,7 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerPublisherP
     m_publisherPort.emplace(std::move(publisherPortGeneric));
     m_publisherPortThroughput.emplace(std::move(publisherPortThroughput));
     m_publisherPortSubscriberPortsData.emplace(std::move(publisherPortSubscriberPortsData));
+    m_publisherPortSubscriberLatency.emplace(std::move(publisherPortSubscriberLatency));
 
     return true;
 }
@@ -77,14 +80,17 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::run() noexcept
     cxx::Expects(m_publisherPort.has_value());
     cxx::Expects(m_publisherPortThroughput.has_value());
     cxx::Expects(m_publisherPortSubscriberPortsData.has_value());
+    cxx::Expects(m_publisherPortSubscriberLatency.has_value());
 
     // this is a field, there needs to be a sample before activate is called
     sendPortData();
     sendThroughputData();
     sendSubscriberPortsData();
+    sendSubscriberLatencyData();
     m_publisherPort->offer();
     m_publisherPortThroughput->offer();
     m_publisherPortSubscriberPortsData->offer();
+    m_publisherPortSubscriberLatency->offer();
 
     m_publishingTask.start(m_sendInterval);
 }
@@ -98,6 +104,7 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::send() noexcept
     }
     sendThroughputData();
     sendSubscriberPortsData();
+    sendSubscriberLatencyData();
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -157,6 +164,26 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPort
     }
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberLatencyData() noexcept
+{
+    auto maybeChunkHeader =
+        m_publisherPortSubscriberLatency->tryAllocateChunk(sizeof(SubscriberLatencyIntrospectionFieldTopic),
+                                                           alignof(SubscriberLatencyIntrospectionFieldTopic),
+                                                           CHUNK_NO_USER_HEADER_SIZE,
+                                                           CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (!maybeChunkHeader.has_error())
+    {
+        auto subscriberLatencySample =
+            static_cast<SubscriberLatencyIntrospectionFieldTopic*>(maybeChunkHeader.value()->userPayload());
+        new (subscriberLatencySample) SubscriberLatencyIntrospectionFieldTopic();
+
+        m_portData.prepareTopic(*subscriberLatencySample); // requires internal mutex (blocks
+        // further introspection events)
+        m_publisherPortSubscriberLatency->sendChunk(maybeChunkHeader.value());
+    }
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::setSendInterval(const units::Duration interval) noexcept
 {
@@ -622,6 +649,41 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
     }
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
+    SubscriberLatencyIntrospectionFieldTopic& topic) noexcept
+{
+    constexpr double P50{0.5};
+    constexpr double P99{0.99};
+    constexpr double P999{0.999};
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& connPair : m_connectionMap)
+    {
+        for (auto& pair : connPair.second)
+        {
+            auto connectionIndex = pair.second;
+            if (connectionIndex >= 0)
+            {
+                auto& subscriberInfo = m_connectionContainer[connectionIndex].subscriberInfo;
+                SubscriberLatencyData latencyData;
+                if (subscriberInfo.portData != nullptr)
+                {
+                    popo::LatencyHistogramSnapshot snapshot;
+                    subscriberInfo.portData->m_chunkReceiverData.m_latencyHistogram.collect(snapshot);
+
+                    latencyData.m_numberOfSamples = snapshot.numberOfSamples();
+                    latencyData.m_p50LatencyInNanoseconds = snapshot.percentile(P50);
+                    latencyData.m_p99LatencyInNanoseconds = snapshot.percentile(P99);
+                    latencyData.m_p999LatencyInNanoseconds = snapshot.percentile(P999);
+                    latencyData.m_maxLatencyInNanoseconds = snapshot.maxLatency();
+                }
+                topic.m_latencyList.push_back(latencyData);
+            }
+        }
+    }
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::isNew() const noexcept
 {
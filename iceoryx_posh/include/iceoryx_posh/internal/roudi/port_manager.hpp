@@ -198,17 +198,27 @@ class PortManager
 
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
-    void publishServiceRegistry() const noexcept;
+    /// @brief publishes a full copy of the service registry which is used by the applications which missed changes
+    void publishServiceRegistry() noexcept;
+
+    /// @brief publishes a change of the service registry and a full copy after every SNAPSHOT_INTERVAL changes
+    void publishServiceRegistryChange(const ServiceRegistry::Change::Operation operation,
+                                      const capro::ServiceDescription& service) noexcept;
 
     const ServiceRegistry& serviceRegistry() const noexcept;
 
   private:
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
+    /// @brief serializes the public methods since they modify the port pool and the service registry or run the
+    /// discovery; the rest of a request from a runtime, e.g. parsing and answering it, is done without this lock
+    std::mutex m_portPoolMutex;
     PortPool* m_portPool{nullptr};
     ServiceRegistry m_serviceRegistry;
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryChangePublisherPortData;
+    ServiceRegistry::Generation_t m_serviceRegistrySnapshotGeneration{0U};
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
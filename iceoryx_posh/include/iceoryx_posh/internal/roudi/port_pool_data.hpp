@@ -63,6 +63,9 @@ struct PortPoolData
 
     FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
     FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
+
+    /// @brief is notified by the ports when RouDi has to run the discovery
+    popo::ConditionVariableData m_discoveryConditionVariable{RuntimeName_t(IPC_CHANNEL_ROUDI_NAME)};
 };
 
 } // namespace roudi
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
@@ -60,6 +61,8 @@ class Process
 
     void sendViaIpcChannel(const runtime::IpcMessage& data) noexcept;
 
+    void sendViaIpcChannel(const runtime::IpcBinaryMessage& data) noexcept;
+
     /// @brief The session ID which is used to check outdated IPC channel transmissions for this process
     /// @return the session ID for this process
     uint64_t getSessionId() noexcept;
@@ -30,6 +30,8 @@
 
 #include <cstdint>
 #include <ctime>
+#include <mutex>
+#include <shared_mutex>
 
 namespace iox
 {
@@ -43,6 +45,8 @@ class ProcessManagerInterface
     virtual ~ProcessManagerInterface() noexcept = default;
 };
 
+/// @brief Manages the processes which are registered at RouDi. The methods can be called concurrently, the requests of
+/// different processes are processed in parallel while the registration and removal of processes are exclusive.
 class ProcessManager : public ProcessManagerInterface
 {
   public:
@@ -144,23 +148,73 @@ class ProcessManager : public ProcessManagerInterface
                              const popo::ServerOptions& serverOptions,
                              const PortConfigInfo& portConfigInfo) noexcept;
 
+    /// @brief Adds all ports which are requested by a binary CREATE_PORTS message and sends one response with an
+    /// entry for each port to the OS process
+    /// @param[in] name is the name of the runtime requesting the ports
+    /// @param[in] request with an entry for each port; the entries are read from the message
+    void addPortsForProcess(const RuntimeName_t& name, runtime::IpcBinaryMessage& request) noexcept;
+
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
     void run() noexcept;
 
+    /// @brief Runs the discovery for the ports which requested it, without monitoring the processes
+    void discoveryUpdate() noexcept override;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
-    void sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept;
+    /// @param[in] name of the runtime which sent the message
+    /// @param[in] encoding of the unsupported message, the notification is sent with the same encoding
+    void sendMessageNotSupportedToRuntime(const RuntimeName_t& name,
+                                          const runtime::IpcMessageEncoding encoding =
+                                              runtime::IpcMessageEncoding::TEXT) noexcept;
 
 
   private:
     optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
     void monitorProcesses() noexcept;
-    void discoveryUpdate() noexcept override;
+
+    /// @brief Reads the next entry of a CREATE_PORTS request and acquires the requested port
+    /// @param[in] process which requested the port
+    /// @param[in] request from which the entry is read
+    /// @param[out] ackType is set to the acknowledge type of the requested port, NOTYPE for an unknown entry
+    /// @return the offset of the port data or the error which shall be sent to the process
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType> acquirePortForProcess(
+        Process& process, runtime::IpcBinaryMessage& request, runtime::IpcMessageType& ackType) noexcept;
+
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquireSubscriberForProcess(Process& process,
+                                const capro::ServiceDescription& service,
+                                const popo::SubscriberOptions& subscriberOptions,
+                                const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquirePublisherForProcess(Process& process,
+                               const capro::ServiceDescription& service,
+                               const popo::PublisherOptions& publisherOptions,
+                               const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquireClientForProcess(Process& process,
+                            const capro::ServiceDescription& service,
+                            const popo::ClientOptions& clientOptions,
+                            const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquireServerForProcess(Process& process,
+                            const capro::ServiceDescription& service,
+                            const popo::ServerOptions& serverOptions,
+                            const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief Sends the result of a text port creation request to the process
+    void sendPortCreationResponse(
+        Process& process,
+        const runtime::IpcMessageType ackType,
+        const expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>& result) noexcept;
 
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
     /// @param [in] pid is the host system process id
@@ -226,6 +280,9 @@ class ProcessManager : public ProcessManagerInterface
     mepoo::SegmentManager<>* m_segmentManager{nullptr};
     mepoo::MemoryManager* m_introspectionMemoryManager{nullptr};
     segment_id_underlying_t m_mgmtSegmentId{UntypedRelativePointer::NULL_POINTER_ID};
+    /// @brief is locked exclusively when processes are added or removed and shared when a request of a process is
+    /// handled; the requests of a single process are expected to be handled sequentially
+    std::shared_timed_mutex m_processListMutex;
     ProcessList_t m_processList;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
@@ -17,20 +17,24 @@
 #ifndef IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 #define IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 
-#include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_platform/file.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iox/scope_guard.hpp"
+#include "iox/vector.hpp"
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <mutex>
 #include <thread>
 
 namespace iox
@@ -57,12 +61,14 @@ class RouDi
             const bool killProcessesInDestructor = true,
             const RuntimeMessagesThreadStart RuntimeMessagesThreadStart = RuntimeMessagesThreadStart::IMMEDIATE,
             const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
-            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY) noexcept
+            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY,
+            const uint32_t numberOfRuntimeMessagesWorkers = roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGES_WORKERS) noexcept
             : m_monitoringMode(monitoringMode)
             , m_killProcessesInDestructor(killProcessesInDestructor)
             , m_runtimesMessagesThreadStart(RuntimeMessagesThreadStart)
             , m_compatibilityCheckLevel(compatibilityCheckLevel)
             , m_processKillDelay(processKillDelay)
+            , m_numberOfRuntimeMessagesWorkers(numberOfRuntimeMessagesWorkers)
         {
         }
 
@@ -71,6 +77,9 @@ class RouDi
         const RuntimeMessagesThreadStart m_runtimesMessagesThreadStart;
         const version::CompatibilityCheckLevel m_compatibilityCheckLevel;
         const units::Duration m_processKillDelay;
+        /// @brief number of threads which process the messages of the runtimes; with one worker the messages are
+        /// processed by the thread which receives them
+        const uint32_t m_numberOfRuntimeMessagesWorkers;
     };
 
     RouDi& operator=(const RouDi& other) = delete;
@@ -92,6 +101,10 @@ class RouDi
     ///
     /// @note Intentionally not virtual to be able to call it in derived class
     void shutdown() noexcept;
+
+    /// @brief Processes a message from a runtime
+    /// @note is called concurrently by the workers for messages of different runtimes, the messages of one runtime
+    /// are processed in the order they were received
     virtual void processMessage(const runtime::IpcMessage& message,
                                 const iox::runtime::IpcMessageType& cmd,
                                 const RuntimeName_t& runtimeName) noexcept;
@@ -122,8 +135,39 @@ class RouDi
     static uint64_t getUniqueSessionIdForProcess() noexcept;
 
   private:
+    /// @brief a message received from a runtime, depending on the encoding either the text or the binary message is set
+    struct RuntimeMessage
+    {
+        runtime::IpcMessageEncoding encoding{runtime::IpcMessageEncoding::TEXT};
+        runtime::IpcMessage text;
+        runtime::IpcBinaryMessage binary;
+    };
+
+    /// @brief a worker with its queue of received messages
+    struct RuntimeMessagesWorker
+    {
+        std::mutex mutex;
+        std::condition_variable messageAvailable;
+        std::deque<RuntimeMessage> messages;
+        std::thread thread;
+    };
+
     void processRuntimeMessages() noexcept;
 
+    void dispatchRuntimeMessage(RuntimeMessage&& message) noexcept;
+
+    void processRuntimeMessagesOfWorker(RuntimeMessagesWorker& worker) noexcept;
+
+    void processRuntimeMessage(RuntimeMessage& message) noexcept;
+
+    /// @brief Handles the binary messages of the runtimes
+    /// @param[in] message binary message which was received; the payload is read from the message
+    void processBinaryMessage(runtime::IpcBinaryMessage& message) noexcept;
+
+    void startRuntimeMessagesWorkers() noexcept;
+
+    void stopRuntimeMessagesWorkers() noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
@@ -145,11 +189,15 @@ class RouDi
         };
     }};
     PortManager* m_portManager{nullptr};
-    concurrent::smart_lock<ProcessManager> m_prcMgr;
+    /// @note the ProcessManager synchronizes the access to the processes and ports itself, this allows the workers
+    /// to process the messages of different runtimes in parallel
+    ProcessManager m_prcMgr;
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
     std::thread m_handleRuntimeMessageThread;
+    uint32_t m_numberOfRuntimeMessagesWorkers{1U};
+    vector<RuntimeMessagesWorker, MAX_NUMBER_OF_RUNTIME_MESSAGES_WORKERS> m_runtimeMessagesWorkers;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
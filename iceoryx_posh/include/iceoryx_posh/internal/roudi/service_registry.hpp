@@ -19,12 +19,14 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/hash_multi_index.hpp"
 #include "iox/expected.hpp"
 #include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
 
+#include <algorithm>
 #include <cstdint>
 #include <utility>
 
@@ -42,7 +44,15 @@ class ServiceRegistry
 
     static constexpr uint32_t CAPACITY = iox::SERVICE_REGISTRY_CAPACITY;
 
+    /// @brief the number of the latest changes which are kept by RouDi for late joining or slow applications
+    static constexpr uint64_t CHANGE_HISTORY_CAPACITY =
+        std::min(iox::MAX_PUBLISHER_HISTORY, static_cast<uint64_t>(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+    /// @brief RouDi publishes a full copy of the registry after this number of changes; it is smaller than the
+    ///        change history, therefore the changes since the latest copy are always in the change history
+    static constexpr uint64_t SNAPSHOT_INTERVAL = CHANGE_HISTORY_CAPACITY / 2U;
+
     using ReferenceCounter_t = uint64_t;
+    using Generation_t = uint64_t;
 
     struct ServiceDescriptionEntry
     {
@@ -56,6 +66,29 @@ class ServiceRegistry
         ReferenceCounter_t serverCount{0U};
     };
 
+    /// @brief A single modification of the registry. Applying the changes of RouDi's registry in the order of their
+    ///        generation to a copy of the registry results in the same registry.
+    struct Change
+    {
+        enum class Operation : uint8_t
+        {
+            ADD_PUBLISHER,
+            REMOVE_PUBLISHER,
+            ADD_SERVER,
+            REMOVE_SERVER,
+            PURGE
+        };
+
+        Change(const Generation_t generation,
+               const Operation operation,
+               const capro::ServiceDescription& serviceDescription) noexcept;
+
+        /// @brief the generation of the registry after the change was applied
+        Generation_t generation;
+        Operation operation;
+        capro::ServiceDescription serviceDescription;
+    };
+
     /// @brief Adds a given publisher service description to registry
     /// @param[in] serviceDescription, service to be added
     /// @return ServiceRegistryError, error wrapped in expected
@@ -81,7 +114,8 @@ class ServiceRegistry
     /// @param[in] serviceDescription, service to be removed
     void purge(const capro::ServiceDescription& serviceDescription) noexcept;
 
-    /// @brief Searches for given service description in registry
+    /// @brief Searches for given service description in registry; without wildcards the service description is
+    ///        looked up in the index, with wildcards the entries of the most selective provided string are filtered
     /// @param[in] service, string or wildcard (= iox::nullopt) to search for
     /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
     /// @param[in] event, string or wildcard (= iox::nullopt) to search for
@@ -96,22 +130,44 @@ class ServiceRegistry
     /// @note Can be used to obtain all entries or count them
     void forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
 
+    /// @brief Returns the generation of the registry which is incremented with every modification
+    Generation_t generation() const noexcept;
+
+    /// @brief Applies a change of another registry
+    /// @param[in] change to apply, it must have the generation which follows the current one
+    /// @return true if the change was applied, false if the generation does not follow the current one
+    bool apply(const Change& change) noexcept;
+
   private:
     using Entry_t = optional<ServiceDescriptionEntry>;
     using ServiceDescriptionContainer_t = vector<Entry_t, CAPACITY>;
 
+    using Index_t = HashMultiIndex<uint32_t, CAPACITY>;
+
     static constexpr uint32_t NO_INDEX = CAPACITY;
 
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
+    // the indices contain the positions of the entries in m_serviceDescriptions; the service description index is
+    // the primary one, the indices of the single strings are used for searches with wildcards
+    Index_t m_serviceDescriptionIndex;
+    Index_t m_serviceIndex;
+    Index_t m_instanceIndex;
+    Index_t m_eventIndex;
+
     // store the last known free Index (if any is known)
     // we could use a queue (or stack) here since they are not optimal
     // for the filling pattern of a vector (prefer entries close to the front)
     uint32_t m_freeIndex{NO_INDEX};
 
+    Generation_t m_generation{0U};
+
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
+    void addToIndices(const uint32_t index) noexcept;
+    void removeFromIndices(const uint32_t index) noexcept;
+    void removeEntry(const uint32_t index) noexcept;
 
     expected<Error> add(const capro::ServiceDescription& serviceDescription,
                         ReferenceCounter_t ServiceDescriptionEntry::*count);
@@ -0,0 +1,175 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
+#define IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/string.hpp"
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Fixed-layout binary message for the IPC channels between the runtimes and RouDi. In contrast to the
+///        IpcMessage no heap memory is used and the values are copied into the message without string conversions.
+/// @details
+///    A message starts with a header which consists of MAGIC, the protocol version, the number of entries and the
+///    message type, followed by the runtime name of the sender. The layout of the header and the runtime name is the
+///    same for all protocol versions, this allows RouDi to answer messages with an unsupported protocol version.
+///    The header is followed by the payload, which is written with operator<< and read in the same order with
+///    operator>>. Arithmetic values and enums are stored with their in-memory representation, strings are stored
+///    with a 16 bit length followed by the characters. Since both sides are on the same machine no conversion of the
+///    byte order is required.
+///
+///    Several requests can be packed into one message, each of them is started with addEntry and the receiver reads
+///    getNumberOfEntries requests.
+///
+///    The message becomes invalid when its capacity is exceeded or when more is read than was written.
+class IpcBinaryMessage
+{
+  public:
+    /// @brief starts every binary message; it does not consist of printable characters and therefore a binary
+    ///        message cannot be mistaken for an IpcMessage
+    static constexpr uint32_t MAGIC{0xB1C0FFEEU};
+    static constexpr uint16_t PROTOCOL_VERSION{1U};
+    static constexpr uint64_t CAPACITY{ROUDI_MESSAGE_SIZE};
+
+    /// @brief Creates an empty and invalid message which can be filled with setMessage
+    IpcBinaryMessage() noexcept = default;
+
+    /// @brief Creates a valid message with the header and the runtime name
+    /// @param[in] messageType type of the message
+    /// @param[in] runtimeName of the sender
+    IpcBinaryMessage(const IpcMessageType messageType, const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Appends an arithmetic value or an enum to the message
+    /// @param[in] value to append
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value, IpcBinaryMessage&>::type
+    operator<<(const T value) noexcept;
+
+    /// @brief Appends a string to the message
+    /// @param[in] value to append
+    template <uint64_t Capacity>
+    IpcBinaryMessage& operator<<(const string<Capacity>& value) noexcept;
+
+    IpcBinaryMessage& operator<<(const capro::ServiceDescription& value) noexcept;
+    IpcBinaryMessage& operator<<(const popo::PublisherOptions& value) noexcept;
+    IpcBinaryMessage& operator<<(const popo::SubscriberOptions& value) noexcept;
+    IpcBinaryMessage& operator<<(const popo::ClientOptions& value) noexcept;
+    IpcBinaryMessage& operator<<(const popo::ServerOptions& value) noexcept;
+    IpcBinaryMessage& operator<<(const PortConfigInfo& value) noexcept;
+
+    /// @brief Reads the next arithmetic value or enum from the message
+    /// @param[out] value which was read, it is unchanged when the message has not enough data left
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value, IpcBinaryMessage&>::type
+    operator>>(T& value) noexcept;
+
+    /// @brief Reads the next string from the message, the message becomes invalid if the string does not fit into
+    ///        the provided one
+    /// @param[out] value which was read
+    template <uint64_t Capacity>
+    IpcBinaryMessage& operator>>(string<Capacity>& value) noexcept;
+
+    IpcBinaryMessage& operator>>(capro::ServiceDescription& value) noexcept;
+    IpcBinaryMessage& operator>>(popo::PublisherOptions& value) noexcept;
+    IpcBinaryMessage& operator>>(popo::SubscriberOptions& value) noexcept;
+    IpcBinaryMessage& operator>>(popo::ClientOptions& value) noexcept;
+    IpcBinaryMessage& operator>>(popo::ServerOptions& value) noexcept;
+    IpcBinaryMessage& operator>>(PortConfigInfo& value) noexcept;
+
+    /// @brief Starts a new entry in the message by appending its type and increments the number of entries
+    /// @param[in] entryType type of the entry, e.g. IpcMessageType::CREATE_PUBLISHER
+    IpcBinaryMessage& addEntry(const IpcMessageType entryType) noexcept;
+
+    /// @brief Returns the number of entries which were added with addEntry
+    uint16_t getNumberOfEntries() const noexcept;
+
+    /// @brief Returns the type of the message
+    IpcMessageType getMessageType() const noexcept;
+
+    /// @brief Returns the protocol version of the sender
+    uint16_t getProtocolVersion() const noexcept;
+
+    /// @brief Returns the runtime name of the sender
+    RuntimeName_t getRuntimeName() const noexcept;
+
+    /// @brief Returns the number of bytes which can still be appended to the message
+    uint64_t getFreeCapacity() const noexcept;
+
+    /// @brief Returns true if the message has the current protocol version and all write and read operations
+    ///        succeeded, otherwise false
+    bool isValid() const noexcept;
+
+    /// @brief Returns the raw bytes of the message which shall be transferred
+    const char* data() const noexcept;
+
+    /// @brief Returns the number of raw bytes of the message
+    uint64_t size() const noexcept;
+
+    /// @brief Replaces the message with the received raw bytes and starts reading after the runtime name
+    /// @param[in] data received bytes
+    /// @param[in] size number of received bytes
+    /// @return true if the bytes contain a header and a runtime name, otherwise false. An unsupported protocol version
+    ///         is not an error in this case but the message is invalid afterwards.
+    bool setMessage(const char* const data, const uint64_t size) noexcept;
+
+    /// @brief Checks if the raw bytes start with MAGIC
+    /// @param[in] data received bytes
+    /// @param[in] size number of received bytes
+    static bool isBinaryMessage(const char* const data, const uint64_t size) noexcept;
+
+  private:
+    struct Header
+    {
+        uint32_t magic{MAGIC};
+        uint16_t version{PROTOCOL_VERSION};
+        uint16_t numberOfEntries{0U};
+        std::underlying_type<IpcMessageType>::type messageType{0};
+    };
+
+    void write(const void* const source, const uint64_t size) noexcept;
+    void read(void* const destination, const uint64_t size) noexcept;
+    Header header() const noexcept;
+
+  private:
+    static constexpr uint64_t HEADER_SIZE{sizeof(Header)};
+    static constexpr uint64_t RUNTIME_NAME_POSITION{HEADER_SIZE};
+
+    std::array<char, CAPACITY> m_data{};
+    uint64_t m_size{0U};
+    uint64_t m_readPosition{0U};
+    bool m_isValid{false};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.inl"
+
+#endif // IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
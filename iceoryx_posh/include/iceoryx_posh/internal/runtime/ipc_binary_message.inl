@@ -0,0 +1,72 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_INL
+#define IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_INL
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+
+#include <limits>
+
+namespace iox
+{
+namespace runtime
+{
+template <typename T>
+inline typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value, IpcBinaryMessage&>::type
+IpcBinaryMessage::operator<<(const T value) noexcept
+{
+    write(&value, sizeof(T));
+    return *this;
+}
+
+template <uint64_t Capacity>
+inline IpcBinaryMessage& IpcBinaryMessage::operator<<(const string<Capacity>& value) noexcept
+{
+    static_assert(Capacity <= std::numeric_limits<uint16_t>::max(), "The string length must fit into 16 bit");
+    const auto length = static_cast<uint16_t>(value.size());
+    write(&length, sizeof(length));
+    write(value.c_str(), length);
+    return *this;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value, IpcBinaryMessage&>::type
+IpcBinaryMessage::operator>>(T& value) noexcept
+{
+    read(&value, sizeof(T));
+    return *this;
+}
+
+template <uint64_t Capacity>
+inline IpcBinaryMessage& IpcBinaryMessage::operator>>(string<Capacity>& value) noexcept
+{
+    uint16_t length{0U};
+    read(&length, sizeof(length));
+    if (!m_isValid || length > Capacity || m_readPosition + length > m_size)
+    {
+        m_isValid = false;
+        return *this;
+    }
+
+    value = string<Capacity>(TruncateToCapacity, m_data.data() + m_readPosition, length);
+    m_readPosition += length;
+    return *this;
+}
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_INL
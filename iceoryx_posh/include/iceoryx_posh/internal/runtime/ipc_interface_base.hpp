@@ -28,6 +28,7 @@
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iox/deadline_timer.hpp"
 #include "iox/duration.hpp"
+#include "iox/optional.hpp"
 #include "iox/relative_pointer.hpp"
 
 #include "iceoryx_dust/posix_wrapper/message_queue.hpp"
@@ -85,6 +86,8 @@ enum class IpcMessageType : int32_t
     WAKEUP_TRIGGER,
     REPLAY,
     MESSAGE_NOT_SUPPORTED,
+    CREATE_PORTS,
+    CREATE_PORTS_ACK,
     // etc..
     END,
 };
@@ -117,9 +120,19 @@ enum class IpcMessageErrorType : int32_t
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
     NODE_DATA_LIST_FULL,
+    /// The request of a PortCreationBatch was not yet sent to RouDi
+    PORT_CREATION_NOT_REQUESTED,
     END,
 };
 
+/// @brief The encoding of a received message
+enum class IpcMessageEncoding : uint8_t
+{
+    /// @brief IpcMessage with separator separated strings
+    TEXT,
+    /// @brief IpcBinaryMessage
+    BINARY
+};
 
 /// @brief Converts a string to the message type enumeration
 /// @param[in] str string to convert
@@ -138,6 +151,7 @@ std::string IpcMessageErrorTypeToString(const IpcMessageErrorType msg) noexcept;
 
 class IpcInterfaceUser;
 class IpcInterfaceCreator;
+class IpcBinaryMessage;
 
 /// @brief Class should never be used by the end-user.
 ///     Handles the common properties and methods for the IpcChannelType. The handling of
@@ -185,6 +199,39 @@ class IpcInterface
     ///             otherwise if the message was invalid it will return false.
     bool timedSend(const IpcMessage& msg, const units::Duration timeout) const noexcept;
 
+    /// @brief Receives a binary message from the IPC channel and stores it in answer.
+    /// @param[out] answer If a message is received it is stored there.
+    /// @return If the call failed or no valid binary message was received it returns false, otherwise true.
+    bool receive(IpcBinaryMessage& answer) const noexcept;
+
+    /// @brief Tries to receive a binary message from the IPC channel within a specified timeout.
+    /// @param[in] timeout for receiving a message.
+    /// @param[out] answer If a message is received it is stored there.
+    /// @return If a valid binary message was received before the timeout occures it returns true, otherwise false.
+    bool timedReceive(const units::Duration timeout, IpcBinaryMessage& answer) const noexcept;
+
+    /// @brief Tries to receive either a text or a binary message from the IPC channel within a specified timeout.
+    /// @param[in] timeout for receiving a message.
+    /// @param[out] textMessage is set when an IpcMessage was received
+    /// @param[out] binaryMessage is set when an IpcBinaryMessage was received, it can be invalid if the sender uses
+    ///             an unsupported protocol version
+    /// @return the encoding of the received message, nullopt if no message was received before the timeout or the
+    ///         received text message is invalid
+    optional<IpcMessageEncoding> timedReceive(const units::Duration timeout,
+                                              IpcMessage& textMessage,
+                                              IpcBinaryMessage& binaryMessage) const noexcept;
+
+    /// @brief Tries to send the binary message specified in msg.
+    /// @param[in] msg Must be a valid message, if its an invalid message send will return false
+    /// @return If a valid message was send it returns true, otherwise false.
+    bool send(const IpcBinaryMessage& msg) const noexcept;
+
+    /// @brief Tries to send the binary message specified in msg within a specified timeout.
+    /// @param[in] msg Must be a valid message, if its an invalid message send will return false
+    /// @param[in] timeout specifies the duration to wait for sending.
+    /// @return If a valid message was send it returns true, otherwise false.
+    bool timedSend(const IpcBinaryMessage& msg, const units::Duration timeout) const noexcept;
+
     /// @brief Returns the interface name, the unique char string which
     ///         explicitly identifies the IPC channel.
     /// @return name of the IPC channel
@@ -240,6 +287,13 @@ class IpcInterface
     /// @return answer.isValid()
     static bool setMessageFromString(const char* buffer, IpcMessage& answer) noexcept;
 
+    /// @brief Set the content of answer from the received bytes.
+    /// @param[in] buffer received bytes
+    /// @param[in] size number of received bytes
+    /// @param[out] answer is set from the received bytes
+    /// @return answer.isValid()
+    static bool setBinaryMessageFromBuffer(const char* buffer, const uint64_t size, IpcBinaryMessage& answer) noexcept;
+
     /// @brief Opens a IPC channel and default permissions
     ///         stored in m_perms and stores the descriptor
     /// @param[in] channelSide of the queue. SERVER will also destroy the IPC channel in the dTor, while CLIENT
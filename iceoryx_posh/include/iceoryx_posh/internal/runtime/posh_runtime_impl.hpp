@@ -67,6 +67,9 @@ class PoshRuntimeImpl : public PoshRuntime
                         const popo::ServerOptions& ServerOptions = {},
                         const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept override;
 
+    /// @copydoc PoshRuntime::createPorts
+    void createPorts(PortCreationBatch& batch) noexcept override;
+
     /// @copydoc PoshRuntime::getMiddlewareInterface
     popo::InterfacePortData* getMiddlewareInterface(const capro::Interfaces interface,
                                                     const NodeName_t& nodeName = {""}) noexcept override;
@@ -89,17 +92,49 @@ class PoshRuntimeImpl : public PoshRuntime
                     const RuntimeLocation location = RuntimeLocation::SEPARATE_PROCESS_FROM_ROUDI) noexcept;
 
   private:
-    expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept;
-
-    expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept;
-
-    expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType>
-    requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept;
-
-    expected<popo::ServerPortUser::MemberType_t*, IpcMessageErrorType>
-    requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    popo::PublisherOptions adjustPublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept;
+    popo::SubscriberOptions adjustSubscriberOptions(const capro::ServiceDescription& service,
+                                                    const popo::SubscriberOptions& subscriberOptions) const noexcept;
+    popo::ClientOptions adjustClientOptions(const popo::ClientOptions& clientOptions) const noexcept;
+    popo::ServerOptions adjustServerOptions(const popo::ServerOptions& serverOptions) const noexcept;
+
+    /// @brief returns the options of a PortCreationBatch request adjusted like in the getMiddleware* methods
+    PortCreationBatch::Options_t adjustPortOptions(const PortCreationBatch::Request& request) const noexcept;
+
+    /// @brief appends a request of a PortCreationBatch as entry to a CREATE_PORTS message
+    static void addPortRequest(IpcBinaryMessage& message,
+                               const PortCreationBatch::Request& request,
+                               const PortCreationBatch::Options_t& options) noexcept;
+
+    /// @brief sends a CREATE_PORTS message with the requests [beginIndex, endIndex) of the batch and stores the
+    /// received ports or errors in the batch
+    void requestPortsFromRoudi(const IpcBinaryMessage& sendBuffer,
+                               PortCreationBatch& batch,
+                               const uint64_t beginIndex,
+                               const uint64_t endIndex) noexcept;
+
+    /// @brief sends a CREATE_PORTS request with a single entry to RouDi and returns the port of the response
+    /// @param[in] sendBuffer the request
+    /// @param[in] ackType the expected acknowledge type of the response entry
+    /// @param[in] invalidResponseError is returned when the communication with RouDi failed
+    /// @param[in] wrongResponseError is returned when the response is not the expected one
+    /// @return the port data or the error sent by RouDi
+    template <typename PortData>
+    expected<PortData*, IpcMessageErrorType>
+    requestPortFromRoudi(const IpcBinaryMessage& sendBuffer,
+                         const IpcMessageType ackType,
+                         const IpcMessageErrorType invalidResponseError,
+                         const IpcMessageErrorType wrongResponseError) noexcept;
+
+    /// @brief reads the next entry of a CREATE_PORTS_ACK response
+    /// @return the pointer to the port data, the error sent by RouDi or wrongResponseError if the entry is neither the
+    /// expected acknowledge nor an error
+    expected<void*, IpcMessageErrorType> readPortFromResponse(IpcBinaryMessage& response,
+                                                              const IpcMessageType ackType,
+                                                              const IpcMessageErrorType wrongResponseError) noexcept;
+
+    /// @brief send a binary request to the RouDi daemon and get the response
+    bool sendRequestToRouDi(const IpcBinaryMessage& msg, IpcBinaryMessage& answer) noexcept;
 
     expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
@@ -0,0 +1,126 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHUNK_CHAIN_HPP
+#define IOX_POSH_MEPOO_CHUNK_CHAIN_HPP
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/optional.hpp"
+#include "iox/relative_pointer.hpp"
+#include "iox/span.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief The user-header of the links of a chunk chain. A chunk chain carries a user-payload which is larger than
+/// the chunks of the mempools by splitting it into links, i.e. chunks with a user-payload of at most the link size.
+/// The first link is the chunk which is published and received, it owns the remaining links and releases them when
+/// it is released.
+struct ChunkChainHeader
+{
+    /// @brief the user-payload size of the whole chain, i.e. the sum of the user-payload sizes of all links
+    uint64_t chainPayloadSize{0U};
+    /// @brief the number of links of the whole chain
+    uint32_t numberOfLinks{0U};
+    /// @brief the position of the link within the chain, 0 for the first link
+    uint32_t linkIndex{0U};
+    /// @brief the ChunkHeader of the next link or a logical nullptr for the last link
+    RelativePointer<ChunkHeader> nextLink;
+};
+
+/// @brief A view on the user-payload of a chunk chain as a sequence of spans, one for the user-payload of each link
+/// @tparam ByteType is 'uint8_t' for the chains of a publisher and 'const uint8_t' for the chains of a subscriber
+/// @code
+///   publisher.loanChain(frameSize, linkSize).and_then([&](auto userPayload) {
+///       auto chain = iox::mepoo::ChunkChain::fromUserPayload(userPayload).value();
+///       for (auto link : chain)
+///       {
+///           fillFrame(link.data(), link.size());
+///       }
+///       publisher.publish(userPayload);
+///   });
+/// @endcode
+template <typename ByteType>
+class ChunkChainView
+{
+  public:
+    using ChunkHeader_t =
+        typename std::conditional<std::is_const<ByteType>::value, const ChunkHeader, ChunkHeader>::type;
+    using UserPayload_t = typename std::conditional<std::is_const<ByteType>::value, const void, void>::type;
+
+    /// @brief Forward iterator over the user-payloads of the links
+    class Iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = span<ByteType>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = span<ByteType>;
+
+        span<ByteType> operator*() const noexcept;
+        Iterator& operator++() noexcept;
+        Iterator operator++(int) noexcept;
+        bool operator==(const Iterator& rhs) const noexcept;
+        bool operator!=(const Iterator& rhs) const noexcept;
+
+      private:
+        friend class ChunkChainView;
+        explicit Iterator(ChunkHeader_t* const link) noexcept;
+
+        ChunkHeader_t* m_link{nullptr};
+    };
+
+    /// @brief Creates the view from the user-payload of the first link of a chunk chain
+    /// @param[in] userPayload is the user-payload pointer which was provided by the loan or the take of the chain
+    /// @return the view if the user-payload belongs to the first link of a chunk chain, an empty optional otherwise
+    static optional<ChunkChainView> fromUserPayload(UserPayload_t* const userPayload) noexcept;
+
+    /// @brief The user-payload size of the whole chain
+    /// @return the sum of the user-payload sizes of all links
+    uint64_t size() const noexcept;
+
+    /// @brief The number of links of the chain
+    /// @return the number of links
+    uint32_t numberOfLinks() const noexcept;
+
+    Iterator begin() const noexcept;
+    Iterator end() const noexcept;
+
+  private:
+    explicit ChunkChainView(ChunkHeader_t* const firstLink) noexcept;
+
+    static const ChunkChainHeader* chainHeader(const ChunkHeader* const link) noexcept;
+
+    ChunkHeader_t* m_firstLink{nullptr};
+};
+
+/// @brief The view on a loaned chunk chain of a publisher
+using ChunkChain = ChunkChainView<uint8_t>;
+/// @brief The view on a received chunk chain of a subscriber
+using ConstChunkChain = ChunkChainView<const uint8_t>;
+
+} // namespace mepoo
+} // namespace iox
+
+#include "iceoryx_posh/internal/mepoo/chunk_chain.inl"
+
+#endif // IOX_POSH_MEPOO_CHUNK_CHAIN_HPP
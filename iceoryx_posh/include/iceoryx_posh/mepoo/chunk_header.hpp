@@ -34,6 +34,8 @@ class ChunkSender;
 
 namespace mepoo
 {
+class MemoryManager;
+
 /// @brief Helper struct to use as default template parameter when no user-header is used
 struct NoUserHeader
 {
@@ -66,6 +68,8 @@ struct ChunkHeader
     static constexpr uint16_t NO_USER_HEADER{0x0000};
     /// @brief User-Header id for an unknown user-header
     static constexpr uint16_t UNKNOWN_USER_HEADER{0xFFFF};
+    /// @brief User-Header id for the ChunkChainHeader of the links of a chunk chain
+    static constexpr uint16_t CHUNK_CHAIN_USER_HEADER{0xFFFE};
 
     /// @brief The ChunkHeader version is used to detect incompatibilities for record&replay functionality
     /// @return the ChunkHeader version
@@ -142,11 +146,16 @@ struct ChunkHeader
   private:
     template <typename T>
     friend class popo::ChunkSender;
+    friend class MemoryManager;
 
     void setOriginId(const popo::UniquePortId originId) noexcept;
 
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
+    void setUserHeaderId(const uint16_t userHeaderId) noexcept;
+
+    void setUserPayloadSize(const uint32_t userPayloadSize) noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
   private:
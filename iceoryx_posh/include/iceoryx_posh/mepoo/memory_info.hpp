@@ -18,6 +18,7 @@
 #define IOX_POSH_MEPOO_MEMORY_INFO_HPP
 
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -29,9 +30,13 @@ struct MemoryInfo
 {
     static constexpr uint32_t DEFAULT_DEVICE_ID{0U};
     static constexpr uint32_t DEFAULT_MEMORY_TYPE{0U};
+    /// @brief host memory which is bound to the NUMA node given by the deviceId
+    static constexpr uint32_t NUMA_NODE_MEMORY_TYPE{1U};
+    /// @brief denotes memory which is not bound to a NUMA node
+    static constexpr uint32_t NO_NUMA_NODE{std::numeric_limits<uint32_t>::max()};
 
     // These are intentionally not defined as enum classes for flexibility and extendibility.
-    // Currently only the defaults are used.
+    // Besides the defaults only the binding to a NUMA node is supported.
     // This will change when we support different devices (CPU, GPUs, ...)
     // and other properties that influence how memory is accessed.
 
@@ -48,6 +53,13 @@ struct MemoryInfo
     /// @param[in] memoryType encodes additional information about the memory
     explicit MemoryInfo(uint32_t deviceId = DEFAULT_DEVICE_ID, uint32_t memoryType = DEFAULT_MEMORY_TYPE) noexcept;
 
+    /// @brief creates a MemoryInfo object for host memory which is bound to a NUMA node
+    /// @param[in] node the NUMA node of the memory
+    static MemoryInfo numaNode(const uint32_t node) noexcept;
+
+    /// @brief returns the NUMA node the memory is bound to or NO_NUMA_NODE if it is not bound to a node
+    uint32_t getNumaNode() const noexcept;
+
     /// @brief comparison operator
     /// @param[in] rhs the right hand side of the comparison
     bool operator==(const MemoryInfo& rhs) const noexcept;
@@ -0,0 +1,80 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_NUMA_TOPOLOGY_HPP
+#define IOX_POSH_MEPOO_NUMA_TOPOLOGY_HPP
+
+#include "iox/expected.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+enum class NumaTopologyError
+{
+    INVALID_NODE,
+    BINDING_FAILED
+};
+
+/// @brief Provides the NUMA nodes of the system and binds memory to them. The active topology can be replaced by a
+/// derived class, e.g. to test the NUMA awareness of RouDi on a machine with a single node.
+class NumaTopology
+{
+  public:
+    virtual ~NumaTopology() noexcept = default;
+
+    NumaTopology(const NumaTopology&) = delete;
+    NumaTopology(NumaTopology&&) = delete;
+    NumaTopology& operator=(const NumaTopology&) = delete;
+    NumaTopology& operator=(NumaTopology&&) = delete;
+
+    /// @brief returns the active topology, this is the topology of the system unless it was replaced
+    static NumaTopology& getInstance() noexcept;
+
+    /// @brief returns the number of NUMA nodes, a system without NUMA support has a single node
+    virtual uint32_t numberOfNodes() const noexcept;
+
+    /// @brief binds the memory which is allocated by the calling thread to a NUMA node
+    /// @param[in] node the NUMA node
+    /// @return an error if the node does not exist or the binding failed
+    virtual expected<NumaTopologyError> bindThreadMemoryToNode(const uint32_t node) noexcept;
+
+    /// @brief restores the default memory policy of the calling thread
+    virtual expected<NumaTopologyError> resetThreadMemoryBinding() noexcept;
+
+    /// @brief binds the pages of a mapped memory range to a NUMA node, pages which are already allocated are moved
+    /// @param[in] address the start address of the memory range
+    /// @param[in] size the size of the memory range
+    /// @param[in] node the NUMA node
+    /// @return an error if the node does not exist or the binding failed
+    virtual expected<NumaTopologyError>
+    bindMemoryToNode(void* const address, const uint64_t size, const uint32_t node) noexcept;
+
+  protected:
+    NumaTopology() noexcept = default;
+
+    /// @brief replaces the active topology, a nullptr restores the topology of the system
+    /// @param[in] topology the new active topology, it must outlive its usage
+    static void setInstance(NumaTopology* const topology) noexcept;
+
+  private:
+    static NumaTopology*& activeInstance() noexcept;
+};
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_NUMA_TOPOLOGY_HPP
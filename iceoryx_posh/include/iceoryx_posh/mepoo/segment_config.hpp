@@ -27,6 +27,19 @@ namespace iox
 {
 namespace mepoo
 {
+/// @brief Defines how the operating system provides the memory of a shared memory segment
+struct SegmentMemoryOptions
+{
+    /// @brief advise the operating system to back the segment with huge pages, falls back to regular pages when huge
+    ///        pages are not available
+    bool hugePages{false};
+    /// @brief map all pages of the segment at creation instead of on the first access, this also replaces writing
+    ///        zeros to the newly created segment
+    bool prefault{false};
+    /// @brief lock the segment in RAM so that it is never paged out
+    bool lockInMemory{false};
+};
+
 struct SegmentConfig
 {
     struct SegmentEntry
@@ -34,11 +47,13 @@ struct SegmentConfig
         SegmentEntry(const posix::PosixGroup::groupName_t& readerGroup,
                      const posix::PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const SegmentMemoryOptions& memoryOptions = SegmentMemoryOptions()) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_memoryOptions(memoryOptions)
 
         {
         }
@@ -47,6 +62,7 @@ struct SegmentConfig
         posix::PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        SegmentMemoryOptions m_memoryOptions;
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
@@ -18,6 +18,8 @@
 #define IOX_POSH_POPO_PUBLISHER_OPTIONS_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "port_queue_policies.hpp"
 
@@ -44,6 +46,25 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The maximum time the publisher waits for a too slow subscriber with
+    /// ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER before the sample is dropped for this subscriber; the default waits
+    /// until there is space in the queue
+    units::Duration subscriberTooSlowTimeout{units::Duration::max()};
+
+    /// @brief The number of chunks the publisher reserves at once from the mempools and caches for subsequent loans;
+    /// this reduces the contention on the mempools at the cost of chunks which are not available for other
+    /// publishers. The capacity is limited to MAX_CHUNK_MAGAZINE_CAPACITY and the default of 0 disables the cache.
+    uint64_t chunkMagazineCapacity{0U};
+
+    /// @brief The option whether the samples are stamped with the send time; the subscribers record the latency from
+    /// publish to take of these samples, which is published by RouDi's port introspection
+    bool stampSendTime{false};
+
+    /// @brief The NUMA node where the chunks of the publisher should be located. The chunks are taken from the
+    /// writable segment which is bound to this node; if there is no such segment or with the default of
+    /// mepoo::MemoryInfo::NO_NUMA_NODE the default writable segment is used.
+    uint32_t numaNode{mepoo::MemoryInfo::NO_NUMA_NODE};
+
     /// @brief serialization of the PublisherOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
@@ -0,0 +1,53 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_WAIT_STRATEGY_HPP
+#define IOX_POSH_POPO_WAIT_STRATEGY_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Used by the WaitSet and the Listener to define how they wait for notifications
+enum class WaitStrategyType : uint8_t
+{
+    /// Blocks until a notification arrives, every wakeup costs a context switch
+    BLOCK,
+    /// Polls the notifications until one arrives and occupies the CPU all the time
+    SPIN,
+    /// Polls the notifications for the spin budget and yields the CPU between all further polls
+    SPIN_THEN_YIELD,
+    /// Polls the notifications for the spin budget and blocks afterwards
+    SPIN_THEN_BLOCK
+};
+
+/// @brief This struct is used to configure how the WaitSet and the Listener wait for notifications. The spinning
+/// strategies trade CPU time for a wakeup without context switch and are meant for threads on isolated cores.
+struct WaitStrategy
+{
+    /// @brief The way to wait for notifications
+    WaitStrategyType type{WaitStrategyType::BLOCK};
+
+    /// @brief The number of polls before SPIN_THEN_YIELD starts to yield and SPIN_THEN_BLOCK blocks; it is not used
+    /// by BLOCK and SPIN
+    uint64_t spinBudget{10000U};
+};
+
+} // namespace popo
+} // namespace iox
+#endif // IOX_POSH_POPO_WAIT_STRATEGY_HPP
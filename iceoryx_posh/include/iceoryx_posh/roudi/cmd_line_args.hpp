@@ -32,6 +32,7 @@ struct CmdLineArgs_t
     iox::log::LogLevel logLevel{iox::log::LogLevel::WARN};
     version::CompatibilityCheckLevel compatibilityCheckLevel{version::CompatibilityCheckLevel::PATCH};
     units::Duration processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    uint32_t numberOfRuntimeMessagesWorkers{roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGES_WORKERS};
     optional<uint16_t> uniqueRouDiId{nullopt};
     bool run{true};
     roudi::ConfigFilePathString_t configFilePath;
@@ -45,6 +46,7 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Cmd
     cmdLineArgs.uniqueRouDiId.and_then([&logstream](auto& id) { logstream << "Unique RouDi ID: " << id << "\n"; })
         .or_else([&logstream] { logstream << "Unique RouDi ID: < unset >\n"; });
     logstream << "Process kill delay: " << cmdLineArgs.processKillDelay.toSeconds() << " s\n";
+    logstream << "Runtime messages workers: " << cmdLineArgs.numberOfRuntimeMessagesWorkers << "\n";
     if (!cmdLineArgs.configFilePath.empty())
     {
         logstream << "Config file used is: " << cmdLineArgs.configFilePath;
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iox/vector.hpp"
 
 namespace iox
@@ -37,10 +38,15 @@ constexpr int MAX_GROUP_NAME_LENGTH = 32;
 struct MemPoolInfo
 {
     uint32_t m_usedChunks{0};
+    /// @brief the chunks in use which are reserved by the chunk magazines of the publishers but not yet loaned
+    uint32_t m_cachedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_chunkPayloadSize{0};
+    /// @brief the NUMA node the chunks are located on or mepoo::MemoryInfo::NO_NUMA_NODE if the segment of the mempool
+    /// is not bound to a node
+    uint32_t m_numaNode{mepoo::MemoryInfo::NO_NUMA_NODE};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -125,6 +131,27 @@ struct SubscriberPortChangingIntrospectionFieldTopic
     vector<SubscriberPortChangingData, MAX_SUBSCRIBERS> subscriberPortChangingDataList;
 };
 
+const capro::ServiceDescription
+    IntrospectionSubscriberLatencyService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "SubscriberLatency");
+
+/// @brief the latency from publish to take of the samples a subscriber took since the previous update; only samples
+/// of publishers with PublisherOptions::stampSendTime are recorded
+struct SubscriberLatencyData
+{
+    // index used to identify subscriber is same as in PortIntrospectionFieldTopic->subscriberList
+    uint64_t m_numberOfSamples{0};
+    uint64_t m_p50LatencyInNanoseconds{0};
+    uint64_t m_p99LatencyInNanoseconds{0};
+    uint64_t m_p999LatencyInNanoseconds{0};
+    uint64_t m_maxLatencyInNanoseconds{0};
+};
+
+/// @brief the topic for the subscriber latencies that a user can subscribe to
+struct SubscriberLatencyIntrospectionFieldTopic
+{
+    vector<SubscriberLatencyData, MAX_SUBSCRIBERS> m_latencyList;
+};
+
 const capro::ServiceDescription IntrospectionProcessService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "Process");
 
 struct ProcessIntrospectionData
@@ -21,6 +21,7 @@
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/segment_config.hpp"
 #include "iox/expected.hpp"
 #include "iox/filesystem.hpp"
 #include "iox/optional.hpp"
@@ -40,9 +41,11 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param [in] shmName is the name of the posix share memory
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] openMode defines the creation/open mode of the shared memory.
+    /// @param [in] memoryOptions defines how the operating system provides the memory, e.g. with huge pages
     PosixShmMemoryProvider(const ShmName_t& shmName,
                            const posix::AccessMode accessMode,
-                           const posix::OpenMode openMode) noexcept;
+                           const posix::OpenMode openMode,
+                           const mepoo::SegmentMemoryOptions& memoryOptions = mepoo::SegmentMemoryOptions()) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -64,6 +67,7 @@ class PosixShmMemoryProvider : public MemoryProvider
     ShmName_t m_shmName;
     posix::AccessMode m_accessMode{posix::AccessMode::READ_ONLY};
     posix::OpenMode m_openMode{posix::OpenMode::OPEN_EXISTING};
+    mepoo::SegmentMemoryOptions m_memoryOptions;
     optional<posix::SharedMemoryObject> m_shmObject;
 
     static constexpr access_rights SHM_MEMORY_PERMISSIONS =
@@ -27,6 +27,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
+#include "iceoryx_posh/internal/roudi/hash_multi_index.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
@@ -71,6 +72,33 @@ class PortPool
     vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
     vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES> getConditionVariableDataList() noexcept;
 
+    /// @brief Returns the publisher ports with the provided service description without iterating over all ports
+    /// @param[in] serviceDescription of the requested publisher ports
+    /// @return the publisher ports with an equal service description
+    vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+    getPublisherPortDataList(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Returns the subscriber ports with the provided service description without iterating over all ports
+    /// @param[in] serviceDescription of the requested subscriber ports
+    /// @return the subscriber ports with an equal service description
+    vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+    getSubscriberPortDataList(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Returns the client ports with the provided service description without iterating over all ports
+    /// @param[in] serviceDescription of the requested client ports
+    /// @return the client ports with an equal service description
+    vector<popo::ClientPortData*, MAX_CLIENTS>
+    getClientPortDataList(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Returns the server ports with the provided service description without iterating over all ports
+    /// @param[in] serviceDescription of the requested server ports
+    /// @return the server ports with an equal service description
+    vector<popo::ServerPortData*, MAX_SERVERS>
+    getServerPortDataList(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Returns the condition variable which is notified by the ports when RouDi has to run the discovery
+    popo::ConditionVariableData& getDiscoveryConditionVariable() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -170,7 +198,18 @@ class PortPool
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
   private:
+    template <typename T, uint64_t Capacity>
+    using PortIndex_t = HashMultiIndex<T*, Capacity>;
+
+    /// @brief connects a new port to the discovery condition variable and wakes up the discovery loop
+    void requestInitialDiscovery(popo::BasePortData& portData) noexcept;
+
     PortPoolData* m_portPoolData;
+
+    PortIndex_t<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS> m_publisherPortIndex;
+    PortIndex_t<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS> m_subscriberPortIndex;
+    PortIndex_t<popo::ClientPortData, MAX_CLIENTS> m_clientPortIndex;
+    PortIndex_t<popo::ServerPortData, MAX_SERVERS> m_serverPortIndex;
 };
 
 } // namespace roudi
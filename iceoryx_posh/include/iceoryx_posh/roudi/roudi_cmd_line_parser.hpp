@@ -69,6 +69,7 @@ class CmdLineParser
     version::CompatibilityCheckLevel m_compatibilityCheckLevel{version::CompatibilityCheckLevel::PATCH};
     optional<uint16_t> m_uniqueRouDiId;
     units::Duration m_processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    uint32_t m_numberOfRuntimeMessagesWorkers{roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGES_WORKERS};
 };
 
 } // namespace config
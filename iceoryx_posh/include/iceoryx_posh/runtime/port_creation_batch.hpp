@@ -0,0 +1,176 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_PORT_CREATION_BATCH_HPP
+#define IOX_POSH_RUNTIME_PORT_CREATION_BATCH_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/expected.hpp"
+#include "iox/optional.hpp"
+#include "iox/variant.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+class PoshRuntimeImpl;
+
+/// @brief Collects publisher, subscriber, client and server requests which are created together with
+///        PoshRuntime::createPorts. The runtime packs the requests into as few messages as possible and RouDi creates
+///        all ports of a message in one pass, this saves a round trip to RouDi for every single port when an
+///        application creates many ports at startup.
+/// @note In contrast to the getMiddleware* methods of the PoshRuntime a failed request does not call the error
+///       handler, the error is returned by the corresponding get method instead.
+/// @code
+///     runtime::PortCreationBatch batch;
+///     auto publisherIndex = batch.addPublisher({"Radar", "FrontLeft", "Objects"});
+///     auto subscriberIndex = batch.addSubscriber({"Radar", "FrontRight", "Objects"});
+///
+///     runtime::PoshRuntime::getInstance().createPorts(batch);
+///
+///     batch.getPublisher(publisherIndex.value())
+///         .and_then([](auto publisherPortData) { /* use the port */ })
+///         .or_else([](auto error) { /* handle the error */ });
+/// @endcode
+class PortCreationBatch
+{
+  public:
+    using Index_t = uint64_t;
+
+    static constexpr uint64_t CAPACITY{MAX_PORTS_PER_CREATION_BATCH};
+
+    /// @brief adds a publisher request to the batch
+    /// @param[in] service service description of the publisher
+    /// @param[in] publisherOptions options of the publisher
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the index of the request which is used to acquire the port with getPublisher or nullopt if the batch
+    ///         is full
+    optional<Index_t> addPublisher(const capro::ServiceDescription& service,
+                                   const popo::PublisherOptions& publisherOptions = {},
+                                   const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a subscriber request to the batch
+    /// @param[in] service service description of the subscriber
+    /// @param[in] subscriberOptions options of the subscriber
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the index of the request which is used to acquire the port with getSubscriber or nullopt if the batch
+    ///         is full
+    optional<Index_t> addSubscriber(const capro::ServiceDescription& service,
+                                    const popo::SubscriberOptions& subscriberOptions = {},
+                                    const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a client request to the batch
+    /// @param[in] service service description of the client
+    /// @param[in] clientOptions options of the client
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the index of the request which is used to acquire the port with getClient or nullopt if the batch is
+    ///         full
+    optional<Index_t> addClient(const capro::ServiceDescription& service,
+                                const popo::ClientOptions& clientOptions = {},
+                                const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a server request to the batch
+    /// @param[in] service service description of the server
+    /// @param[in] serverOptions options of the server
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the index of the request which is used to acquire the port with getServer or nullopt if the batch is
+    ///         full
+    optional<Index_t> addServer(const capro::ServiceDescription& service,
+                                const popo::ServerOptions& serverOptions = {},
+                                const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief returns the publisher port of a request
+    /// @param[in] index of the request returned by addPublisher, a different index leads to termination
+    /// @return the publisher port data, the error sent by RouDi or IpcMessageErrorType::PORT_CREATION_NOT_REQUESTED
+    ///         if the batch was not yet passed to PoshRuntime::createPorts
+    expected<popo::PublisherPortData*, IpcMessageErrorType> getPublisher(const Index_t index) const noexcept;
+
+    /// @brief returns the subscriber port of a request
+    /// @param[in] index of the request returned by addSubscriber, a different index leads to termination
+    /// @return the subscriber port data, the error sent by RouDi or IpcMessageErrorType::PORT_CREATION_NOT_REQUESTED
+    ///         if the batch was not yet passed to PoshRuntime::createPorts
+    expected<popo::SubscriberPortData*, IpcMessageErrorType> getSubscriber(const Index_t index) const noexcept;
+
+    /// @brief returns the client port of a request
+    /// @param[in] index of the request returned by addClient, a different index leads to termination
+    /// @return the client port data, the error sent by RouDi or IpcMessageErrorType::PORT_CREATION_NOT_REQUESTED if
+    ///         the batch was not yet passed to PoshRuntime::createPorts
+    expected<popo::ClientPortData*, IpcMessageErrorType> getClient(const Index_t index) const noexcept;
+
+    /// @brief returns the server port of a request
+    /// @param[in] index of the request returned by addServer, a different index leads to termination
+    /// @return the server port data, the error sent by RouDi or IpcMessageErrorType::PORT_CREATION_NOT_REQUESTED if
+    ///         the batch was not yet passed to PoshRuntime::createPorts
+    expected<popo::ServerPortData*, IpcMessageErrorType> getServer(const Index_t index) const noexcept;
+
+    /// @brief returns the number of requests in the batch
+    uint64_t size() const noexcept;
+
+    /// @brief returns true if the batch contains no requests
+    bool empty() const noexcept;
+
+    /// @brief removes all requests, the ports which were already created are not affected
+    void clear() noexcept;
+
+  private:
+    friend class PoshRuntimeImpl;
+
+    using Options_t =
+        variant<popo::PublisherOptions, popo::SubscriberOptions, popo::ClientOptions, popo::ServerOptions>;
+
+    struct Request
+    {
+        Request(const IpcMessageType type,
+                const capro::ServiceDescription& service,
+                const Options_t& options,
+                const PortConfigInfo& portConfigInfo) noexcept;
+
+        IpcMessageType type{IpcMessageType::NOTYPE};
+        capro::ServiceDescription service;
+        Options_t options;
+        PortConfigInfo portConfigInfo;
+        void* port{nullptr};
+        IpcMessageErrorType error{IpcMessageErrorType::PORT_CREATION_NOT_REQUESTED};
+    };
+
+    optional<Index_t> addRequest(const IpcMessageType type,
+                                 const capro::ServiceDescription& service,
+                                 const Options_t& options,
+                                 const PortConfigInfo& portConfigInfo) noexcept;
+
+    template <typename PortData>
+    expected<PortData*, IpcMessageErrorType> getPort(const Index_t index, const IpcMessageType type) const noexcept;
+
+    vector<Request, CAPACITY> m_requests;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_CREATION_BATCH_HPP
@@ -31,6 +31,7 @@
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/port_creation_batch.hpp"
 #include "iox/optional.hpp"
 #include "iox/scope_guard.hpp"
 
@@ -135,6 +136,11 @@ class PoshRuntime
                         const popo::ServerOptions& serverOptions = {},
                         const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept = 0;
 
+    /// @brief request the RouDi daemon to create all ports of the batch with as few requests as possible
+    /// @param[in] batch with the publisher, subscriber, client and server requests; the created ports or the errors
+    /// are stored in the batch and are acquired with the get methods of the batch
+    virtual void createPorts(PortCreationBatch& batch) noexcept = 0;
+
     /// @brief request the RouDi daemon to create an interface port
     /// @param[in] interface interface to create
     /// @param[in] nodeName name of the node where the interface should belong to
@@ -79,11 +79,21 @@ class ServiceDiscovery
     std::unique_ptr<roudi::ServiceRegistry> m_serviceRegistry{new iox::roudi::ServiceRegistry};
     std::mutex m_serviceRegistryMutex;
 
+    // the full registry is only copied when changes were missed, e.g. on the first update or when the change queue
+    // overflowed
     popo::Subscriber<roudi::ServiceRegistry> m_serviceRegistrySubscriber{
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
 
+    popo::Subscriber<roudi::ServiceRegistry::Change> m_serviceRegistryChangeSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGES_EVENT_NAME},
+        {roudi::ServiceRegistry::CHANGE_HISTORY_CAPACITY,
+         roudi::ServiceRegistry::CHANGE_HISTORY_CAPACITY,
+         iox::NodeName_t("Service Registry"),
+         true}};
+
     void update();
+    void updateFromLatestSnapshot();
 };
 
 } // namespace runtime
@@ -221,6 +221,16 @@ void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+void ChunkHeader::setUserHeaderId(const uint16_t userHeaderId) noexcept
+{
+    m_userHeaderId = userHeaderId;
+}
+
+void ChunkHeader::setUserPayloadSize(const uint32_t userPayloadSize) noexcept
+{
+    m_userPayloadSize = userPayloadSize;
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
@@ -0,0 +1,122 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_magazine.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+ChunkMagazine::ChunkMagazine(const uint32_t capacity) noexcept
+    : m_capacity(std::min(capacity, MAX_CHUNK_MAGAZINE_CAPACITY))
+{
+}
+
+uint32_t ChunkMagazine::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+uint32_t ChunkMagazine::size() const noexcept
+{
+    return m_size;
+}
+
+optional<ReservedChunk> ChunkMagazine::take(MemPool& memPool, MemPool& chunkManagementPool) noexcept
+{
+    if (m_capacity == 0U)
+    {
+        return nullopt;
+    }
+
+    if (m_memPool.get() != &memPool || m_chunkManagementPool.get() != &chunkManagementPool)
+    {
+        drain();
+        m_memPool = &memPool;
+        m_chunkManagementPool = &chunkManagementPool;
+    }
+
+    if (m_size == 0U)
+    {
+        refill();
+        if (m_size == 0U)
+        {
+            return nullopt;
+        }
+    }
+
+    // the size is decremented before the chunk is handed out; if the process dies in between, the chunk is lost
+    // instead of being returned twice to the mempool by RouDi
+    --m_size;
+    ++m_numberOfTakenChunks;
+
+    return ReservedChunk{m_memPool->getReservedChunk(m_chunkIndices[m_size]),
+                         m_chunkManagementPool->getReservedChunk(m_chunkManagementIndices[m_size])};
+}
+
+void ChunkMagazine::drain() noexcept
+{
+    if (m_memPool.get() == nullptr)
+    {
+        return;
+    }
+
+    markTakenChunksAsUsed();
+
+    const uint32_t numberOfChunks = m_size;
+    m_size = 0U;
+    m_memPool->releaseReservedChunks(&m_chunkIndices[0], numberOfChunks);
+    m_chunkManagementPool->releaseReservedChunks(&m_chunkManagementIndices[0], numberOfChunks);
+}
+
+void ChunkMagazine::refill() noexcept
+{
+    markTakenChunksAsUsed();
+
+    uint32_t numberOfChunks = m_memPool->reserveChunks(&m_chunkIndices[0], m_capacity);
+    if (numberOfChunks == 0U)
+    {
+        return;
+    }
+
+    const uint32_t numberOfChunkManagements =
+        m_chunkManagementPool->reserveChunks(&m_chunkManagementIndices[0], numberOfChunks);
+    if (numberOfChunkManagements < numberOfChunks)
+    {
+        m_memPool->releaseReservedChunks(&m_chunkIndices[numberOfChunkManagements],
+                                         numberOfChunks - numberOfChunkManagements);
+        numberOfChunks = numberOfChunkManagements;
+    }
+
+    m_size = numberOfChunks;
+}
+
+void ChunkMagazine::markTakenChunksAsUsed() noexcept
+{
+    if (m_numberOfTakenChunks == 0U)
+    {
+        return;
+    }
+
+    m_memPool->markReservedChunksAsUsed(m_numberOfTakenChunks);
+    m_chunkManagementPool->markReservedChunksAsUsed(m_numberOfTakenChunks);
+    m_numberOfTakenChunks = 0U;
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -28,11 +28,13 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint32_t chunkSize) noexcept
+                         const uint32_t chunkSize,
+                         const uint32_t cachedChunks) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_cachedChunks(cachedChunks)
 {
 }
 
@@ -115,6 +117,48 @@ void MemPool::freeChunk(const void* chunk) noexcept
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
 
+uint32_t MemPool::reserveChunks(uint32_t* const chunkIndices, const uint32_t maxNumberOfChunks) noexcept
+{
+    const uint32_t numberOfChunks = m_freeIndices.pop(chunkIndices, maxNumberOfChunks);
+    if (numberOfChunks == 0U)
+    {
+        IOX_LOG(WARN) << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
+                      << ", used_chunks = " << m_usedChunks << " ] has no more space left";
+        return 0U;
+    }
+
+    m_cachedChunks.fetch_add(numberOfChunks, std::memory_order_relaxed);
+    m_usedChunks.fetch_add(numberOfChunks, std::memory_order_relaxed);
+    adjustMinFree();
+
+    return numberOfChunks;
+}
+
+void* MemPool::getReservedChunk(const uint32_t chunkIndex) const noexcept
+{
+    cxx::Expects(chunkIndex < m_numberOfChunks);
+    return m_rawMemory.get() + static_cast<uint64_t>(chunkIndex) * m_chunkSize;
+}
+
+void MemPool::markReservedChunksAsUsed(const uint32_t numberOfChunks) noexcept
+{
+    m_cachedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+}
+
+void MemPool::releaseReservedChunks(const uint32_t* const chunkIndices, const uint32_t numberOfChunks) noexcept
+{
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        if (!m_freeIndices.push(chunkIndices[i]))
+        {
+            errorHandler(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+        }
+    }
+
+    m_cachedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+    m_usedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+}
+
 uint32_t MemPool::getChunkSize() const noexcept
 {
     return m_chunkSize;
@@ -135,12 +179,18 @@ uint32_t MemPool::getMinFree() const noexcept
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint32_t MemPool::getCachedChunks() const noexcept
+{
+    return m_cachedChunks.load(std::memory_order_relaxed);
+}
+
 MemPoolInfo MemPool::getInfo() const noexcept
 {
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_cachedChunks.load(std::memory_order_relaxed)};
 }
 
 } // namespace mepoo
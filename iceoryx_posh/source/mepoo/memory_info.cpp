@@ -21,12 +21,27 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t MemoryInfo::DEFAULT_DEVICE_ID;
+constexpr uint32_t MemoryInfo::DEFAULT_MEMORY_TYPE;
+constexpr uint32_t MemoryInfo::NUMA_NODE_MEMORY_TYPE;
+constexpr uint32_t MemoryInfo::NO_NUMA_NODE;
+
 MemoryInfo::MemoryInfo(uint32_t deviceId, uint32_t memoryType) noexcept
     : deviceId(deviceId)
     , memoryType(memoryType)
 {
 }
 
+MemoryInfo MemoryInfo::numaNode(const uint32_t node) noexcept
+{
+    return MemoryInfo(node, NUMA_NODE_MEMORY_TYPE);
+}
+
+uint32_t MemoryInfo::getNumaNode() const noexcept
+{
+    return (memoryType == NUMA_NODE_MEMORY_TYPE) ? deviceId : NO_NUMA_NODE;
+}
+
 bool MemoryInfo::operator==(const MemoryInfo& rhs) const noexcept
 {
     return deviceId == rhs.deviceId && memoryType == rhs.memoryType;
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/mepoo/chunk_chain.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/logging.hpp"
@@ -28,6 +29,10 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t MemoryManager::NUMBER_OF_SIZE_CLASS_SUB_BUCKETS_LOG2;
+constexpr uint32_t MemoryManager::NUMBER_OF_SIZE_CLASS_SUB_BUCKETS;
+constexpr uint32_t MemoryManager::NUMBER_OF_SIZE_CLASSES;
+
 void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
     for (auto& l_mempool : m_memPoolVector)
@@ -74,6 +79,32 @@ void MemoryManager::generateChunkManagementPool(BumpAllocator& managementAllocat
     m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
 }
 
+void MemoryManager::generateSizeClassTable() noexcept
+{
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClass = 0U; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        const uint32_t lowerBound = sizeClassLowerBound(sizeClass);
+        while (memPoolIndex < m_memPoolVector.size() && m_memPoolVector[memPoolIndex].getChunkSize() < lowerBound)
+        {
+            ++memPoolIndex;
+        }
+        m_sizeClassToMemPoolIndex[sizeClass] = memPoolIndex;
+    }
+}
+
+uint32_t MemoryManager::findMemPoolIndex(const uint32_t requiredChunkSize) const noexcept
+{
+    // the table entry points to the first mempool which could fit; only the mempools with a chunk size in the same
+    // size class but smaller than the required chunk size need to be skipped
+    uint32_t memPoolIndex = m_sizeClassToMemPoolIndex[sizeClassIndex(requiredChunkSize)];
+    while (memPoolIndex < m_memPoolVector.size() && m_memPoolVector[memPoolIndex].getChunkSize() < requiredChunkSize)
+    {
+        ++memPoolIndex;
+    }
+    return memPoolIndex;
+}
+
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
 {
     return static_cast<uint32_t>(m_memPoolVector.size());
@@ -141,26 +172,47 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
     }
 
     generateChunkManagementPool(managementAllocator);
+    generateSizeClassTable();
 }
 
 expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    return acquireChunk(chunkSettings, nullptr);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                                                    ChunkMagazine& chunkMagazine) noexcept
+{
+    return acquireChunk(chunkSettings, (chunkMagazine.capacity() > 0U) ? &chunkMagazine : nullptr);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::acquireChunk(const ChunkSettings& chunkSettings,
+                                                                        ChunkMagazine* const chunkMagazine) noexcept
 {
     void* chunk{nullptr};
+    void* chunkManagementMemory{nullptr};
     MemPool* memPoolPointer{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint32_t aquiredChunkSize = 0U;
 
-    for (auto& memPool : m_memPoolVector)
+    const uint32_t memPoolIndex = findMemPoolIndex(requiredChunkSize);
+    if (memPoolIndex < m_memPoolVector.size())
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        auto& memPool = m_memPoolVector[memPoolIndex];
+        if (chunkMagazine == nullptr)
         {
             chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
         }
+        else
+        {
+            chunkMagazine->take(memPool, m_chunkManagementPool.front()).and_then([&](auto& reservedChunk) {
+                chunk = reservedChunk.chunk;
+                chunkManagementMemory = reservedChunk.chunkManagement;
+            });
+        }
+        memPoolPointer = &memPool;
+        aquiredChunkSize = memPool.getChunkSize();
     }
 
     if (m_memPoolVector.size() == 0)
@@ -196,12 +248,63 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
     else
     {
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+        if (chunkManagementMemory == nullptr)
+        {
+            chunkManagementMemory = m_chunkManagementPool.front().getChunk();
+        }
+        auto chunkManagement =
+            new (chunkManagementMemory) ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
         return success<SharedChunk>(SharedChunk(chunkManagement));
     }
 }
 
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunkChain(const uint64_t chainPayloadSize,
+                                                                         const ChunkSettings& linkSettings,
+                                                                         ChunkMagazine& chunkMagazine) noexcept
+{
+    const uint64_t linkPayloadSize = linkSettings.userPayloadSize();
+    const uint64_t numberOfLinks = (chainPayloadSize + linkPayloadSize - 1U) / linkPayloadSize;
+
+    // the links are obtained from the last to the first one in order to pass the already obtained successor to every
+    // new link; if a link cannot be obtained, the destructor of the successor releases all links behind it
+    SharedChunk nextLink;
+    for (uint64_t linkIndex = numberOfLinks; linkIndex > 0U;)
+    {
+        --linkIndex;
+        const auto userPayloadSize =
+            static_cast<uint32_t>(algorithm::minVal(linkPayloadSize, chainPayloadSize - linkIndex * linkPayloadSize));
+        // only the last link can be smaller; its settings are valid since they just differ in the user-payload size
+        const auto settings = (userPayloadSize == linkPayloadSize)
+                                  ? linkSettings
+                                  : ChunkSettings::create(userPayloadSize,
+                                                          linkSettings.userPayloadAlignment(),
+                                                          linkSettings.userHeaderSize(),
+                                                          linkSettings.userHeaderAlignment())
+                                        .expect("Valid chunk settings for the last link of a chunk chain");
+        auto getChunkResult = getChunk(settings, chunkMagazine);
+        if (getChunkResult.has_error())
+        {
+            return error<Error>(getChunkResult.get_error());
+        }
+
+        auto& link = getChunkResult.value();
+        auto* chunkHeader = link.getChunkHeader();
+        chunkHeader->setUserHeaderId(ChunkHeader::CHUNK_CHAIN_USER_HEADER);
+        auto* chainHeader = new (chunkHeader->userHeader()) ChunkChainHeader();
+        chainHeader->chainPayloadSize = chainPayloadSize;
+        chainHeader->numberOfLinks = static_cast<uint32_t>(numberOfLinks);
+        chainHeader->linkIndex = static_cast<uint32_t>(linkIndex);
+        if (nextLink)
+        {
+            chainHeader->nextLink = nextLink.getChunkHeader();
+            link.setNextLink(std::move(nextLink));
+        }
+        nextLink = std::move(link);
+    }
+
+    return success<SharedChunk>(std::move(nextLink));
+}
+
 std::ostream& operator<<(std::ostream& stream, const MemoryManager::Error value) noexcept
 {
     stream << asStringLiteral(value);
@@ -0,0 +1,109 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/numa_topology.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_platform/numa.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+namespace
+{
+class SystemNumaTopology : public NumaTopology
+{
+  public:
+    SystemNumaTopology() noexcept = default;
+};
+} // namespace
+
+NumaTopology& NumaTopology::getInstance() noexcept
+{
+    static SystemNumaTopology systemTopology;
+    auto* topology = activeInstance();
+    return (topology != nullptr) ? *topology : systemTopology;
+}
+
+void NumaTopology::setInstance(NumaTopology* const topology) noexcept
+{
+    activeInstance() = topology;
+}
+
+NumaTopology*& NumaTopology::activeInstance() noexcept
+{
+    static NumaTopology* topology{nullptr};
+    return topology;
+}
+
+uint32_t NumaTopology::numberOfNodes() const noexcept
+{
+    return static_cast<uint32_t>(iox_numa_number_of_nodes());
+}
+
+expected<NumaTopologyError> NumaTopology::bindThreadMemoryToNode(const uint32_t node) noexcept
+{
+    if (node >= numberOfNodes())
+    {
+        return error<NumaTopologyError>(NumaTopologyError::INVALID_NODE);
+    }
+
+    auto result =
+        posix::posixCall(iox_numa_bind_thread_memory)(static_cast<int>(node)).failureReturnValue(-1).evaluate();
+    if (result.has_error())
+    {
+        IOX_LOG(ERROR) << "Unable to bind the memory of the thread to the NUMA node " << node << " ("
+                       << result.get_error().getHumanReadableErrnum() << ")";
+        return error<NumaTopologyError>(NumaTopologyError::BINDING_FAILED);
+    }
+    return success<>();
+}
+
+expected<NumaTopologyError> NumaTopology::resetThreadMemoryBinding() noexcept
+{
+    auto result = posix::posixCall(iox_numa_bind_thread_memory)(-1).failureReturnValue(-1).evaluate();
+    if (result.has_error())
+    {
+        IOX_LOG(ERROR) << "Unable to reset the memory binding of the thread ("
+                       << result.get_error().getHumanReadableErrnum() << ")";
+        return error<NumaTopologyError>(NumaTopologyError::BINDING_FAILED);
+    }
+    return success<>();
+}
+
+expected<NumaTopologyError>
+NumaTopology::bindMemoryToNode(void* const address, const uint64_t size, const uint32_t node) noexcept
+{
+    if (node >= numberOfNodes())
+    {
+        return error<NumaTopologyError>(NumaTopologyError::INVALID_NODE);
+    }
+
+    auto result = posix::posixCall(iox_numa_bind_memory)(address, static_cast<size_t>(size), static_cast<int>(node))
+                      .failureReturnValue(-1)
+                      .evaluate();
+    if (result.has_error())
+    {
+        IOX_LOG(ERROR) << "Unable to bind the memory " << iox::log::hex(address) << " with size " << size
+                       << " to the NUMA node " << node << " (" << result.get_error().getHumanReadableErrnum() << ")";
+        return error<NumaTopologyError>(NumaTopologyError::BINDING_FAILED);
+    }
+    return success<>();
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -60,9 +60,19 @@ void SharedChunk::decrementReferenceCounter() noexcept
 
 void SharedChunk::freeChunk() noexcept
 {
-    m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
-    m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    // the links of a chunk chain are released iteratively since a recursion would be as deep as the chain is long
+    ChunkManagement* chunkManagement = m_chunkManagement;
     m_chunkManagement = nullptr;
+    while (chunkManagement != nullptr)
+    {
+        ChunkManagement* nextLink = chunkManagement->m_nextLink.get();
+        chunkManagement->m_mempool->freeChunk(static_cast<void*>(chunkManagement->m_chunkHeader.get()));
+        chunkManagement->m_chunkManagementPool->freeChunk(chunkManagement);
+
+        const bool isLastReferenceOfNextLink =
+            (nextLink != nullptr) && (nextLink->m_referenceCounter.fetch_sub(1U, std::memory_order_relaxed) == 1U);
+        chunkManagement = isLastReferenceOfNextLink ? nextLink : nullptr;
+    }
 }
 
 SharedChunk& SharedChunk::operator=(const SharedChunk& rhs) noexcept
@@ -124,6 +134,19 @@ SharedChunk::operator bool() const noexcept
     return m_chunkManagement != nullptr;
 }
 
+uint64_t SharedChunk::getSendTimestamp() const noexcept
+{
+    return (m_chunkManagement != nullptr) ? m_chunkManagement->m_sendTimestamp : 0U;
+}
+
+void SharedChunk::setSendTimestamp(const uint64_t sendTimestamp) noexcept
+{
+    if (m_chunkManagement != nullptr)
+    {
+        m_chunkManagement->m_sendTimestamp = sendTimestamp;
+    }
+}
+
 ChunkHeader* SharedChunk::getChunkHeader() const noexcept
 {
     if (m_chunkManagement != nullptr)
@@ -143,5 +166,13 @@ ChunkManagement* SharedChunk::release() noexcept
     return returnValue;
 }
 
+void SharedChunk::setNextLink(SharedChunk&& nextLink) noexcept
+{
+    if (m_chunkManagement != nullptr)
+    {
+        m_chunkManagement->m_nextLink = nextLink.release();
+    }
+}
+
 } // namespace mepoo
 } // namespace iox
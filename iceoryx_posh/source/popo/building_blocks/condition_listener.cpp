@@ -18,12 +18,15 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 
+#include <thread>
+
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+ConditionListener::ConditionListener(ConditionVariableData& condVarData, const WaitStrategy waitStrategy) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_waitStrategy(waitStrategy)
 {
 }
 
@@ -58,7 +61,7 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
+    return waitImpl(nullopt, [this]() -> bool {
         if (this->getMembers()->m_semaphore->wait().has_error())
         {
             errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
@@ -70,8 +73,9 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+    const optional<deadline_timer> deadline{in_place, timeToWait};
+    return waitImpl(deadline, [this, &deadline]() -> bool {
+        if (this->getMembers()->m_semaphore->timedWait(deadline->remainingTime()).has_error())
         {
             errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
         }
@@ -79,38 +83,102 @@ ConditionListener::NotificationVector_t ConditionListener::timedWait(const units
     });
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()>& waitCall) noexcept
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const optional<deadline_timer>& deadline,
+                                                                    const function_ref<bool()>& waitCall) noexcept
 {
-    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
-        {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
-            {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
-            }
-        }
+        collectActiveNotifications(activeNotifications);
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
             return activeNotifications;
         }
 
-        doReturnAfterNotificationCollection = !waitCall();
+        if (m_waitStrategy.type != WaitStrategyType::BLOCK && !pollActiveNotifications(deadline))
+        {
+            doReturnAfterNotificationCollection = deadline.has_value() && deadline->hasExpired();
+            continue;
+        }
+
+        // the notifiers post the semaphore only when a waiter is registered, therefore the notifications have to be
+        // checked once more after the registration to not miss one which was activated in between
+        getMembers()->m_numberOfWaiters.fetch_add(1U, std::memory_order_seq_cst);
+        if (!hasActiveNotifications())
+        {
+            doReturnAfterNotificationCollection = !waitCall();
+        }
+        getMembers()->m_numberOfWaiters.fetch_sub(1U, std::memory_order_relaxed);
     }
 
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+bool ConditionListener::pollActiveNotifications(const optional<deadline_timer>& deadline) const noexcept
+{
+    // the listener does not register as waiter while polling, therefore the notifiers do not post the semaphore
+    uint64_t numberOfPolls{0U};
+    while (!m_toBeDestroyed.load(std::memory_order_relaxed) && !hasActiveNotifications())
+    {
+        if (deadline.has_value() && deadline->hasExpired())
+        {
+            return false;
+        }
+
+        if (m_waitStrategy.type == WaitStrategyType::SPIN || numberOfPolls < m_waitStrategy.spinBudget)
+        {
+            ++numberOfPolls;
+        }
+        else if (m_waitStrategy.type == WaitStrategyType::SPIN_THEN_YIELD)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ConditionListener::hasActiveNotifications() const noexcept
+{
+    for (const auto& notificationWord : getMembers()->m_activeNotifications)
+    {
+        if (notificationWord.load(std::memory_order_seq_cst) != 0U)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+
+    for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
+    {
+        auto& notificationWord = getMembers()->m_activeNotifications[wordIndex];
+        if (notificationWord.load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+        uint64_t notifications = notificationWord.exchange(0U, std::memory_order_acquire);
+        while (notifications != 0U)
+        {
+            const auto bitIndex = static_cast<uint64_t>(__builtin_ctzll(notifications));
+            activeNotifications.emplace_back(
+                static_cast<Type_t>(wordIndex * ConditionVariableData::NOTIFICATIONS_PER_WORD + bitIndex));
+            // clear the lowest set bit
+            notifications &= notifications - 1U;
+        }
+    }
 }
 
 const ConditionVariableData* ConditionListener::getMembers() const noexcept
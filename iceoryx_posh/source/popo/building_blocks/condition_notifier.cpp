@@ -36,8 +36,25 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    const uint64_t notificationMask = 1ULL << (m_notificationIndex % ConditionVariableData::NOTIFICATIONS_PER_WORD);
+    auto& notificationWord =
+        getMembers()->m_activeNotifications[m_notificationIndex / ConditionVariableData::NOTIFICATIONS_PER_WORD];
+    const auto previousNotifications = notificationWord.fetch_or(notificationMask, std::memory_order_seq_cst);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+
+    // the notification is still pending, the notifier which activated it already took care of waking up the listener
+    if ((previousNotifications & notificationMask) != 0U)
+    {
+        return;
+    }
+
+    // the listener registers itself as waiter before it looks for active notifications for the last time, hence either
+    // the listener sees the notification or the notifier sees the waiting listener and has to post the semaphore
+    if (getMembers()->m_numberOfWaiters.load(std::memory_order_seq_cst) == 0U)
+    {
+        return;
+    }
+
     getMembers()->m_semaphore->post().or_else(
         [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
 }
@@ -21,6 +21,9 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint64_t ConditionVariableData::NOTIFICATIONS_PER_WORD;
+constexpr uint64_t ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS;
+
 ConditionVariableData::ConditionVariableData() noexcept
     : ConditionVariableData("")
 {
@@ -33,10 +36,17 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
         errorHandler(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
     });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
+
+bool ConditionVariableData::isNotificationActive(const uint64_t index) const noexcept
+{
+    const uint64_t notificationMask = 1ULL << (index % NOTIFICATIONS_PER_WORD);
+    return (m_activeNotifications[index / NOTIFICATIONS_PER_WORD].load(std::memory_order_relaxed) & notificationMask)
+           != 0U;
+}
 } // namespace popo
 } // namespace iox
@@ -0,0 +1,122 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t LatencyHistogram::SUB_BUCKETS_PER_RANGE;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_RANGES;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+void LatencyHistogram::record(const uint64_t latencyInNanoseconds) noexcept
+{
+    m_counts[bucketIndex(latencyInNanoseconds)].fetch_add(1U, std::memory_order_relaxed);
+
+    auto maxLatency = m_maxLatency.load(std::memory_order_relaxed);
+    while (latencyInNanoseconds > maxLatency
+           && !m_maxLatency.compare_exchange_weak(maxLatency, latencyInNanoseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+void LatencyHistogram::collect(LatencyHistogramSnapshot& snapshot) noexcept
+{
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        const uint64_t count = m_counts[i].exchange(0U, std::memory_order_relaxed);
+        snapshot.m_counts[i] += count;
+        snapshot.m_numberOfSamples += count;
+    }
+    snapshot.m_maxLatency = std::max(snapshot.m_maxLatency, m_maxLatency.exchange(0U, std::memory_order_relaxed));
+}
+
+uint64_t LatencyHistogram::currentTimestamp() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(mepoo::BaseClock_t::now().time_since_epoch()).count());
+}
+
+uint64_t LatencyHistogram::bucketIndex(const uint64_t latencyInNanoseconds) noexcept
+{
+    constexpr uint64_t LARGEST_LATENCY{(1ULL << NUMBER_OF_RANGES) - 1U};
+    const uint64_t latency = std::min(latencyInNanoseconds, LARGEST_LATENCY);
+    if (latency < SUB_BUCKETS_PER_RANGE)
+    {
+        return latency;
+    }
+
+    constexpr uint64_t BITS_OF_LATENCY{64U};
+    const uint64_t mostSignificantBit = BITS_OF_LATENCY - 1U - static_cast<uint64_t>(__builtin_clzll(latency));
+    const uint64_t shift = mostSignificantBit - SUB_BUCKET_BITS;
+    return (shift + 1U) * SUB_BUCKETS_PER_RANGE + ((latency >> shift) - SUB_BUCKETS_PER_RANGE);
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(const uint64_t index) noexcept
+{
+    if (index < SUB_BUCKETS_PER_RANGE)
+    {
+        return index;
+    }
+
+    const uint64_t shift = index / SUB_BUCKETS_PER_RANGE - 1U;
+    const uint64_t subBucket = index % SUB_BUCKETS_PER_RANGE;
+    return ((SUB_BUCKETS_PER_RANGE + subBucket + 1U) << shift) - 1U;
+}
+
+uint64_t LatencyHistogramSnapshot::numberOfSamples() const noexcept
+{
+    return m_numberOfSamples;
+}
+
+uint64_t LatencyHistogramSnapshot::maxLatency() const noexcept
+{
+    return m_maxLatency;
+}
+
+uint64_t LatencyHistogramSnapshot::percentile(const double fraction) const noexcept
+{
+    if (m_numberOfSamples == 0U)
+    {
+        return 0U;
+    }
+
+    const auto rank =
+        static_cast<uint64_t>(std::ceil(std::max(fraction, 0.0) * static_cast<double>(m_numberOfSamples)));
+    const uint64_t clampedRank = std::min(std::max(rank, static_cast<uint64_t>(1U)), m_numberOfSamples);
+
+    uint64_t accumulatedCount{0U};
+    for (uint64_t i = 0U; i < LatencyHistogram::NUMBER_OF_BUCKETS; ++i)
+    {
+        accumulatedCount += m_counts[i];
+        if (accumulatedCount >= clampedRank)
+        {
+            return std::min(LatencyHistogram::bucketUpperBound(i), m_maxLatency);
+        }
+    }
+    return m_maxLatency;
+}
+
+} // namespace popo
+} // namespace iox
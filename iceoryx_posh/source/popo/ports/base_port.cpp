@@ -16,11 +16,14 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
 namespace iox
 {
 namespace popo
 {
+constexpr uint64_t BasePort::DISCOVERY_NOTIFICATION_INDEX;
+
 BasePort::BasePort(MemberType_t* const basePortDataPtr) noexcept
     : m_basePortDataPtr(basePortDataPtr)
 {
@@ -69,6 +72,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    requestDiscovery();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -76,5 +80,22 @@ bool BasePort::toBeDestroyed() const noexcept
     return getMembers()->m_toBeDestroyed.load(std::memory_order_relaxed);
 }
 
+void BasePort::requestDiscovery() noexcept
+{
+    // release pairs with the acquire in takeDiscoveryRequest, RouDi sees the CaPro state stored before the request
+    getMembers()->m_discoveryRequested.store(true, std::memory_order_release);
+
+    auto discoveryConditionVariable = getMembers()->m_discoveryConditionVariable.get();
+    if (discoveryConditionVariable != nullptr)
+    {
+        ConditionNotifier(*discoveryConditionVariable, DISCOVERY_NOTIFICATION_INDEX).notify();
+    }
+}
+
+bool BasePort::takeDiscoveryRequest() noexcept
+{
+    return getMembers()->m_discoveryRequested.exchange(false, std::memory_order_acquire);
+}
+
 } // namespace popo
 } // namespace iox
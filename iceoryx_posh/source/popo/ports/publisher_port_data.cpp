@@ -17,6 +17,8 @@
 
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
@@ -27,8 +29,14 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
                                      const PublisherOptions& publisherOptions,
                                      const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, publisherOptions.nodeName)
-    , m_chunkSenderData(
-          memoryManager, publisherOptions.subscriberTooSlowPolicy, publisherOptions.historyCapacity, memoryInfo)
+    , m_chunkSenderData(memoryManager,
+                        publisherOptions.subscriberTooSlowPolicy,
+                        publisherOptions.historyCapacity,
+                        memoryInfo,
+                        publisherOptions.subscriberTooSlowTimeout,
+                        static_cast<uint32_t>(std::min(publisherOptions.chunkMagazineCapacity,
+                                                       static_cast<uint64_t>(MAX_CHUNK_MAGAZINE_CAPACITY))),
+                        publisherOptions.stampSendTime)
     , m_options{publisherOptions}
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
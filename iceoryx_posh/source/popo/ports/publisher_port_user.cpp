@@ -48,6 +48,20 @@ PublisherPortUser::tryAllocateChunk(const uint32_t userPayloadSize,
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
 }
 
+expected<mepoo::ChunkHeader*, AllocationError>
+PublisherPortUser::tryAllocateChunkChain(const uint64_t chainPayloadSize,
+                                         const uint32_t linkPayloadSize,
+                                         const uint32_t userPayloadAlignment) noexcept
+{
+    return m_chunkSender.tryAllocateChain(getUniqueID(), chainPayloadSize, linkPayloadSize, userPayloadAlignment);
+}
+
+expected<mepoo::ChunkHeader*, AllocationError>
+PublisherPortUser::tryResizeChunk(mepoo::ChunkHeader* const chunkHeader, const uint32_t userPayloadSize) noexcept
+{
+    return m_chunkSender.tryResize(chunkHeader, userPayloadSize);
+}
+
 void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkSender.release(chunkHeader);
@@ -71,6 +85,24 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.sendBatch(chunkHeaders);
+    }
+    else
+    {
+        // like in sendChunk, a not offered publisher port only updates the history
+        for (auto chunkHeader : chunkHeaders)
+        {
+            m_chunkSender.pushToHistory(chunkHeader);
+        }
+    }
+}
+
 optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
@@ -81,6 +113,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
@@ -89,6 +122,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
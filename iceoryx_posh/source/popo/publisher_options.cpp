@@ -17,17 +17,29 @@
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iox/logging.hpp"
 
+#include <limits>
+
 namespace iox
 {
 namespace popo
 {
 cxx::Serialization PublisherOptions::serialize() const noexcept
 {
+    // durations which do not fit into the nanoseconds representation are transferred as infinite timeout
+    const uint64_t subscriberTooSlowTimeoutNanoseconds = subscriberTooSlowTimeout.toNanoseconds();
+    const bool hasSubscriberTooSlowTimeout =
+        subscriberTooSlowTimeoutNanoseconds < std::numeric_limits<uint64_t>::max();
+
     return cxx::Serialization::create(
         historyCapacity,
         nodeName,
         offerOnCreate,
-        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+        hasSubscriberTooSlowTimeout,
+        hasSubscriberTooSlowTimeout ? subscriberTooSlowTimeoutNanoseconds : 0U,
+        chunkMagazineCapacity,
+        stampSendTime,
+        numaNode);
 }
 
 expected<PublisherOptions, cxx::Serialization::Error>
@@ -37,11 +49,18 @@ PublisherOptions::deserialize(const cxx::Serialization& serialized) noexcept
 
     PublisherOptions publisherOptions;
     ConsumerTooSlowPolicyUT subscriberTooSlowPolicy;
+    bool hasSubscriberTooSlowTimeout{false};
+    uint64_t subscriberTooSlowTimeoutNanoseconds{0U};
 
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        hasSubscriberTooSlowTimeout,
+                                                        subscriberTooSlowTimeoutNanoseconds,
+                                                        publisherOptions.chunkMagazineCapacity,
+                                                        publisherOptions.stampSendTime,
+                                                        publisherOptions.numaNode);
 
     if (!deserializationSuccessful
         || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
@@ -50,6 +69,9 @@ PublisherOptions::deserialize(const cxx::Serialization& serialized) noexcept
     }
 
     publisherOptions.subscriberTooSlowPolicy = static_cast<ConsumerTooSlowPolicy>(subscriberTooSlowPolicy);
+    publisherOptions.subscriberTooSlowTimeout =
+        hasSubscriberTooSlowTimeout ? units::Duration::fromNanoseconds(subscriberTooSlowTimeoutNanoseconds)
+                                    : units::Duration::max();
     return success<PublisherOptions>(publisherOptions);
 }
 } // namespace popo
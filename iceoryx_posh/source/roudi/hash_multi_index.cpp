@@ -0,0 +1,65 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/hash_multi_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+namespace
+{
+constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+uint64_t hashBytes(uint64_t hash, const char* const data, const uint64_t size) noexcept
+{
+    for (uint64_t i = 0U; i < size; ++i)
+    {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+uint64_t hashIdString(const uint64_t hash, const capro::IdString_t& id) noexcept
+{
+    // the size is part of the hash, otherwise e.g. ("ab", "c") and ("a", "bc") would collide
+    const uint64_t size = id.size();
+    return hashBytes(hashBytes(hash, id.c_str(), size), reinterpret_cast<const char*>(&size), sizeof(size));
+}
+uint64_t foldHighBits(const uint64_t hash) noexcept
+{
+    // the HashMultiIndex selects the bucket with the low bits which are the weakest ones of FNV-1a
+    constexpr uint64_t HALF_OF_THE_BITS{32U};
+    return hash ^ (hash >> HALF_OF_THE_BITS);
+}
+} // namespace
+
+uint64_t hashIdString(const capro::IdString_t& id) noexcept
+{
+    return foldHighBits(hashIdString(FNV_OFFSET_BASIS, id));
+}
+
+uint64_t hashServiceDescription(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    uint64_t hash = hashIdString(FNV_OFFSET_BASIS, serviceDescription.getServiceIDString());
+    hash = hashIdString(hash, serviceDescription.getInstanceIDString());
+    return foldHighBits(hashIdString(hash, serviceDescription.getEventIDString()));
+}
+
+} // namespace roudi
+} // namespace iox
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/roudi/memory/default_roudi_memory.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/memory.hpp"
 
@@ -57,6 +58,15 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexce
     mempoolConfig.m_mempoolConfig.push_back(
         {align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          CHUNK_COUNT});
+    mempoolConfig.m_mempoolConfig.push_back(
+        {align(static_cast<uint32_t>(sizeof(roudi::SubscriberLatencyIntrospectionFieldTopic)), ALIGNMENT),
+         CHUNK_COUNT});
+    // the changes of the service registry are small and many of them are kept in the history; the applications
+    // release the changes right after applying them
+    constexpr uint32_t SERVICE_REGISTRY_CHANGE_CHUNK_COUNT{
+        static_cast<uint32_t>(2U * ServiceRegistry::CHANGE_HISTORY_CAPACITY) + CHUNK_COUNT};
+    mempoolConfig.m_mempoolConfig.push_back({align(static_cast<uint32_t>(sizeof(ServiceRegistry::Change)), ALIGNMENT),
+                                             SERVICE_REGISTRY_CHANGE_CHUNK_COUNT});
 
     mempoolConfig.optimize();
     return mempoolConfig;
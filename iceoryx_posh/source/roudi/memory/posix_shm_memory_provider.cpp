@@ -31,10 +31,12 @@ constexpr access_rights PosixShmMemoryProvider::SHM_MEMORY_PERMISSIONS;
 
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmName_t& shmName,
                                                const posix::AccessMode accessMode,
-                                               const posix::OpenMode openMode) noexcept
+                                               const posix::OpenMode openMode,
+                                               const mepoo::SegmentMemoryOptions& memoryOptions) noexcept
     : m_shmName(shmName)
     , m_accessMode(accessMode)
     , m_openMode(openMode)
+    , m_memoryOptions(memoryOptions)
 {
 }
 
@@ -60,6 +62,9 @@ expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(const
              .accessMode(m_accessMode)
              .openMode(m_openMode)
              .permissions(SHM_MEMORY_PERMISSIONS)
+             .hugePages(m_memoryOptions.hugePages)
+             .prefault(m_memoryOptions.prefault)
+             .lockInMemory(m_memoryOptions.lockInMemory)
              .create()
              .and_then([this](auto& sharedMemoryObject) { m_shmObject.emplace(std::move(sharedMemoryObject)); }))
     {
@@ -66,15 +66,26 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     registryPortOptions.nodeName = iox::NodeName_t("Service Registry");
     registryPortOptions.offerOnCreate = true;
 
-    // we cannot (fully) perform discovery without this port
+    // the history contains the changes since the latest full copy of the registry for late joining applications
+    popo::PublisherOptions registryChangePortOptions{registryPortOptions};
+    registryChangePortOptions.historyCapacity = ServiceRegistry::CHANGE_HISTORY_CAPACITY;
+
+    // we cannot (fully) perform discovery without these ports
     m_serviceRegistryPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         registryPortOptions,
         introspectionMemoryManager);
+    m_serviceRegistryChangePublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGES_EVENT_NAME},
+        registryChangePortOptions,
+        introspectionMemoryManager);
 
-    // if we arrive here, the port for service discovery exists and we perform the discovery
+    // if we arrive here, the ports for service discovery exist and we perform the discovery
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
+    PublisherPortRouDiType serviceRegistryChangePort(*m_serviceRegistryChangePublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryChangePort);
+    publishServiceRegistry();
 
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
@@ -89,9 +100,13 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     auto subscriberPortsData = acquireInternalPublisherPortData(
         IntrospectionSubscriberPortChangingDataService, options, introspectionMemoryManager);
 
+    auto subscriberLatency =
+        acquireInternalPublisherPortData(IntrospectionSubscriberLatencyService, options, introspectionMemoryManager);
+
     m_portIntrospection.registerPublisherPort(PublisherPortUserType(std::move(portGeneric)),
                                               PublisherPortUserType(std::move(portThroughput)),
-                                              PublisherPortUserType(std::move(subscriberPortsData)));
+                                              PublisherPortUserType(std::move(subscriberPortsData)),
+                                              PublisherPortUserType(std::move(subscriberLatency)));
     m_portIntrospection.run();
 }
 
@@ -102,6 +117,7 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     handlePublisherPorts();
 
     handleSubscriberPorts();
@@ -124,7 +140,11 @@ void PortManager::handlePublisherPorts() noexcept
     {
         PublisherPortRouDiType publisherPort(publisherPortData);
 
-        doDiscoveryForPublisherPort(publisherPort);
+        // only the ports with a changed CaPro state have to be processed
+        if (publisherPort.takeDiscoveryRequest())
+        {
+            doDiscoveryForPublisherPort(publisherPort);
+        }
 
         // check if we have to destroy this publisher port
         if (publisherPort.toBeDestroyed())
@@ -169,7 +189,11 @@ void PortManager::handleSubscriberPorts() noexcept
     {
         SubscriberPortType subscriberPort(subscriberPortData);
 
-        doDiscoveryForSubscriberPort(subscriberPort);
+        // only the ports with a changed CaPro state have to be processed
+        if (subscriberPort.takeDiscoveryRequest())
+        {
+            doDiscoveryForSubscriberPort(subscriberPort);
+        }
 
         // check if we have to destroy this subscriber port
         if (subscriberPort.toBeDestroyed())
@@ -246,7 +270,11 @@ void PortManager::handleClientPorts() noexcept
     {
         popo::ClientPortRouDi clientPort(*clientPortData);
 
-        doDiscoveryForClientPort(clientPort);
+        // only the ports with a changed CaPro state have to be processed
+        if (clientPort.takeDiscoveryRequest())
+        {
+            doDiscoveryForClientPort(clientPort);
+        }
 
         // check if we have to destroy this clinet port
         if (clientPort.toBeDestroyed())
@@ -335,7 +363,11 @@ void PortManager::handleServerPorts() noexcept
     {
         popo::ServerPortRouDi serverPort(*serverPortData);
 
-        doDiscoveryForServerPort(serverPort);
+        // only the ports with a changed CaPro state have to be processed
+        if (serverPort.takeDiscoveryRequest())
+        {
+            doDiscoveryForServerPort(serverPort);
+        }
 
         // check if we have to destroy this server port
         if (serverPort.toBeDestroyed())
@@ -497,7 +529,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList(subscriberSource.getCaProServiceDescription()))
     {
         PublisherPortRouDiType publisherPort(publisherPortData);
 
@@ -508,7 +540,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
         // they do not have the same interface otherwise we have cyclic connections in gateways
         if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
         {
-            break;
+            continue;
         }
 
         if (isCompatiblePubSub(publisherPort, subscriberSource))
@@ -535,7 +567,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList(publisherSource.getCaProServiceDescription()))
     {
         SubscriberPortType subscriberPort(subscriberPortData);
 
@@ -546,7 +578,7 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
         // they do not have the same interface otherwise we have cyclic connections in gateways
         if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
         {
-            break;
+            continue;
         }
 
         if (isCompatiblePubSub(publisherSource, subscriberPort))
@@ -601,7 +633,7 @@ bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
 void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
                                                popo::ServerPortRouDi& serverSource) noexcept
 {
-    for (auto clientPortData : m_portPool->getClientPortDataList())
+    for (auto clientPortData : m_portPool->getClientPortDataList(serverSource.getCaProServiceDescription()))
     {
         popo::ClientPortRouDi clientPort(*clientPortData);
         if (isCompatibleClientServer(serverSource, clientPort))
@@ -638,7 +670,7 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
     bool serverFound = false;
-    for (auto serverPortData : m_portPool->getServerPortDataList())
+    for (auto serverPortData : m_portPool->getServerPortDataList(clientSource.getCaProServiceDescription()))
     {
         popo::ServerPortRouDi serverPort(*serverPortData);
         if (isCompatibleClientServer(serverPort, clientSource))
@@ -679,6 +711,7 @@ void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& mes
 
 void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     for (auto port : m_portPool->getPublisherPortDataList())
     {
         PublisherPortRouDiType publisherPort(port);
@@ -702,6 +735,7 @@ void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName) noexc
 
 void PortManager::unblockRouDiShutdown() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     makeAllPublisherPortsToStopOffer();
     makeAllServerPortsToStopOffer();
 }
@@ -719,10 +753,12 @@ void PortManager::makeAllPublisherPortsToStopOffer() noexcept
 
 void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept
 {
-    // If we delete all ports from RouDi we need to reset the service registry publisher
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
+    // If we delete all ports from RouDi we need to reset the service registry publishers
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
+        m_serviceRegistryChangePublisherPortData.reset();
     }
     for (auto port : m_portPool->getPublisherPortDataList())
     {
@@ -850,6 +886,7 @@ PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
                                       mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                       const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     return acquirePublisherPortDataWithoutDiscovery(
                service, publisherOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo)
         .and_then([&](auto publisherPortData) {
@@ -908,6 +945,7 @@ PortManager::acquireInternalPublisherPortData(const capro::ServiceDescription& s
                                               const popo::PublisherOptions& publisherOptions,
                                               mepoo::MemoryManager* const payloadDataSegmentMemoryManager) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     return acquirePublisherPortDataWithoutDiscovery(
                service, publisherOptions, IPC_CHANNEL_ROUDI_NAME, payloadDataSegmentMemoryManager, PortConfigInfo())
         .or_else([&service](auto&) {
@@ -942,6 +980,7 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
                                        const RuntimeName_t& runtimeName,
                                        const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     auto maybeSubscriberPortData =
         m_portPool->addSubscriberPort(service, runtimeName, subscriberOptions, portConfigInfo.memoryInfo);
     if (!maybeSubscriberPortData.has_error())
@@ -967,6 +1006,7 @@ PortManager::acquireClientPortData(const capro::ServiceDescription& service,
                                    mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                    const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     // we can create a new port
     return m_portPool
         ->addClientPort(service, payloadDataSegmentMemoryManager, runtimeName, clientOptions, portConfigInfo.memoryInfo)
@@ -986,6 +1026,7 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
                                    mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                    const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     // it is not allowed to have two servers with the same ServiceDescription;
     // check if the server is already in the list
     for (const auto serverPortData : m_portPool->getServerPortDataList())
@@ -1023,6 +1064,7 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
                                                                const RuntimeName_t& runtimeName,
                                                                const NodeName_t& /*node*/) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     auto result = m_portPool->addInterfacePort(runtimeName, interface);
     if (!result.has_error())
     {
@@ -1034,7 +1076,7 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
     }
 }
 
-void PortManager::publishServiceRegistry() const noexcept
+void PortManager::publishServiceRegistry() noexcept
 {
     if (!m_serviceRegistryPublisherPortData.has_value())
     {
@@ -1054,10 +1096,40 @@ void PortManager::publishServiceRegistry() const noexcept
             new (chunk->userPayload()) ServiceRegistry(m_serviceRegistry);
 
             publisher.sendChunk(chunk);
+            m_serviceRegistrySnapshotGeneration = m_serviceRegistry.generation();
         })
         .or_else([](auto&) { IOX_LOG(WARN) << "Could not allocate a chunk for the service registry!"; });
 }
 
+void PortManager::publishServiceRegistryChange(const ServiceRegistry::Change::Operation operation,
+                                               const capro::ServiceDescription& service) noexcept
+{
+    bool isChangePublished{false};
+    if (m_serviceRegistryChangePublisherPortData.has_value())
+    {
+        PublisherPortUserType publisher(m_serviceRegistryChangePublisherPortData.value());
+        publisher
+            .tryAllocateChunk(sizeof(ServiceRegistry::Change),
+                              alignof(ServiceRegistry::Change),
+                              CHUNK_NO_USER_HEADER_SIZE,
+                              CHUNK_NO_USER_HEADER_ALIGNMENT)
+            .and_then([&](auto& chunk) {
+                new (chunk->userPayload()) ServiceRegistry::Change(m_serviceRegistry.generation(), operation, service);
+                publisher.sendChunk(chunk);
+                isChangePublished = true;
+            })
+            .or_else([](auto&) { IOX_LOG(WARN) << "Could not allocate a chunk for the service registry change!"; });
+    }
+
+    // the applications which missed a change fall back to the latest full copy of the registry, therefore it must
+    // not be older than the changes in the history
+    if (!isChangePublished
+        || m_serviceRegistry.generation() - m_serviceRegistrySnapshotGeneration >= ServiceRegistry::SNAPSHOT_INTERVAL)
+    {
+        publishServiceRegistry();
+    }
+}
+
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
 {
     return m_serviceRegistry;
@@ -1069,13 +1141,13 @@ void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription&
         IOX_LOG(WARN) << "Could not add publisher with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistry::Change::Operation::ADD_PUBLISHER, service);
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removePublisher(service);
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistry::Change::Operation::REMOVE_PUBLISHER, service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
@@ -1084,24 +1156,26 @@ void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& se
         IOX_LOG(WARN) << "Could not add server with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistry::Change::Operation::ADD_SERVER, service);
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removeServer(service);
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistry::Change::Operation::REMOVE_SERVER, service);
 }
 
 expected<runtime::NodeData*, PortPoolError> PortManager::acquireNodeData(const RuntimeName_t& runtimeName,
                                                                          const NodeName_t& nodeName) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     return m_portPool->addNodeData(runtimeName, nodeName, 0);
 }
 
 expected<popo::ConditionVariableData*, PortPoolError>
 PortManager::acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_portPoolMutex);
     return m_portPool->addConditionVariableData(runtimeName);
 }
 
@@ -22,6 +22,47 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+template <typename PortData>
+auto hasServiceDescription(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return [&serviceDescription](const PortData* const portData) {
+        return portData->m_serviceDescription == serviceDescription;
+    };
+}
+
+template <typename PortData, uint64_t Capacity>
+void addToPortIndex(HashMultiIndex<PortData*, Capacity>& portIndex, PortData* const portData) noexcept
+{
+    // the index has the same capacity as the port container, therefore the insertion cannot fail
+    const auto& serviceDescription = portData->m_serviceDescription;
+    portIndex.insert(
+        hashServiceDescription(serviceDescription), portData, hasServiceDescription<PortData>(serviceDescription));
+}
+
+template <typename PortData, uint64_t Capacity>
+void removeFromPortIndex(HashMultiIndex<PortData*, Capacity>& portIndex, const PortData* const portData) noexcept
+{
+    // the index stores non-const pointers, the pointer is only compared and not modified
+    const auto& serviceDescription = portData->m_serviceDescription;
+    portIndex.erase(hashServiceDescription(serviceDescription),
+                    const_cast<PortData*>(portData),
+                    hasServiceDescription<PortData>(serviceDescription));
+}
+
+template <typename PortData, uint64_t Capacity>
+vector<PortData*, Capacity> findInPortIndex(const HashMultiIndex<PortData*, Capacity>& portIndex,
+                                            const capro::ServiceDescription& serviceDescription) noexcept
+{
+    vector<PortData*, Capacity> ports;
+    portIndex.forEach(hashServiceDescription(serviceDescription),
+                      hasServiceDescription<PortData>(serviceDescription),
+                      [&](PortData* const portData) { ports.push_back(portData); });
+    return ports;
+}
+} // namespace
+
 PortPool::PortPool(PortPoolData& portPoolData) noexcept
     : m_portPoolData(&portPoolData)
 {
@@ -49,6 +90,7 @@ expected<popo::InterfacePortData*, PortPoolError> PortPool::addInterfacePort(con
     if (m_portPoolData->m_interfacePortMembers.hasFreeSpace())
     {
         auto interfacePortData = m_portPoolData->m_interfacePortMembers.insert(runtimeName, interface);
+        requestInitialDiscovery(*interfacePortData);
         return success<popo::InterfacePortData*>(interfacePortData);
     }
     else
@@ -129,6 +171,8 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
     {
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
             serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+        addToPortIndex(m_publisherPortIndex, publisherPortData);
+        requestInitialDiscovery(*publisherPortData);
         return success<PublisherPortRouDiType::MemberType_t*>(publisherPortData);
     }
     else
@@ -150,6 +194,8 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
     {
         auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
             serviceDescription, runtimeName, subscriberOptions, memoryInfo);
+        addToPortIndex(m_subscriberPortIndex, subscriberPortData);
+        requestInitialDiscovery(*subscriberPortData);
 
         return success<SubscriberPortType::MemberType_t*>(subscriberPortData);
     }
@@ -189,6 +235,8 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
 
     auto clientPortData = m_portPoolData->m_clientPortMembers.insert(
         serviceDescription, runtimeName, clientOptions, memoryManager, memoryInfo);
+    addToPortIndex(m_clientPortIndex, clientPortData);
+    requestInitialDiscovery(*clientPortData);
     return success<popo::ClientPortData*>(clientPortData);
 }
 
@@ -209,25 +257,66 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
 
     auto serverPortData = m_portPoolData->m_serverPortMembers.insert(
         serviceDescription, runtimeName, serverOptions, memoryManager, memoryInfo);
+    addToPortIndex(m_serverPortIndex, serverPortData);
+    requestInitialDiscovery(*serverPortData);
     return success<popo::ServerPortData*>(serverPortData);
 }
 
+vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+PortPool::getPublisherPortDataList(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return findInPortIndex(m_publisherPortIndex, serviceDescription);
+}
+
+vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+PortPool::getSubscriberPortDataList(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return findInPortIndex(m_subscriberPortIndex, serviceDescription);
+}
+
+vector<popo::ClientPortData*, MAX_CLIENTS>
+PortPool::getClientPortDataList(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return findInPortIndex(m_clientPortIndex, serviceDescription);
+}
+
+vector<popo::ServerPortData*, MAX_SERVERS>
+PortPool::getServerPortDataList(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return findInPortIndex(m_serverPortIndex, serviceDescription);
+}
+
+popo::ConditionVariableData& PortPool::getDiscoveryConditionVariable() noexcept
+{
+    return m_portPoolData->m_discoveryConditionVariable;
+}
+
+void PortPool::requestInitialDiscovery(popo::BasePortData& portData) noexcept
+{
+    portData.m_discoveryConditionVariable = &m_portPoolData->m_discoveryConditionVariable;
+    popo::BasePort(&portData).requestDiscovery();
+}
+
 void PortPool::removePublisherPort(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
+    removeFromPortIndex(m_publisherPortIndex, portData);
     m_portPoolData->m_publisherPortMembers.erase(portData);
 }
 
 void PortPool::removeSubscriberPort(const SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    removeFromPortIndex(m_subscriberPortIndex, portData);
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
 void PortPool::removeClientPort(const popo::ClientPortData* const portData) noexcept
 {
+    removeFromPortIndex(m_clientPortIndex, portData);
     m_portPoolData->m_clientPortMembers.erase(portData);
 }
 void PortPool::removeServerPort(const popo::ServerPortData* const portData) noexcept
 {
+    removeFromPortIndex(m_serverPortIndex, portData);
     m_portPoolData->m_serverPortMembers.erase(portData);
 }
 
@@ -59,6 +59,16 @@ void Process::sendViaIpcChannel(const runtime::IpcMessage& data) noexcept
     }
 }
 
+void Process::sendViaIpcChannel(const runtime::IpcBinaryMessage& data) noexcept
+{
+    bool sendSuccess = m_ipcChannel.send(data);
+    if (!sendSuccess)
+    {
+        IOX_LOG(WARN) << "Process cannot send message over communication channel";
+        errorHandler(PoshError::POSH__ROUDI_PROCESS_SEND_VIA_IPC_CHANNEL_FAILED, ErrorLevel::MODERATE);
+    }
+}
+
 uint64_t Process::getSessionId() noexcept
 {
     return m_sessionId.load(std::memory_order_relaxed);
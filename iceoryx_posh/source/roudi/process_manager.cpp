@@ -79,6 +79,7 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
 
 void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             m_portManager.unblockProcessShutdown(name);
@@ -92,6 +93,7 @@ void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t
 
 void ProcessManager::requestShutdownOfAllProcesses() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
     for (auto& process : m_processList)
     {
@@ -104,6 +106,7 @@ void ProcessManager::requestShutdownOfAllProcesses() noexcept
 
 bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         if (isProcessAlive(process))
@@ -116,6 +119,7 @@ bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 
 void ProcessManager::killAllProcesses() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(WARN) << "Process ID " << process.getPid() << " named '" << process.getName()
@@ -126,6 +130,7 @@ void ProcessManager::killAllProcesses() noexcept
 
 void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(WARN) << "Process ID " << process.getPid() << " named '" << process.getName()
@@ -195,6 +200,7 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
                                      const uint64_t sessionId,
                                      const version::VersionInfo& versionInfo) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     bool returnValue{false};
 
     findProcess(name)
@@ -281,6 +287,7 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
 
 bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     constexpr TerminationFeedback FEEDBACK{TerminationFeedback::SEND_ACK_TO_PROCESS};
     if (!searchForProcessAndRemoveIt(name, FEEDBACK))
     {
@@ -334,6 +341,7 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 
 void ProcessManager::updateLivelinessOfProcess(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // reset timestamp
@@ -346,6 +354,7 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
                                             capro::Interfaces interface,
                                             const NodeName_t& node) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // create a ReceiverPort
@@ -366,6 +375,7 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
 
 void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const NodeName_t& nodeName) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(runtimeName)
         .and_then([&](auto& process) {
             m_portManager.acquireNodeData(runtimeName, nodeName)
@@ -397,12 +407,22 @@ void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const N
         .or_else([&]() { IOX_LOG(WARN) << "Unknown process " << runtimeName << " requested a node."; });
 }
 
-void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept
+void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name,
+                                                      const runtime::IpcMessageEncoding encoding) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name).and_then([&](auto& process) {
-        runtime::IpcMessage sendBuffer;
-        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::MESSAGE_NOT_SUPPORTED);
-        process->sendViaIpcChannel(sendBuffer);
+        if (encoding == runtime::IpcMessageEncoding::BINARY)
+        {
+            process->sendViaIpcChannel(
+                runtime::IpcBinaryMessage(runtime::IpcMessageType::MESSAGE_NOT_SUPPORTED, name));
+        }
+        else
+        {
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::MESSAGE_NOT_SUPPORTED);
+            process->sendViaIpcChannel(sendBuffer);
+        }
 
         IOX_LOG(ERROR) << "Application " << name << " sent a message, which is not supported by this RouDi";
     });
@@ -413,34 +433,12 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
                                              const popo::SubscriberOptions& subscriberOptions,
                                              const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
-            // create a SubscriberPort
-            auto maybeSubscriber =
-                m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
-
-            if (!maybeSubscriber.has_error())
-            {
-                // send SubscriberPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(DEBUG) << "Created new SubscriberPort for application '" << name
-                               << "' with service description '" << service << "'";
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(ERROR) << "Could not create SubscriberPort for application '" << name
-                               << "' with service description '" << service << "'";
-            }
+            sendPortCreationResponse(*process,
+                                     runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK,
+                                     acquireSubscriberForProcess(*process, service, subscriberOptions, portConfigInfo));
         })
         .or_else([&]() {
             IOX_LOG(WARN) << "Unknown application '" << name
@@ -453,68 +451,12 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                                             const popo::PublisherOptions& publisherOptions,
                                             const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
-        .and_then([&](auto& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            auto maybePublisher = m_portManager.acquirePublisherPortData(
-                service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
-
-            if (!maybePublisher.has_error())
-            {
-                // send PublisherPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(DEBUG) << "Created new PublisherPort for application '" << name
-                               << "' with service description '" << service << "'";
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-
-                std::string error;
-                switch (maybePublisher.get_error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
-                    break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
-                    break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
-                    break;
-                }
-                }
-                sendBuffer << error;
-
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(ERROR) << "Could not create PublisherPort for application '" << name
-                               << "' with service description '" << service << "'";
-            }
+        .and_then([&](auto& process) {
+            sendPortCreationResponse(*process,
+                                     runtime::IpcMessageType::CREATE_PUBLISHER_ACK,
+                                     acquirePublisherForProcess(*process, service, publisherOptions, portConfigInfo));
         })
         .or_else([&]() {
             IOX_LOG(WARN) << "Unknown application '" << name << "' requested a PublisherPort with service description '"
@@ -527,46 +469,12 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                                          const popo::ClientOptions& clientOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
-        .and_then([&](auto& process) { // create a ClientPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            m_portManager
-                .acquireClientPortData(
-                    service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& clientPort) {
-                    auto relativePtrToClientPort =
-                        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, clientPort);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
-                               << cxx::convert::toString(relativePtrToClientPort)
-                               << cxx::convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(DEBUG) << "Created new ClientPort for application '" << name
-                                   << "' with service description '" << service << "'";
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(ERROR) << "Could not create ClientPort for application '" << name
-                                   << "' with service description '" << service << "'";
-                });
+        .and_then([&](auto& process) {
+            sendPortCreationResponse(*process,
+                                     runtime::IpcMessageType::CREATE_CLIENT_ACK,
+                                     acquireClientForProcess(*process, service, clientOptions, portConfigInfo));
         })
         .or_else([&]() {
             IOX_LOG(WARN) << "Unknown application '" << name << "' requested a ClientPort with service description '"
@@ -579,55 +487,269 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                                          const popo::ServerOptions& serverOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
-        .and_then([&](auto& process) { // create a ServerPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+        .and_then([&](auto& process) {
+            sendPortCreationResponse(*process,
+                                     runtime::IpcMessageType::CREATE_SERVER_ACK,
+                                     acquireServerForProcess(*process, service, serverOptions, portConfigInfo));
+        })
+        .or_else([&]() {
+            IOX_LOG(WARN) << "Unknown application '" << name << "' requested a ServerPort with service description '"
+                          << service << "'";
+        });
+}
+
+void ProcessManager::addPortsForProcess(const RuntimeName_t& name, runtime::IpcBinaryMessage& request) noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
+    findProcess(name)
+        .and_then([&](auto& process) {
+            runtime::IpcBinaryMessage response(runtime::IpcMessageType::CREATE_PORTS_ACK, name);
 
-            if (!segmentInfo.m_memoryManager.has_value())
+            const auto numberOfEntries = request.getNumberOfEntries();
+            for (uint16_t i = 0U; i < numberOfEntries; ++i)
             {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
+                runtime::IpcMessageType ackType{runtime::IpcMessageType::NOTYPE};
+                auto result = acquirePortForProcess(*process, request, ackType);
+                if (!request.isValid() || ackType == runtime::IpcMessageType::NOTYPE)
+                {
+                    // the remaining entries cannot be read, the runtime detects the missing entries in the response
+                    IOX_LOG(ERROR) << "Application '" << name << "' sent an invalid request to create ports";
+                    break;
+                }
+
+                result
+                    .and_then([&](auto offset) {
+                        response.addEntry(ackType) << offset << m_mgmtSegmentId;
+                    })
+                    .or_else([&](auto error) { response.addEntry(runtime::IpcMessageType::ERROR) << error; });
             }
 
-            m_portManager
-                .acquireServerPortData(
-                    service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& serverPort) {
-                    auto relativePtrToServerPort =
-                        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, serverPort);
+            process->sendViaIpcChannel(response);
+        })
+        .or_else([&]() { IOX_LOG(WARN) << "Unknown application '" << name << "' requested to create ports"; });
+}
 
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
-                               << cxx::convert::toString(relativePtrToServerPort)
-                               << cxx::convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType> ProcessManager::acquirePortForProcess(
+    Process& process, runtime::IpcBinaryMessage& request, runtime::IpcMessageType& ackType) noexcept
+{
+    runtime::IpcMessageType entryType{runtime::IpcMessageType::NOTYPE};
+    capro::ServiceDescription service;
+    PortConfigInfo portConfigInfo;
+    request >> entryType;
 
-                    IOX_LOG(DEBUG) << "Created new ServerPort for application '" << name
-                                   << "' with service description '" << service << "'";
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
+    switch (entryType)
+    {
+    case runtime::IpcMessageType::CREATE_PUBLISHER:
+    {
+        popo::PublisherOptions publisherOptions;
+        request >> service >> publisherOptions >> portConfigInfo;
+        ackType = runtime::IpcMessageType::CREATE_PUBLISHER_ACK;
+        if (request.isValid())
+        {
+            return acquirePublisherForProcess(process, service, publisherOptions, portConfigInfo);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+    {
+        popo::SubscriberOptions subscriberOptions;
+        request >> service >> subscriberOptions >> portConfigInfo;
+        ackType = runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK;
+        if (request.isValid())
+        {
+            return acquireSubscriberForProcess(process, service, subscriberOptions, portConfigInfo);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_CLIENT:
+    {
+        popo::ClientOptions clientOptions;
+        request >> service >> clientOptions >> portConfigInfo;
+        ackType = runtime::IpcMessageType::CREATE_CLIENT_ACK;
+        if (request.isValid())
+        {
+            return acquireClientForProcess(process, service, clientOptions, portConfigInfo);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_SERVER:
+    {
+        popo::ServerOptions serverOptions;
+        request >> service >> serverOptions >> portConfigInfo;
+        ackType = runtime::IpcMessageType::CREATE_SERVER_ACK;
+        if (request.isValid())
+        {
+            return acquireServerForProcess(process, service, serverOptions, portConfigInfo);
+        }
+        break;
+    }
+    default:
+    {
+        break;
+    }
+    }
 
-                    IOX_LOG(ERROR) << "Could not create ServerPort for application '" << name
-                                   << "' with service description '" << service << "'";
-                });
-        })
-        .or_else([&]() {
-            IOX_LOG(WARN) << "Unknown application '" << name << "' requested a ServerPort with service description '"
-                          << service << "'";
-        });
+    return error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::NOTYPE);
+}
+
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquireSubscriberForProcess(Process& process,
+                                            const capro::ServiceDescription& service,
+                                            const popo::SubscriberOptions& subscriberOptions,
+                                            const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto maybeSubscriber =
+        m_portManager.acquireSubscriberPortData(service, subscriberOptions, process.getName(), portConfigInfo);
+
+    if (maybeSubscriber.has_error())
+    {
+        IOX_LOG(ERROR) << "Could not create SubscriberPort for application '" << process.getName()
+                       << "' with service description '" << service << "'";
+        return error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+    }
+
+    IOX_LOG(DEBUG) << "Created new SubscriberPort for application '" << process.getName()
+                   << "' with service description '" << service << "'";
+    return success<UntypedRelativePointer::offset_t>(
+        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value()));
+}
+
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquirePublisherForProcess(Process& process,
+                                           const capro::ServiceDescription& service,
+                                           const popo::PublisherOptions& publisherOptions,
+                                           const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+    if (publisherOptions.numaNode != mepoo::MemoryInfo::NO_NUMA_NODE)
+    {
+        auto numaSegmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(
+            process.getUser(), mepoo::MemoryInfo::numaNode(publisherOptions.numaNode));
+        if (numaSegmentInfo.m_memoryManager.has_value())
+        {
+            segmentInfo = numaSegmentInfo;
+        }
+        else
+        {
+            IOX_LOG(WARN) << "The application '" << process.getName() << "' has no writable segment on the NUMA node "
+                          << publisherOptions.numaNode << ", the publisher with service description '" << service
+                          << "' uses the default segment";
+        }
+    }
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        return error<runtime::IpcMessageErrorType>(
+            runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybePublisher = m_portManager.acquirePublisherPortData(
+        service, publisherOptions, process.getName(), &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+
+    if (maybePublisher.has_error())
+    {
+        IOX_LOG(ERROR) << "Could not create PublisherPort for application '" << process.getName()
+                       << "' with service description '" << service << "'";
+        switch (maybePublisher.get_error())
+        {
+        case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+            return error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+        case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+            return error<runtime::IpcMessageErrorType>(
+                runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+        default:
+            return error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+        }
+    }
+
+    IOX_LOG(DEBUG) << "Created new PublisherPort for application '" << process.getName()
+                   << "' with service description '" << service << "'";
+    return success<UntypedRelativePointer::offset_t>(
+        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value()));
+}
+
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquireClientForProcess(Process& process,
+                                        const capro::ServiceDescription& service,
+                                        const popo::ClientOptions& clientOptions,
+                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        return error<runtime::IpcMessageErrorType>(
+            runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybeClient = m_portManager.acquireClientPortData(
+        service, clientOptions, process.getName(), &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+
+    if (maybeClient.has_error())
+    {
+        IOX_LOG(ERROR) << "Could not create ClientPort for application '" << process.getName()
+                       << "' with service description '" << service << "'";
+        return error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
+    }
+
+    IOX_LOG(DEBUG) << "Created new ClientPort for application '" << process.getName()
+                   << "' with service description '" << service << "'";
+    return success<UntypedRelativePointer::offset_t>(
+        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeClient.value()));
+}
+
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquireServerForProcess(Process& process,
+                                        const capro::ServiceDescription& service,
+                                        const popo::ServerOptions& serverOptions,
+                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        return error<runtime::IpcMessageErrorType>(
+            runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybeServer = m_portManager.acquireServerPortData(
+        service, serverOptions, process.getName(), &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+
+    if (maybeServer.has_error())
+    {
+        IOX_LOG(ERROR) << "Could not create ServerPort for application '" << process.getName()
+                       << "' with service description '" << service << "'";
+        return error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
+    }
+
+    IOX_LOG(DEBUG) << "Created new ServerPort for application '" << process.getName()
+                   << "' with service description '" << service << "'";
+    return success<UntypedRelativePointer::offset_t>(
+        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeServer.value()));
+}
+
+void ProcessManager::sendPortCreationResponse(
+    Process& process,
+    const runtime::IpcMessageType ackType,
+    const expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>& result) noexcept
+{
+    runtime::IpcMessage sendBuffer;
+    if (result.has_error())
+    {
+        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR)
+                   << runtime::IpcMessageErrorTypeToString(result.get_error());
+    }
+    else
+    {
+        // send the port to the app as a serialized relative pointer
+        sendBuffer << runtime::IpcMessageTypeToString(ackType) << cxx::convert::toString(result.value())
+                   << cxx::convert::toString(m_mgmtSegmentId);
+    }
+    process.sendViaIpcChannel(sendBuffer);
 }
 
 void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(runtimeName)
         .and_then([&](auto& process) { // Try to create a condition variable
             m_portManager.acquireConditionVariableData(runtimeName)
@@ -666,7 +788,10 @@ void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospe
 
 void ProcessManager::run() noexcept
 {
-    monitorProcesses();
+    {
+        std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
+        monitorProcesses();
+    }
     discoveryUpdate();
 }
 
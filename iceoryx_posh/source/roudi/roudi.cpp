@@ -21,12 +21,18 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/roudi/hash_multi_index.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/logging.hpp"
 
+#include <functional>
+
 namespace iox
 {
 namespace roudi
@@ -39,14 +45,11 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     , m_runHandleRuntimeMessageThread(true)
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
-    , m_prcMgr(concurrent::ForwardArgsToCTor,
-               *m_roudiMemoryInterface,
-               portManager,
-               roudiStartupParameters.m_compatibilityCheckLevel)
+    , m_prcMgr(*m_roudiMemoryInterface, portManager, roudiStartupParameters.m_compatibilityCheckLevel)
     , m_mempoolIntrospection(
           *m_roudiMemoryInterface->introspectionMemoryManager().value(),
           *m_roudiMemoryInterface->segmentManager().value(),
-          PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
+          PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionMempoolService)))
     , m_monitoringMode(roudiStartupParameters.m_monitoringMode)
     , m_processKillDelay(roudiStartupParameters.m_processKillDelay)
 {
@@ -54,9 +57,19 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     {
         IOX_LOG(WARN) << "Runnning RouDi on 32-bit architectures is not supported! Use at your own risk!";
     }
+
+    m_numberOfRuntimeMessagesWorkers = algorithm::minVal(
+        algorithm::maxVal(roudiStartupParameters.m_numberOfRuntimeMessagesWorkers, 1U),
+        MAX_NUMBER_OF_RUNTIME_MESSAGES_WORKERS);
+    if (m_numberOfRuntimeMessagesWorkers != roudiStartupParameters.m_numberOfRuntimeMessagesWorkers)
+    {
+        IOX_LOG(WARN) << "The number of runtime messages workers must be in the range of [1, "
+                      << MAX_NUMBER_OF_RUNTIME_MESSAGES_WORKERS << "]! Using " << m_numberOfRuntimeMessagesWorkers
+                      << " workers.";
+    }
     m_processIntrospection.registerPublisherPort(
-        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
-    m_prcMgr->initIntrospection(&m_processIntrospection);
+        PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionProcessService)));
+    m_prcMgr.initIntrospection(&m_processIntrospection);
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
@@ -80,10 +93,48 @@ RouDi::~RouDi() noexcept
 
 void RouDi::startProcessRuntimeMessagesThread() noexcept
 {
+    startRuntimeMessagesWorkers();
     m_handleRuntimeMessageThread = std::thread(&RouDi::processRuntimeMessages, this);
     posix::setThreadName(m_handleRuntimeMessageThread.native_handle(), "IPC-msg-process");
 }
 
+void RouDi::startRuntimeMessagesWorkers() noexcept
+{
+    // with a single worker the messages are processed by the thread which receives them
+    if (m_numberOfRuntimeMessagesWorkers <= 1U)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < m_numberOfRuntimeMessagesWorkers; ++i)
+    {
+        m_runtimeMessagesWorkers.emplace_back();
+        auto& worker = m_runtimeMessagesWorkers.back();
+        worker.thread = std::thread(&RouDi::processRuntimeMessagesOfWorker, this, std::ref(worker));
+        posix::setThreadName(worker.thread.native_handle(),
+                             into<lossy<posix::ThreadName_t>>("IPC-msg-work" + cxx::convert::toString(i)));
+    }
+}
+
+void RouDi::stopRuntimeMessagesWorkers() noexcept
+{
+    for (auto& worker : m_runtimeMessagesWorkers)
+    {
+        // the lock ensures that a worker does not miss the notification between checking the run flag and waiting
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.messageAvailable.notify_one();
+    }
+
+    for (auto& worker : m_runtimeMessagesWorkers)
+    {
+        if (worker.thread.joinable())
+        {
+            worker.thread.join();
+        }
+    }
+    m_runtimeMessagesWorkers.clear();
+}
+
 void RouDi::shutdown() noexcept
 {
     m_processIntrospection.stop();
@@ -91,6 +142,9 @@ void RouDi::shutdown() noexcept
 
     // stop the process management thread in order to prevent application to register while shutting down
     m_runMonitoringAndDiscoveryThread = false;
+    popo::ConditionNotifier(m_roudiMemoryInterface->portPool().value()->getDiscoveryConditionVariable(),
+                            popo::BasePort::DISCOVERY_NOTIFICATION_INDEX)
+        .notify();
     if (m_monitoringAndDiscoveryThread.joinable())
     {
         IOX_LOG(DEBUG) << "Joining 'Mon+Discover' thread...";
@@ -102,11 +156,11 @@ void RouDi::shutdown() noexcept
     {
         deadline_timer finalKillTimer(m_processKillDelay);
 
-        m_prcMgr->requestShutdownOfAllProcesses();
+        m_prcMgr.requestShutdownOfAllProcesses();
 
         using namespace units::duration_literals;
         auto remainingDurationForWarnPrint = m_processKillDelay - 2_s;
-        while (m_prcMgr->isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
+        while (m_prcMgr.isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
         {
             if (remainingDurationForWarnPrint > finalKillTimer.remainingTime())
             {
@@ -119,15 +173,15 @@ void RouDi::shutdown() noexcept
         }
 
         // Is any processes still alive?
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
         {
             // Time to kill them
-            m_prcMgr->killAllProcesses();
+            m_prcMgr.killAllProcesses();
         }
 
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning())
         {
-            m_prcMgr->printWarningForRegisteredProcessesAndClearProcessList();
+            m_prcMgr.printWarningForRegisteredProcessesAndClearProcessList();
         }
     }
 
@@ -140,6 +194,8 @@ void RouDi::shutdown() noexcept
         m_handleRuntimeMessageThread.join();
         IOX_LOG(DEBUG) << "...'IPC-msg-process' thread joined.";
     }
+
+    stopRuntimeMessagesWorkers();
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -149,13 +205,28 @@ void RouDi::cyclicUpdateHook() noexcept
 
 void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
+    // the ports notify this condition variable when their CaPro state changes; the discovery runs on every
+    // notification and the processes are monitored when the DISCOVERY_INTERVAL has expired
+    auto& discoveryConditionVariable = m_roudiMemoryInterface->portPool().value()->getDiscoveryConditionVariable();
+    popo::ConditionListener discoveryListener(discoveryConditionVariable);
+    deadline_timer monitoringTimer(DISCOVERY_INTERVAL);
+
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        if (monitoringTimer.hasExpired())
+        {
+            m_prcMgr.run();
 
-        cyclicUpdateHook();
+            cyclicUpdateHook();
+
+            monitoringTimer.reset();
+        }
+        else
+        {
+            m_prcMgr.discoveryUpdate();
+        }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.toMilliseconds()));
+        discoveryListener.timedWait(monitoringTimer.remainingTime());
     }
 }
 
@@ -169,14 +240,100 @@ void RouDi::processRuntimeMessages() noexcept
     while (m_runHandleRuntimeMessageThread)
     {
         // read RouDi's IPC channel
-        runtime::IpcMessage message;
-        if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message))
-        {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+        RuntimeMessage message;
+        roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message.text, message.binary)
+            .and_then([&](auto encoding) {
+                message.encoding = encoding;
+                dispatchRuntimeMessage(std::move(message));
+            });
+    }
+}
 
-            processMessage(message, cmd, runtimeName);
+void RouDi::dispatchRuntimeMessage(RuntimeMessage&& message) noexcept
+{
+    if (m_runtimeMessagesWorkers.empty())
+    {
+        processRuntimeMessage(message);
+        return;
+    }
+
+    // the runtime name selects the worker, this keeps the text and binary messages of a runtime in order
+    const RuntimeName_t runtimeName = (message.encoding == runtime::IpcMessageEncoding::BINARY)
+                                          ? message.binary.getRuntimeName()
+                                          : into<lossy<RuntimeName_t>>(message.text.getElementAtIndex(1));
+    const auto workerIndex =
+        hashIdString(capro::IdString_t(TruncateToCapacity, runtimeName.c_str(), runtimeName.size()))
+        % m_runtimeMessagesWorkers.size();
+    auto& worker = m_runtimeMessagesWorkers[workerIndex];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.messages.push_back(std::move(message));
+    }
+    worker.messageAvailable.notify_one();
+}
+
+void RouDi::processRuntimeMessagesOfWorker(RuntimeMessagesWorker& worker) noexcept
+{
+    while (m_runHandleRuntimeMessageThread)
+    {
+        RuntimeMessage message;
+        {
+            std::unique_lock<std::mutex> lock(worker.mutex);
+            worker.messageAvailable.wait(
+                lock, [&] { return !worker.messages.empty() || !m_runHandleRuntimeMessageThread; });
+            if (worker.messages.empty())
+            {
+                continue;
+            }
+            message = std::move(worker.messages.front());
+            worker.messages.pop_front();
         }
+
+        processRuntimeMessage(message);
+    }
+}
+
+void RouDi::processRuntimeMessage(RuntimeMessage& message) noexcept
+{
+    if (message.encoding == runtime::IpcMessageEncoding::BINARY)
+    {
+        processBinaryMessage(message.binary);
+        return;
+    }
+
+    auto cmd = runtime::stringToIpcMessageType(message.text.getElementAtIndex(0).c_str());
+    RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.text.getElementAtIndex(1))};
+
+    processMessage(message.text, cmd, runtimeName);
+}
+
+void RouDi::processBinaryMessage(runtime::IpcBinaryMessage& message) noexcept
+{
+    const auto runtimeName = message.getRuntimeName();
+    if (message.getProtocolVersion() != runtime::IpcBinaryMessage::PROTOCOL_VERSION)
+    {
+        IOX_LOG(ERROR) << "Application '" << runtimeName << "' uses the binary protocol version "
+                       << message.getProtocolVersion() << " but RouDi supports only version "
+                       << runtime::IpcBinaryMessage::PROTOCOL_VERSION;
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName, runtime::IpcMessageEncoding::BINARY);
+        return;
+    }
+
+    switch (message.getMessageType())
+    {
+    case runtime::IpcMessageType::CREATE_PORTS:
+    {
+        m_prcMgr.addPortsForProcess(runtimeName, message);
+        break;
+    }
+    default:
+    {
+        IOX_LOG(ERROR) << "Unknown binary IPC message command ["
+                       << runtime::IpcMessageTypeToString(message.getMessageType()) << "]";
+
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName, runtime::IpcMessageEncoding::BINARY);
+        break;
+    }
     }
 }
 
@@ -252,7 +409,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addPublisherForProcess(
+            m_prcMgr.addPublisherForProcess(
                 runtimeName, service, publisherOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -289,7 +446,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addSubscriberForProcess(
+            m_prcMgr.addSubscriberForProcess(
                 runtimeName, service, subscriberOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -326,7 +483,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
+            m_prcMgr.addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
         }
         break;
     }
@@ -362,7 +519,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
+            m_prcMgr.addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
         }
         break;
     }
@@ -375,7 +532,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            m_prcMgr->addConditionVariableForProcess(runtimeName);
+            m_prcMgr.addConditionVariableForProcess(runtimeName);
         }
         break;
     }
@@ -391,7 +548,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             capro::Interfaces interface =
                 StringToCaProInterface(into<lossy<capro::IdString_t>>(message.getElementAtIndex(2)));
 
-            m_prcMgr->addInterfaceForProcess(
+            m_prcMgr.addInterfaceForProcess(
                 runtimeName, interface, into<lossy<NodeName_t>>(message.getElementAtIndex(3)));
         }
         break;
@@ -406,13 +563,13 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             runtime::NodeProperty nodeProperty(cxx::Serialization(message.getElementAtIndex(2)));
-            m_prcMgr->addNodeForProcess(runtimeName, nodeProperty.m_name);
+            m_prcMgr.addNodeForProcess(runtimeName, nodeProperty.m_name);
         }
         break;
     }
     case runtime::IpcMessageType::KEEPALIVE:
     {
-        m_prcMgr->updateLivelinessOfProcess(runtimeName);
+        m_prcMgr.updateLivelinessOfProcess(runtimeName);
         break;
     }
     case runtime::IpcMessageType::PREPARE_APP_TERMINATION:
@@ -425,7 +582,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             // this is used to unblock a potentially block application by blocking publisher
-            m_prcMgr->handleProcessShutdownPreparationRequest(runtimeName);
+            m_prcMgr.handleProcessShutdownPreparationRequest(runtimeName);
         }
         break;
     }
@@ -438,7 +595,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            IOX_DISCARD_RESULT(m_prcMgr->unregisterProcess(runtimeName));
+            IOX_DISCARD_RESULT(m_prcMgr.unregisterProcess(runtimeName));
         }
         break;
     }
@@ -446,7 +603,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
         IOX_LOG(ERROR) << "Unknown IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]";
 
-        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName);
         break;
     }
     }
@@ -461,7 +618,7 @@ void RouDi::registerProcess(const RuntimeName_t& name,
 {
     bool monitorProcess = (m_monitoringMode == roudi::MonitoringMode::ON);
     IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+        m_prcMgr.registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
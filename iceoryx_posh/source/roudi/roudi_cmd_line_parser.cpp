@@ -37,10 +37,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"unique-roudi-id", required_argument, nullptr, 'u'},
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"ipc-workers", required_argument, nullptr, 'w'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:w:";
     int32_t index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -73,6 +74,12 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                       << std::endl;
             std::cout << "                                  have't responded after trying SIG_TERM first, in seconds."
                       << std::endl;
+            std::cout << "-w, --ipc-workers <UINT>          Sets the number of threads which process the IPC messages"
+                      << std::endl;
+            std::cout << "                                  of the applications, in the range of [1, "
+                      << roudi::MAX_NUMBER_OF_RUNTIME_MESSAGES_WORKERS << "]." << std::endl;
+            std::cout << "                                  default = "
+                      << roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGES_WORKERS << std::endl;
 
             m_run = false;
             break;
@@ -166,6 +173,23 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             }
             break;
         }
+        case 'w':
+        {
+            uint32_t numberOfRuntimeMessagesWorkers{0U};
+            if (!cxx::convert::fromString(optarg, numberOfRuntimeMessagesWorkers)
+                || numberOfRuntimeMessagesWorkers == 0U
+                || numberOfRuntimeMessagesWorkers > roudi::MAX_NUMBER_OF_RUNTIME_MESSAGES_WORKERS)
+            {
+                IOX_LOG(ERROR) << "The number of IPC workers must be in the range of [1, "
+                               << roudi::MAX_NUMBER_OF_RUNTIME_MESSAGES_WORKERS << "]";
+                m_run = false;
+            }
+            else
+            {
+                m_numberOfRuntimeMessagesWorkers = numberOfRuntimeMessagesWorkers;
+            }
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
@@ -217,6 +241,7 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                                 m_logLevel,
                                                 m_compatibilityCheckLevel,
                                                 m_processKillDelay,
+                                                m_numberOfRuntimeMessagesWorkers,
                                                 m_uniqueRouDiId,
                                                 m_run,
                                                 iox::roudi::ConfigFilePathString_t("")});
@@ -86,6 +86,7 @@ expected<CmdLineArgs_t, CmdLineParserResult> CmdLineParserConfigFileOption::pars
                                                 m_logLevel,
                                                 m_compatibilityCheckLevel,
                                                 m_processKillDelay,
+                                                m_numberOfRuntimeMessagesWorkers,
                                                 m_uniqueRouDiId,
                                                 m_run,
                                                 m_customConfigFilePath});
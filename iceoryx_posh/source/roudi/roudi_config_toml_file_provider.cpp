@@ -133,6 +133,12 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
     {
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
         auto reader = segment->get_as<std::string>("reader").value_or(into<std::string>(groupOfCurrentProcess));
+        iox::mepoo::SegmentMemoryOptions memoryOptions;
+        memoryOptions.hugePages = segment->get_as<bool>("huge_pages").value_or(false);
+        memoryOptions.prefault = segment->get_as<bool>("prefault").value_or(false);
+        memoryOptions.lockInMemory = segment->get_as<bool>("lock_in_memory").value_or(false);
+        auto numaNode = segment->get_as<uint32_t>("numa_node");
+        auto memoryInfo = numaNode ? iox::mepoo::MemoryInfo::numaNode(*numaNode) : iox::mepoo::MemoryInfo();
         iox::mepoo::MePooConfig mempoolConfig;
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
@@ -166,7 +172,9 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         parsedConfig.m_sharedMemorySegments.push_back(
             {iox::posix::PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
              iox::posix::PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
-             mempoolConfig});
+             mempoolConfig,
+             memoryInfo,
+             memoryOptions});
     }
 
     return iox::success<iox::RouDiConfig_t>(parsedConfig);
@@ -16,19 +16,56 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/attributes.hpp"
 
 namespace iox
 {
 namespace roudi
 {
+namespace
+{
+using IdStringGetter_t = const capro::IdString_t& (capro::ServiceDescription::*)() const noexcept;
+
+template <typename Container>
+auto hasServiceDescription(const Container& entries, const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return [&entries, &serviceDescription](const uint32_t index) {
+        return entries[index]->serviceDescription == serviceDescription;
+    };
+}
+
+template <typename Container>
+auto hasIdString(const Container& entries, const capro::IdString_t& id, const IdStringGetter_t getIdString) noexcept
+{
+    return [&entries, &id, getIdString](const uint32_t index) {
+        return (entries[index]->serviceDescription.*getIdString)() == id;
+    };
+}
+} // namespace
+
+constexpr uint64_t ServiceRegistry::CHANGE_HISTORY_CAPACITY;
+constexpr uint64_t ServiceRegistry::SNAPSHOT_INTERVAL;
+
 ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::ServiceDescription& serviceDescription)
     : serviceDescription(serviceDescription)
 {
 }
 
+ServiceRegistry::Change::Change(const Generation_t generation,
+                                const Operation operation,
+                                const capro::ServiceDescription& serviceDescription) noexcept
+    : generation(generation)
+    , operation(operation)
+    , serviceDescription(serviceDescription)
+{
+}
+
 expected<ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
                                                       ReferenceCounter_t ServiceDescriptionEntry::*count)
 {
+    // every call is a change, even if it fails, since the same call on a copy of the registry has the same effect
+    ++m_generation;
+
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
@@ -49,17 +86,20 @@ expected<ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescri
         auto& entry = m_serviceDescriptions[m_freeIndex];
         entry.emplace(serviceDescription);
         (*entry).*count = 1U;
+        addToIndices(m_freeIndex);
         m_freeIndex = NO_INDEX;
         return success<>();
     }
 
     // search from start
-    for (auto& entry : m_serviceDescriptions)
+    for (uint32_t i = 0U; i < m_serviceDescriptions.size(); ++i)
     {
+        auto& entry = m_serviceDescriptions[i];
         if (!entry)
         {
             entry.emplace(serviceDescription);
             (*entry).*count = 1U;
+            addToIndices(i);
             return success<>();
         }
     }
@@ -70,6 +110,7 @@ expected<ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescri
         auto& entry = m_serviceDescriptions.back();
         entry.emplace(serviceDescription);
         (*entry).*count = 1U;
+        addToIndices(static_cast<uint32_t>(m_serviceDescriptions.size() - 1U));
         return success<>();
     }
 
@@ -90,6 +131,7 @@ ServiceRegistry::addServer(const capro::ServiceDescription& serviceDescription)
 
 void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDescription) noexcept
 {
+    ++m_generation;
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
@@ -99,9 +141,7 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                removeEntry(index);
             }
         }
     }
@@ -109,6 +149,7 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
 
 void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescription) noexcept
 {
+    ++m_generation;
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
@@ -118,9 +159,7 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                removeEntry(index);
             }
         }
     }
@@ -128,48 +167,138 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
 
 void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription) noexcept
 {
+    ++m_generation;
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
+        removeEntry(index);
     }
 }
 
+void ServiceRegistry::addToIndices(const uint32_t index) noexcept
+{
+    // the indices have the same capacity as m_serviceDescriptions, therefore the insertion cannot fail
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    m_serviceDescriptionIndex.insert(hashServiceDescription(serviceDescription),
+                                     index,
+                                     hasServiceDescription(m_serviceDescriptions, serviceDescription));
+    m_serviceIndex.insert(hashIdString(serviceDescription.getServiceIDString()),
+                          index,
+                          hasIdString(m_serviceDescriptions,
+                                      serviceDescription.getServiceIDString(),
+                                      &capro::ServiceDescription::getServiceIDString));
+    m_instanceIndex.insert(hashIdString(serviceDescription.getInstanceIDString()),
+                           index,
+                           hasIdString(m_serviceDescriptions,
+                                       serviceDescription.getInstanceIDString(),
+                                       &capro::ServiceDescription::getInstanceIDString));
+    m_eventIndex.insert(hashIdString(serviceDescription.getEventIDString()),
+                        index,
+                        hasIdString(m_serviceDescriptions,
+                                    serviceDescription.getEventIDString(),
+                                    &capro::ServiceDescription::getEventIDString));
+}
+
+void ServiceRegistry::removeFromIndices(const uint32_t index) noexcept
+{
+    // the entry must still be valid since the predicates of the indices access it
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    m_serviceDescriptionIndex.erase(hashServiceDescription(serviceDescription),
+                                    index,
+                                    hasServiceDescription(m_serviceDescriptions, serviceDescription));
+    m_serviceIndex.erase(hashIdString(serviceDescription.getServiceIDString()),
+                         index,
+                         hasIdString(m_serviceDescriptions,
+                                     serviceDescription.getServiceIDString(),
+                                     &capro::ServiceDescription::getServiceIDString));
+    m_instanceIndex.erase(hashIdString(serviceDescription.getInstanceIDString()),
+                          index,
+                          hasIdString(m_serviceDescriptions,
+                                      serviceDescription.getInstanceIDString(),
+                                      &capro::ServiceDescription::getInstanceIDString));
+    m_eventIndex.erase(hashIdString(serviceDescription.getEventIDString()),
+                       index,
+                       hasIdString(m_serviceDescriptions,
+                                   serviceDescription.getEventIDString(),
+                                   &capro::ServiceDescription::getEventIDString));
+}
+
+void ServiceRegistry::removeEntry(const uint32_t index) noexcept
+{
+    removeFromIndices(index);
+    m_serviceDescriptions[index].reset();
+    // reuse the slot in the next insertion
+    m_freeIndex = index;
+}
+
 void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& instance,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    if (service && instance && event)
     {
-        if (entry)
+        auto index = findIndex(capro::ServiceDescription(*service, *instance, *event));
+        if (index != NO_INDEX)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            callable(*m_serviceDescriptions[index]);
+        }
+        return;
+    }
 
-            if (match)
-            {
-                callable(*entry);
-            }
+    // the entries of the provided string with the fewest entries are filtered by the other provided strings
+    const Index_t* smallestIndex{nullptr};
+    const capro::IdString_t* smallestIndexId{nullptr};
+    IdStringGetter_t smallestIndexGetIdString{nullptr};
+    uint64_t smallestIndexCount{0U};
+    auto selectIndex = [&](const optional<capro::IdString_t>& id, const Index_t& index, IdStringGetter_t getIdString) {
+        if (!id)
+        {
+            return;
+        }
+        const auto count = index.count(hashIdString(*id), hasIdString(m_serviceDescriptions, *id, getIdString));
+        if (smallestIndex == nullptr || count < smallestIndexCount)
+        {
+            smallestIndex = &index;
+            smallestIndexId = &id.value();
+            smallestIndexGetIdString = getIdString;
+            smallestIndexCount = count;
+        }
+    };
+    selectIndex(service, m_serviceIndex, &capro::ServiceDescription::getServiceIDString);
+    selectIndex(instance, m_instanceIndex, &capro::ServiceDescription::getInstanceIDString);
+    selectIndex(event, m_eventIndex, &capro::ServiceDescription::getEventIDString);
+
+    auto filter = [&](const ServiceDescriptionEntry& entry) {
+        bool match = (service) ? (entry.serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry.serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry.serviceDescription.getEventIDString() == *event) : true;
+
+        if (match)
+        {
+            callable(entry);
         }
+    };
+
+    if (smallestIndex == nullptr)
+    {
+        forEach(filter);
+        return;
     }
+
+    smallestIndex->forEach(hashIdString(*smallestIndexId),
+                           hasIdString(m_serviceDescriptions, *smallestIndexId, smallestIndexGetIdString),
+                           [&](const uint32_t index) { filter(*m_serviceDescriptions[index]); });
 }
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
-    {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
-        {
-            return i;
-        }
-    }
-    return NO_INDEX;
+    // there is at most one entry per service description
+    uint32_t foundIndex{NO_INDEX};
+    m_serviceDescriptionIndex.forEach(hashServiceDescription(serviceDescription),
+                                      hasServiceDescription(m_serviceDescriptions, serviceDescription),
+                                      [&](const uint32_t index) { foundIndex = index; });
+    return foundIndex;
 }
 
 void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
@@ -183,5 +312,39 @@ void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)>
     }
 }
 
+ServiceRegistry::Generation_t ServiceRegistry::generation() const noexcept
+{
+    return m_generation;
+}
+
+bool ServiceRegistry::apply(const Change& change) noexcept
+{
+    if (change.generation != m_generation + 1U)
+    {
+        return false;
+    }
+
+    switch (change.operation)
+    {
+    case Change::Operation::ADD_PUBLISHER:
+        // a full registry was already reported by RouDi when the change was created
+        IOX_DISCARD_RESULT(addPublisher(change.serviceDescription));
+        break;
+    case Change::Operation::REMOVE_PUBLISHER:
+        removePublisher(change.serviceDescription);
+        break;
+    case Change::Operation::ADD_SERVER:
+        IOX_DISCARD_RESULT(addServer(change.serviceDescription));
+        break;
+    case Change::Operation::REMOVE_SERVER:
+        removeServer(change.serviceDescription);
+        break;
+    case Change::Operation::PURGE:
+        purge(change.serviceDescription);
+        break;
+    }
+    return true;
+}
+
 } // namespace roudi
 } // namespace iox
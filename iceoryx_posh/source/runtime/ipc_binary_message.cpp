@@ -0,0 +1,333 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace runtime
+{
+constexpr uint32_t IpcBinaryMessage::MAGIC;
+constexpr uint16_t IpcBinaryMessage::PROTOCOL_VERSION;
+constexpr uint64_t IpcBinaryMessage::CAPACITY;
+constexpr uint64_t IpcBinaryMessage::HEADER_SIZE;
+constexpr uint64_t IpcBinaryMessage::RUNTIME_NAME_POSITION;
+
+static_assert(IpcBinaryMessage::CAPACITY <= platform::IoxIpcChannelType::MAX_MESSAGE_SIZE,
+              "A binary message must fit into a message of the IPC channel");
+
+IpcBinaryMessage::IpcBinaryMessage(const IpcMessageType messageType, const RuntimeName_t& runtimeName) noexcept
+    : m_isValid(true)
+{
+    Header header;
+    header.messageType = static_cast<std::underlying_type<IpcMessageType>::type>(messageType);
+    write(&header, sizeof(header));
+    *this << runtimeName;
+}
+
+void IpcBinaryMessage::write(const void* const source, const uint64_t size) noexcept
+{
+    if (!m_isValid || size > CAPACITY - m_size)
+    {
+        m_isValid = false;
+        return;
+    }
+
+    std::memcpy(m_data.data() + m_size, source, size);
+    m_size += size;
+}
+
+void IpcBinaryMessage::read(void* const destination, const uint64_t size) noexcept
+{
+    if (!m_isValid || size > m_size - m_readPosition)
+    {
+        m_isValid = false;
+        return;
+    }
+
+    std::memcpy(destination, m_data.data() + m_readPosition, size);
+    m_readPosition += size;
+}
+
+IpcBinaryMessage::Header IpcBinaryMessage::header() const noexcept
+{
+    Header header;
+    if (m_size >= HEADER_SIZE)
+    {
+        std::memcpy(&header, &m_data[0], HEADER_SIZE);
+    }
+    return header;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator<<(const capro::ServiceDescription& value) noexcept
+{
+    const auto classHash = value.getClassHash();
+    *this << value.getServiceIDString() << value.getInstanceIDString() << value.getEventIDString() << classHash[0U]
+          << classHash[1U] << classHash[2U] << classHash[3U] << value.getScope() << value.getSourceInterface();
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator>>(capro::ServiceDescription& value) noexcept
+{
+    capro::IdString_t service;
+    capro::IdString_t instance;
+    capro::IdString_t event;
+    capro::ServiceDescription::ClassHash classHash;
+    capro::Scope scope{capro::Scope::INVALID};
+    capro::Interfaces interfaceSource{capro::Interfaces::INTERFACE_END};
+
+    *this >> service >> instance >> event >> classHash[0U] >> classHash[1U] >> classHash[2U] >> classHash[3U] >> scope
+        >> interfaceSource;
+
+    if (!m_isValid || scope >= capro::Scope::INVALID || interfaceSource >= capro::Interfaces::INTERFACE_END)
+    {
+        m_isValid = false;
+        return *this;
+    }
+
+    value = capro::ServiceDescription(service, instance, event, classHash, interfaceSource);
+    if (scope == capro::Scope::LOCAL)
+    {
+        value.setLocal();
+    }
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator<<(const popo::PublisherOptions& value) noexcept
+{
+    // durations which do not fit into the nanoseconds representation are transferred as infinite timeout
+    const uint64_t subscriberTooSlowTimeoutNanoseconds = value.subscriberTooSlowTimeout.toNanoseconds();
+    const bool hasSubscriberTooSlowTimeout =
+        subscriberTooSlowTimeoutNanoseconds < std::numeric_limits<uint64_t>::max();
+
+    *this << value.historyCapacity << value.nodeName << value.offerOnCreate << value.subscriberTooSlowPolicy
+          << hasSubscriberTooSlowTimeout << subscriberTooSlowTimeoutNanoseconds << value.chunkMagazineCapacity
+          << value.stampSendTime << value.numaNode;
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator>>(popo::PublisherOptions& value) noexcept
+{
+    bool hasSubscriberTooSlowTimeout{false};
+    uint64_t subscriberTooSlowTimeoutNanoseconds{0U};
+
+    *this >> value.historyCapacity >> value.nodeName >> value.offerOnCreate >> value.subscriberTooSlowPolicy
+        >> hasSubscriberTooSlowTimeout >> subscriberTooSlowTimeoutNanoseconds >> value.chunkMagazineCapacity
+        >> value.stampSendTime >> value.numaNode;
+
+    if (value.subscriberTooSlowPolicy > popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    {
+        m_isValid = false;
+    }
+
+    value.subscriberTooSlowTimeout = hasSubscriberTooSlowTimeout
+                                         ? units::Duration::fromNanoseconds(subscriberTooSlowTimeoutNanoseconds)
+                                         : units::Duration::max();
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator<<(const popo::SubscriberOptions& value) noexcept
+{
+    *this << value.queueCapacity << value.historyRequest << value.nodeName << value.subscribeOnCreate
+          << value.queueFullPolicy << value.requiresPublisherHistorySupport;
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator>>(popo::SubscriberOptions& value) noexcept
+{
+    *this >> value.queueCapacity >> value.historyRequest >> value.nodeName >> value.subscribeOnCreate
+        >> value.queueFullPolicy >> value.requiresPublisherHistorySupport;
+
+    if (value.queueFullPolicy > popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
+    {
+        m_isValid = false;
+    }
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator<<(const popo::ClientOptions& value) noexcept
+{
+    *this << value.responseQueueCapacity << value.nodeName << value.connectOnCreate << value.responseQueueFullPolicy
+          << value.serverTooSlowPolicy;
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator>>(popo::ClientOptions& value) noexcept
+{
+    *this >> value.responseQueueCapacity >> value.nodeName >> value.connectOnCreate >> value.responseQueueFullPolicy
+        >> value.serverTooSlowPolicy;
+
+    if (value.responseQueueFullPolicy > popo::QueueFullPolicy::DISCARD_OLDEST_DATA
+        || value.serverTooSlowPolicy > popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    {
+        m_isValid = false;
+    }
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator<<(const popo::ServerOptions& value) noexcept
+{
+    *this << value.requestQueueCapacity << value.nodeName << value.offerOnCreate << value.requestQueueFullPolicy
+          << value.clientTooSlowPolicy;
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator>>(popo::ServerOptions& value) noexcept
+{
+    *this >> value.requestQueueCapacity >> value.nodeName >> value.offerOnCreate >> value.requestQueueFullPolicy
+        >> value.clientTooSlowPolicy;
+
+    if (value.requestQueueFullPolicy > popo::QueueFullPolicy::DISCARD_OLDEST_DATA
+        || value.clientTooSlowPolicy > popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    {
+        m_isValid = false;
+    }
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator<<(const PortConfigInfo& value) noexcept
+{
+    *this << value.portType << value.memoryInfo.deviceId << value.memoryInfo.memoryType;
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator>>(PortConfigInfo& value) noexcept
+{
+    *this >> value.portType >> value.memoryInfo.deviceId >> value.memoryInfo.memoryType;
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::addEntry(const IpcMessageType entryType) noexcept
+{
+    auto currentHeader = header();
+    if (!m_isValid || currentHeader.numberOfEntries == std::numeric_limits<uint16_t>::max())
+    {
+        m_isValid = false;
+        return *this;
+    }
+
+    *this << entryType;
+    if (m_isValid)
+    {
+        ++currentHeader.numberOfEntries;
+        std::memcpy(&m_data[0], &currentHeader, HEADER_SIZE);
+    }
+    return *this;
+}
+
+uint16_t IpcBinaryMessage::getNumberOfEntries() const noexcept
+{
+    return header().numberOfEntries;
+}
+
+IpcMessageType IpcBinaryMessage::getMessageType() const noexcept
+{
+    const auto messageType = header().messageType;
+    if (messageType <= static_cast<std::underlying_type<IpcMessageType>::type>(IpcMessageType::BEGIN)
+        || messageType >= static_cast<std::underlying_type<IpcMessageType>::type>(IpcMessageType::END))
+    {
+        return IpcMessageType::NOTYPE;
+    }
+    return static_cast<IpcMessageType>(messageType);
+}
+
+uint16_t IpcBinaryMessage::getProtocolVersion() const noexcept
+{
+    return header().version;
+}
+
+RuntimeName_t IpcBinaryMessage::getRuntimeName() const noexcept
+{
+    uint16_t length{0U};
+    if (m_size < RUNTIME_NAME_POSITION + sizeof(length))
+    {
+        return RuntimeName_t();
+    }
+
+    std::memcpy(&length, &m_data[RUNTIME_NAME_POSITION], sizeof(length));
+    const uint64_t namePosition = RUNTIME_NAME_POSITION + sizeof(length);
+    if (length > RuntimeName_t::capacity() || namePosition + length > m_size)
+    {
+        return RuntimeName_t();
+    }
+
+    return RuntimeName_t(TruncateToCapacity, &m_data[namePosition], length);
+}
+
+uint64_t IpcBinaryMessage::getFreeCapacity() const noexcept
+{
+    return CAPACITY - m_size;
+}
+
+bool IpcBinaryMessage::isValid() const noexcept
+{
+    return m_isValid;
+}
+
+const char* IpcBinaryMessage::data() const noexcept
+{
+    return m_data.data();
+}
+
+uint64_t IpcBinaryMessage::size() const noexcept
+{
+    return m_size;
+}
+
+bool IpcBinaryMessage::setMessage(const char* const data, const uint64_t size) noexcept
+{
+    m_size = 0U;
+    m_readPosition = 0U;
+    m_isValid = false;
+
+    if (!isBinaryMessage(data, size) || size > CAPACITY)
+    {
+        return false;
+    }
+
+    std::memcpy(m_data.data(), data, size);
+    m_size = size;
+
+    // the runtime name is read to validate it and to move the read position to the beginning of the payload
+    m_isValid = true;
+    m_readPosition = RUNTIME_NAME_POSITION;
+    RuntimeName_t runtimeName;
+    *this >> runtimeName;
+    if (!m_isValid)
+    {
+        return false;
+    }
+
+    m_isValid = (getProtocolVersion() == PROTOCOL_VERSION);
+    return true;
+}
+
+bool IpcBinaryMessage::isBinaryMessage(const char* const data, const uint64_t size) noexcept
+{
+    if (size < HEADER_SIZE)
+    {
+        return false;
+    }
+
+    uint32_t magic{0U};
+    std::memcpy(&magic, data, sizeof(magic));
+    return magic == MAGIC;
+}
+
+} // namespace runtime
+} // namespace iox
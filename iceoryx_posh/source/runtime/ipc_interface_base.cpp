@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
 #include "iceoryx_dust/cxx/convert.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iox/logging.hpp"
 
@@ -150,6 +151,123 @@ bool IpcInterface<IpcChannelType>::timedSend(const IpcMessage& msg, units::Durat
     return !m_ipcChannel.timedSend(msg.getMessage(), timeout).or_else(logLengthError).has_error();
 }
 
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::receive(IpcBinaryMessage& answer) const noexcept
+{
+    /// NOLINTJUSTIFICATION required as raw memory buffer for the ipc channel
+    /// NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    char buffer[IpcChannelType::MAX_MESSAGE_SIZE];
+
+    auto receivedSize = m_ipcChannel.receive(&buffer[0], IpcChannelType::MAX_MESSAGE_SIZE);
+    if (receivedSize.has_error())
+    {
+        return false;
+    }
+
+    return setBinaryMessageFromBuffer(&buffer[0], receivedSize.value(), answer);
+}
+
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout, IpcBinaryMessage& answer) const noexcept
+{
+    /// NOLINTJUSTIFICATION required as raw memory buffer for the ipc channel
+    /// NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    char buffer[IpcChannelType::MAX_MESSAGE_SIZE];
+
+    auto receivedSize = m_ipcChannel.timedReceive(&buffer[0], IpcChannelType::MAX_MESSAGE_SIZE, timeout);
+    if (receivedSize.has_error())
+    {
+        return false;
+    }
+
+    return setBinaryMessageFromBuffer(&buffer[0], receivedSize.value(), answer);
+}
+
+template <typename IpcChannelType>
+optional<IpcMessageEncoding> IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout,
+                                                                        IpcMessage& textMessage,
+                                                                        IpcBinaryMessage& binaryMessage) const noexcept
+{
+    /// NOLINTJUSTIFICATION required as raw memory buffer for the ipc channel, one additional byte for the null
+    /// terminator of text messages
+    /// NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    char buffer[IpcChannelType::MAX_MESSAGE_SIZE + 1U];
+
+    auto receivedSize = m_ipcChannel.timedReceive(&buffer[0], IpcChannelType::MAX_MESSAGE_SIZE, timeout);
+    if (receivedSize.has_error())
+    {
+        return nullopt;
+    }
+
+    if (IpcBinaryMessage::isBinaryMessage(&buffer[0], receivedSize.value()))
+    {
+        // a message with an unsupported protocol version is forwarded to be able to answer the sender
+        if (!binaryMessage.setMessage(&buffer[0], receivedSize.value()))
+        {
+            IOX_LOG(ERROR) << "The received binary message is not valid";
+            return nullopt;
+        }
+        return IpcMessageEncoding::BINARY;
+    }
+
+    buffer[receivedSize.value()] = '\0';
+    if (!setMessageFromString(&buffer[0], textMessage))
+    {
+        return nullopt;
+    }
+    return IpcMessageEncoding::TEXT;
+}
+
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::setBinaryMessageFromBuffer(const char* buffer,
+                                                              const uint64_t size,
+                                                              IpcBinaryMessage& answer) noexcept
+{
+    answer.setMessage(buffer, size);
+    if (!answer.isValid())
+    {
+        IOX_LOG(ERROR) << "The received binary message of " << size << " bytes is not valid";
+        return false;
+    }
+    return true;
+}
+
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::send(const IpcBinaryMessage& msg) const noexcept
+{
+    if (!msg.isValid())
+    {
+        IOX_LOG(ERROR) << "Trying to send an invalid binary message";
+        return false;
+    }
+
+    auto logLengthError = [&msg](posix::IpcChannelError& error) {
+        if (error == posix::IpcChannelError::MESSAGE_TOO_LONG)
+        {
+            IOX_LOG(ERROR) << "msg size of " << msg.size() << " bigger than configured max message size";
+        }
+    };
+    return !m_ipcChannel.send(msg.data(), msg.size()).or_else(logLengthError).has_error();
+}
+
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::timedSend(const IpcBinaryMessage& msg, const units::Duration timeout) const noexcept
+{
+    if (!msg.isValid())
+    {
+        IOX_LOG(ERROR) << "Trying to send an invalid binary message";
+        return false;
+    }
+
+    auto logLengthError = [&msg](posix::IpcChannelError& error) {
+        if (error == posix::IpcChannelError::MESSAGE_TOO_LONG)
+        {
+            IOX_LOG(ERROR) << "msg size of " << msg.size() << " bigger than configured max message size";
+        }
+    };
+    return !m_ipcChannel.timedSend(msg.data(), msg.size(), timeout).or_else(logLengthError).has_error();
+}
+
 template <typename IpcChannelType>
 const RuntimeName_t& IpcInterface<IpcChannelType>::getRuntimeName() const noexcept
 {
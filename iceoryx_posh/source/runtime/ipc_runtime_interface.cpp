@@ -176,6 +176,23 @@ bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage&
     return true;
 }
 
+bool IpcRuntimeInterface::sendRequestToRouDi(const IpcBinaryMessage& msg, IpcBinaryMessage& answer) noexcept
+{
+    if (!m_RoudiIpcInterface.send(msg))
+    {
+        IOX_LOG(ERROR) << "Could not send binary request via RouDi IPC channel interface.\n";
+        return false;
+    }
+
+    if (!m_AppIpcInterface->receive(answer))
+    {
+        IOX_LOG(ERROR) << "Could not receive binary request via App IPC channel interface.\n";
+        return false;
+    }
+
+    return true;
+}
+
 size_t IpcRuntimeInterface::getShmTopicSize() noexcept
 {
     return m_shmTopicSize;
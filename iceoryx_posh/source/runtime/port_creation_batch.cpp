@@ -0,0 +1,143 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_creation_batch.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+constexpr uint64_t PortCreationBatch::CAPACITY;
+
+PortCreationBatch::Request::Request(const IpcMessageType type,
+                                    const capro::ServiceDescription& service,
+                                    const Options_t& options,
+                                    const PortConfigInfo& portConfigInfo) noexcept
+    : type(type)
+    , service(service)
+    , options(options)
+    , portConfigInfo(portConfigInfo)
+{
+}
+
+optional<PortCreationBatch::Index_t> PortCreationBatch::addPublisher(const capro::ServiceDescription& service,
+                                                                     const popo::PublisherOptions& publisherOptions,
+                                                                     const PortConfigInfo& portConfigInfo) noexcept
+{
+    return addRequest(IpcMessageType::CREATE_PUBLISHER,
+                      service,
+                      Options_t(in_place_type<popo::PublisherOptions>(), publisherOptions),
+                      portConfigInfo);
+}
+
+optional<PortCreationBatch::Index_t> PortCreationBatch::addSubscriber(const capro::ServiceDescription& service,
+                                                                      const popo::SubscriberOptions& subscriberOptions,
+                                                                      const PortConfigInfo& portConfigInfo) noexcept
+{
+    return addRequest(IpcMessageType::CREATE_SUBSCRIBER,
+                      service,
+                      Options_t(in_place_type<popo::SubscriberOptions>(), subscriberOptions),
+                      portConfigInfo);
+}
+
+optional<PortCreationBatch::Index_t> PortCreationBatch::addClient(const capro::ServiceDescription& service,
+                                                                  const popo::ClientOptions& clientOptions,
+                                                                  const PortConfigInfo& portConfigInfo) noexcept
+{
+    return addRequest(IpcMessageType::CREATE_CLIENT,
+                      service,
+                      Options_t(in_place_type<popo::ClientOptions>(), clientOptions),
+                      portConfigInfo);
+}
+
+optional<PortCreationBatch::Index_t> PortCreationBatch::addServer(const capro::ServiceDescription& service,
+                                                                  const popo::ServerOptions& serverOptions,
+                                                                  const PortConfigInfo& portConfigInfo) noexcept
+{
+    return addRequest(IpcMessageType::CREATE_SERVER,
+                      service,
+                      Options_t(in_place_type<popo::ServerOptions>(), serverOptions),
+                      portConfigInfo);
+}
+
+optional<PortCreationBatch::Index_t> PortCreationBatch::addRequest(const IpcMessageType type,
+                                                                   const capro::ServiceDescription& service,
+                                                                   const Options_t& options,
+                                                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    if (!m_requests.emplace_back(type, service, options, portConfigInfo))
+    {
+        IOX_LOG(WARN) << "Unable to add the request for '" << service << "' since the port creation batch is full";
+        return nullopt;
+    }
+    return m_requests.size() - 1U;
+}
+
+template <typename PortData>
+expected<PortData*, IpcMessageErrorType> PortCreationBatch::getPort(const Index_t index,
+                                                                    const IpcMessageType type) const noexcept
+{
+    cxx::Expects(index < m_requests.size() && m_requests[index].type == type);
+
+    const auto& request = m_requests[index];
+    if (request.port == nullptr)
+    {
+        return error<IpcMessageErrorType>(request.error);
+    }
+    return success<PortData*>(static_cast<PortData*>(request.port));
+}
+
+expected<popo::PublisherPortData*, IpcMessageErrorType>
+PortCreationBatch::getPublisher(const Index_t index) const noexcept
+{
+    return getPort<popo::PublisherPortData>(index, IpcMessageType::CREATE_PUBLISHER);
+}
+
+expected<popo::SubscriberPortData*, IpcMessageErrorType>
+PortCreationBatch::getSubscriber(const Index_t index) const noexcept
+{
+    return getPort<popo::SubscriberPortData>(index, IpcMessageType::CREATE_SUBSCRIBER);
+}
+
+expected<popo::ClientPortData*, IpcMessageErrorType> PortCreationBatch::getClient(const Index_t index) const noexcept
+{
+    return getPort<popo::ClientPortData>(index, IpcMessageType::CREATE_CLIENT);
+}
+
+expected<popo::ServerPortData*, IpcMessageErrorType> PortCreationBatch::getServer(const Index_t index) const noexcept
+{
+    return getPort<popo::ServerPortData>(index, IpcMessageType::CREATE_SERVER);
+}
+
+uint64_t PortCreationBatch::size() const noexcept
+{
+    return m_requests.size();
+}
+
+bool PortCreationBatch::empty() const noexcept
+{
+    return m_requests.empty();
+}
+
+void PortCreationBatch::clear() noexcept
+{
+    m_requests.clear();
+}
+
+} // namespace runtime
+} // namespace iox
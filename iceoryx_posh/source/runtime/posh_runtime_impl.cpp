@@ -21,6 +21,7 @@
 #include "iox/variant.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/logging.hpp"
@@ -75,10 +76,70 @@ PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
     }
 }
 
-PublisherPortUserType::MemberType_t*
-PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
-                                        const popo::PublisherOptions& publisherOptions,
-                                        const PortConfigInfo& portConfigInfo) noexcept
+template <typename PortData>
+expected<PortData*, IpcMessageErrorType>
+PoshRuntimeImpl::requestPortFromRoudi(const IpcBinaryMessage& sendBuffer,
+                                      const IpcMessageType ackType,
+                                      const IpcMessageErrorType invalidResponseError,
+                                      const IpcMessageErrorType wrongResponseError) noexcept
+{
+    IpcBinaryMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
+    {
+        IOX_LOG(ERROR) << "Request port got invalid response!";
+        return error<IpcMessageErrorType>(invalidResponseError);
+    }
+
+    if (receiveBuffer.getMessageType() != IpcMessageType::CREATE_PORTS_ACK || receiveBuffer.getNumberOfEntries() != 1U)
+    {
+        IOX_LOG(ERROR) << "Request port got wrong response from IPC channel with message type "
+                       << IpcMessageTypeToString(receiveBuffer.getMessageType()) << " and "
+                       << receiveBuffer.getNumberOfEntries() << " entries";
+        return error<IpcMessageErrorType>(wrongResponseError);
+    }
+
+    auto maybePort = readPortFromResponse(receiveBuffer, ackType, wrongResponseError);
+    if (maybePort.has_error())
+    {
+        return error<IpcMessageErrorType>(maybePort.get_error());
+    }
+    return success<PortData*>(reinterpret_cast<PortData*>(maybePort.value()));
+}
+
+expected<void*, IpcMessageErrorType> PoshRuntimeImpl::readPortFromResponse(
+    IpcBinaryMessage& response, const IpcMessageType ackType, const IpcMessageErrorType wrongResponseError) noexcept
+{
+    IpcMessageType entryType{IpcMessageType::NOTYPE};
+    response >> entryType;
+
+    if (entryType == ackType)
+    {
+        UntypedRelativePointer::offset_t offset{0U};
+        segment_id_underlying_t segmentId{0U};
+        response >> offset >> segmentId;
+        if (response.isValid())
+        {
+            return success<void*>(UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset));
+        }
+    }
+    else if (entryType == IpcMessageType::ERROR)
+    {
+        IpcMessageErrorType errorType{IpcMessageErrorType::NOTYPE};
+        response >> errorType;
+        if (response.isValid())
+        {
+            IOX_LOG(ERROR) << "Request port received no valid port from RouDi.";
+            return error<IpcMessageErrorType>(errorType);
+        }
+    }
+
+    IOX_LOG(ERROR) << "Request port got wrong response entry from IPC channel with type "
+                   << IpcMessageTypeToString(entryType);
+    return error<IpcMessageErrorType>(wrongResponseError);
+}
+
+popo::PublisherOptions
+PoshRuntimeImpl::adjustPublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept
 {
     constexpr uint64_t MAX_HISTORY_CAPACITY =
         PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
@@ -97,12 +158,102 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         options.nodeName = m_appName;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << publisherOptions.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    return options;
+}
+
+popo::SubscriberOptions
+PoshRuntimeImpl::adjustSubscriberOptions(const capro::ServiceDescription& service,
+                                         const popo::SubscriberOptions& subscriberOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
+
+    auto options = subscriberOptions;
+    if (options.queueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(WARN) << "Requested queue capacity " << options.queueCapacity
+                      << " exceeds the maximum possible one for this subscriber"
+                      << ", limiting from " << subscriberOptions.queueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.queueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (0U == options.queueCapacity)
+    {
+        IOX_LOG(WARN) << "Requested queue capacity of 0 doesn't make sense as no data would be received,"
+                      << " the capacity is set to 1";
+        options.queueCapacity = 1U;
+    }
 
-    auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
+    if (subscriberOptions.historyRequest > subscriberOptions.queueCapacity)
+    {
+        IOX_LOG(WARN) << "Requested historyRequest for " << service
+                      << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!";
+        options.historyRequest = subscriberOptions.queueCapacity;
+    }
+
+    if (options.nodeName.empty())
+    {
+        options.nodeName = m_appName;
+    }
+
+    return options;
+}
+
+popo::ClientOptions PoshRuntimeImpl::adjustClientOptions(const popo::ClientOptions& clientOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
+    auto options = clientOptions;
+    if (options.responseQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(WARN) << "Requested response queue capacity " << options.responseQueueCapacity
+                      << " exceeds the maximum possible one for this client"
+                      << ", limiting from " << options.responseQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.responseQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (options.responseQueueCapacity == 0U)
+    {
+        IOX_LOG(WARN) << "Requested response queue capacity of 0 doesn't make sense as no data would be received,"
+                      << " the capacity is set to 1";
+        options.responseQueueCapacity = 1U;
+    }
+
+    return options;
+}
+
+popo::ServerOptions PoshRuntimeImpl::adjustServerOptions(const popo::ServerOptions& serverOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
+    auto options = serverOptions;
+    if (options.requestQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(WARN) << "Requested request queue capacity " << options.requestQueueCapacity
+                      << " exceeds the maximum possible one for this server"
+                      << ", limiting from " << options.requestQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.requestQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (options.requestQueueCapacity == 0U)
+    {
+        IOX_LOG(WARN) << "Requested request queue capacity of 0 doesn't make sense as no data would be received,"
+                      << " the capacity is set to 1";
+        options.requestQueueCapacity = 1U;
+    }
+
+    return options;
+}
+
+PublisherPortUserType::MemberType_t*
+PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
+                                        const popo::PublisherOptions& publisherOptions,
+                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto options = adjustPublisherOptions(publisherOptions);
+
+    IpcBinaryMessage sendBuffer(IpcMessageType::CREATE_PORTS, m_appName);
+    sendBuffer.addEntry(IpcMessageType::CREATE_PUBLISHER) << service << options << portConfigInfo;
+
+    auto maybePublisher = requestPortFromRoudi<PublisherPortUserType::MemberType_t>(
+        sendBuffer,
+        IpcMessageType::CREATE_PUBLISHER_ACK,
+        IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE,
+        IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
     if (maybePublisher.has_error())
     {
         switch (maybePublisher.get_error())
@@ -148,86 +299,21 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
     return maybePublisher.value();
 }
 
-expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept
-{
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
-    {
-        IOX_LOG(ERROR) << "Request publisher got invalid response!";
-        return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE);
-    }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
-    {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
-
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_PUBLISHER_ACK)
-
-        {
-            segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
-            return success<PublisherPortUserType::MemberType_t*>(
-                reinterpret_cast<PublisherPortUserType::MemberType_t*>(ptr));
-        }
-    }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
-    {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
-        {
-            IOX_LOG(ERROR) << "Request publisher received no valid publisher port from RouDi.";
-            return error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
-        }
-    }
-
-    IOX_LOG(ERROR) << "Request publisher got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
-}
-
 SubscriberPortUserType::MemberType_t*
 PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
                                          const popo::SubscriberOptions& subscriberOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
+    const auto options = adjustSubscriberOptions(service, subscriberOptions);
 
-    auto options = subscriberOptions;
-    if (options.queueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(WARN) << "Requested queue capacity " << options.queueCapacity
-                      << " exceeds the maximum possible one for this subscriber"
-                      << ", limiting from " << subscriberOptions.queueCapacity << " to " << MAX_QUEUE_CAPACITY;
-        options.queueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (0U == options.queueCapacity)
-    {
-        IOX_LOG(WARN) << "Requested queue capacity of 0 doesn't make sense as no data would be received,"
-                      << " the capacity is set to 1";
-        options.queueCapacity = 1U;
-    }
+    IpcBinaryMessage sendBuffer(IpcMessageType::CREATE_PORTS, m_appName);
+    sendBuffer.addEntry(IpcMessageType::CREATE_SUBSCRIBER) << service << options << portConfigInfo;
 
-    if (subscriberOptions.historyRequest > subscriberOptions.queueCapacity)
-    {
-        IOX_LOG(WARN) << "Requested historyRequest for " << service
-                      << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!";
-        options.historyRequest = subscriberOptions.queueCapacity;
-    }
-
-    if (options.nodeName.empty())
-    {
-        options.nodeName = m_appName;
-    }
-
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
-
-    auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
+    auto maybeSubscriber = requestPortFromRoudi<SubscriberPortUserType::MemberType_t>(
+        sendBuffer,
+        IpcMessageType::CREATE_SUBSCRIBER_ACK,
+        IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE,
+        IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
 
     if (maybeSubscriber.has_error())
     {
@@ -259,72 +345,20 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
     return maybeSubscriber.value();
 }
 
-expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept
-{
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
-    {
-        IOX_LOG(ERROR) << "Request subscriber got invalid response!";
-        return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE);
-    }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
-    {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
-
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_SUBSCRIBER_ACK)
-        {
-            segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
-            return success<SubscriberPortUserType::MemberType_t*>(
-                reinterpret_cast<SubscriberPortUserType::MemberType_t*>(ptr));
-        }
-    }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
-    {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
-
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
-        {
-            IOX_LOG(ERROR) << "Request subscriber received no valid subscriber port from RouDi.";
-            return error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
-        }
-    }
-
-    IOX_LOG(ERROR) << "Request subscriber got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
-}
-
 popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const capro::ServiceDescription& service,
                                                                          const popo::ClientOptions& clientOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
-    auto options = clientOptions;
-    if (options.responseQueueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(WARN) << "Requested response queue capacity " << options.responseQueueCapacity
-                      << " exceeds the maximum possible one for this client"
-                      << ", limiting from " << options.responseQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
-        options.responseQueueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (options.responseQueueCapacity == 0U)
-    {
-        IOX_LOG(WARN) << "Requested response queue capacity of 0 doesn't make sense as no data would be received,"
-                      << " the capacity is set to 1";
-        options.responseQueueCapacity = 1U;
-    }
+    const auto options = adjustClientOptions(clientOptions);
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    IpcBinaryMessage sendBuffer(IpcMessageType::CREATE_PORTS, m_appName);
+    sendBuffer.addEntry(IpcMessageType::CREATE_CLIENT) << service << options << portConfigInfo;
 
-    auto maybeClient = requestClientFromRoudi(sendBuffer);
+    auto maybeClient = requestPortFromRoudi<popo::ClientPortUser::MemberType_t>(
+        sendBuffer,
+        IpcMessageType::CREATE_CLIENT_ACK,
+        IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE,
+        IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE);
     if (maybeClient.has_error())
     {
         switch (maybeClient.get_error())
@@ -363,72 +397,20 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
     return maybeClient.value();
 }
 
-expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept
-{
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
-    {
-        IOX_LOG(ERROR) << "Request client got invalid response!";
-        return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE);
-    }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
-    {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
-
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_CLIENT_ACK)
-        {
-            segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
-            return success<popo::ClientPortUser::MemberType_t*>(
-                reinterpret_cast<popo::ClientPortUser::MemberType_t*>(ptr));
-        }
-    }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
-    {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
-        {
-            IOX_LOG(ERROR) << "Request client received no valid client port from RouDi.";
-            return error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
-        }
-    }
-
-
-    IOX_LOG(ERROR) << "Request client got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE);
-}
-
 popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const capro::ServiceDescription& service,
                                                                          const popo::ServerOptions& serverOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
-    auto options = serverOptions;
-    if (options.requestQueueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(WARN) << "Requested request queue capacity " << options.requestQueueCapacity
-                      << " exceeds the maximum possible one for this server"
-                      << ", limiting from " << options.requestQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
-        options.requestQueueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (options.requestQueueCapacity == 0U)
-    {
-        IOX_LOG(WARN) << "Requested request queue capacity of 0 doesn't make sense as no data would be received,"
-                      << " the capacity is set to 1";
-        options.requestQueueCapacity = 1U;
-    }
+    const auto options = adjustServerOptions(serverOptions);
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    IpcBinaryMessage sendBuffer(IpcMessageType::CREATE_PORTS, m_appName);
+    sendBuffer.addEntry(IpcMessageType::CREATE_SERVER) << service << options << portConfigInfo;
 
-    auto maybeServer = requestServerFromRoudi(sendBuffer);
+    auto maybeServer = requestPortFromRoudi<popo::ServerPortUser::MemberType_t>(
+        sendBuffer,
+        IpcMessageType::CREATE_SERVER_ACK,
+        IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE,
+        IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE);
     if (maybeServer.has_error())
     {
         switch (maybeServer.get_error())
@@ -467,43 +449,175 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
     return maybeServer.value();
 }
 
-expected<popo::ServerPortUser::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept
+namespace
 {
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
+/// @brief the expected acknowledge and the errors of the response to a port request
+struct PortResponseTypes
+{
+    IpcMessageType ackType;
+    IpcMessageErrorType invalidResponseError;
+    IpcMessageErrorType wrongResponseError;
+};
+
+PortResponseTypes getPortResponseTypes(const IpcMessageType requestType) noexcept
+{
+    switch (requestType)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        return {IpcMessageType::CREATE_PUBLISHER_ACK,
+                IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE,
+                IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE};
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        return {IpcMessageType::CREATE_SUBSCRIBER_ACK,
+                IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE,
+                IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE};
+    case IpcMessageType::CREATE_CLIENT:
+        return {IpcMessageType::CREATE_CLIENT_ACK,
+                IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE,
+                IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE};
+    default:
+        // IpcMessageType::CREATE_SERVER, the PortCreationBatch contains only the four port requests
+        return {IpcMessageType::CREATE_SERVER_ACK,
+                IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE,
+                IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE};
+    }
+}
+} // namespace
+
+PortCreationBatch::Options_t
+PoshRuntimeImpl::adjustPortOptions(const PortCreationBatch::Request& request) const noexcept
+{
+    switch (request.type)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        return PortCreationBatch::Options_t(in_place_type<popo::PublisherOptions>(),
+                                            adjustPublisherOptions(*request.options.get<popo::PublisherOptions>()));
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        return PortCreationBatch::Options_t(
+            in_place_type<popo::SubscriberOptions>(),
+            adjustSubscriberOptions(request.service, *request.options.get<popo::SubscriberOptions>()));
+    case IpcMessageType::CREATE_CLIENT:
+        return PortCreationBatch::Options_t(in_place_type<popo::ClientOptions>(),
+                                            adjustClientOptions(*request.options.get<popo::ClientOptions>()));
+    case IpcMessageType::CREATE_SERVER:
+        return PortCreationBatch::Options_t(in_place_type<popo::ServerOptions>(),
+                                            adjustServerOptions(*request.options.get<popo::ServerOptions>()));
+    default:
+        return request.options;
+    }
+}
+
+void PoshRuntimeImpl::addPortRequest(IpcBinaryMessage& message,
+                                     const PortCreationBatch::Request& request,
+                                     const PortCreationBatch::Options_t& options) noexcept
+{
+    message.addEntry(request.type) << request.service;
+    switch (request.type)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        message << *options.get<popo::PublisherOptions>();
+        break;
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        message << *options.get<popo::SubscriberOptions>();
+        break;
+    case IpcMessageType::CREATE_CLIENT:
+        message << *options.get<popo::ClientOptions>();
+        break;
+    case IpcMessageType::CREATE_SERVER:
+        message << *options.get<popo::ServerOptions>();
+        break;
+    default:
+        break;
+    }
+    message << request.portConfigInfo;
+}
+
+void PoshRuntimeImpl::requestPortsFromRoudi(const IpcBinaryMessage& sendBuffer,
+                                            PortCreationBatch& batch,
+                                            const uint64_t beginIndex,
+                                            const uint64_t endIndex) noexcept
+{
+    IpcBinaryMessage receiveBuffer;
+    const bool requestSucceeded = sendRequestToRouDi(sendBuffer, receiveBuffer);
+    const bool isExpectedResponse = requestSucceeded
+                                    && receiveBuffer.getMessageType() == IpcMessageType::CREATE_PORTS_ACK
+                                    && receiveBuffer.getNumberOfEntries() == sendBuffer.getNumberOfEntries();
+    if (!requestSucceeded)
     {
-        IOX_LOG(ERROR) << "Request server got invalid response!";
-        return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE);
+        IOX_LOG(ERROR) << "Request ports got invalid response!";
     }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
+    else if (!isExpectedResponse)
     {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
+        IOX_LOG(ERROR) << "Request ports got wrong response from IPC channel with message type "
+                       << IpcMessageTypeToString(receiveBuffer.getMessageType()) << " and "
+                       << receiveBuffer.getNumberOfEntries() << " instead of " << sendBuffer.getNumberOfEntries()
+                       << " entries";
+    }
 
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_SERVER_ACK)
+    for (uint64_t index = beginIndex; index < endIndex; ++index)
+    {
+        auto& request = batch.m_requests[index];
+        const auto responseTypes = getPortResponseTypes(request.type);
+        if (!requestSucceeded)
         {
-            segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
-            return success<popo::ServerPortUser::MemberType_t*>(
-                reinterpret_cast<popo::ServerPortUser::MemberType_t*>(ptr));
+            request.error = responseTypes.invalidResponseError;
+            continue;
+        }
+        if (!isExpectedResponse)
+        {
+            request.error = responseTypes.wrongResponseError;
+            continue;
         }
+
+        readPortFromResponse(receiveBuffer, responseTypes.ackType, responseTypes.wrongResponseError)
+            .and_then([&](auto port) { request.port = port; })
+            .or_else([&](auto error) {
+                IOX_LOG(WARN) << "Could not create the port for service '" << request.service << "'";
+                request.error = error;
+            });
     }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
+}
+
+void PoshRuntimeImpl::createPorts(PortCreationBatch& batch) noexcept
+{
+    // every request is appended to a copy of the message, if it does not fit the collected requests are sent to
+    // RouDi and the request is added to the next message
+    IpcBinaryMessage sendBuffer(IpcMessageType::CREATE_PORTS, m_appName);
+    uint64_t beginIndex{0U};
+    for (uint64_t index = 0U; index < batch.size(); ++index)
     {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
+        auto& request = batch.m_requests[index];
+        request.port = nullptr;
+        request.error = IpcMessageErrorType::PORT_CREATION_NOT_REQUESTED;
+
+        const auto options = adjustPortOptions(request);
+        IpcBinaryMessage extendedSendBuffer{sendBuffer};
+        addPortRequest(extendedSendBuffer, request, options);
+
+        if (!extendedSendBuffer.isValid() && sendBuffer.getNumberOfEntries() > 0U)
         {
-            IOX_LOG(ERROR) << "Request server received no valid server port from RouDi.";
-            return error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
+            requestPortsFromRoudi(sendBuffer, batch, beginIndex, index);
+            sendBuffer = IpcBinaryMessage(IpcMessageType::CREATE_PORTS, m_appName);
+            beginIndex = index;
+            extendedSendBuffer = sendBuffer;
+            addPortRequest(extendedSendBuffer, request, options);
+        }
+
+        if (!extendedSendBuffer.isValid())
+        {
+            IOX_LOG(ERROR) << "The request for service '" << request.service << "' does not fit into a message";
+            request.error = getPortResponseTypes(request.type).invalidResponseError;
+            beginIndex = index + 1U;
+            continue;
         }
+
+        sendBuffer = extendedSendBuffer;
     }
 
-    IOX_LOG(ERROR) << "Request server got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE);
+    if (sendBuffer.getNumberOfEntries() > 0U)
+    {
+        requestPortsFromRoudi(sendBuffer, batch, beginIndex, batch.size());
+    }
 }
 
 popo::InterfacePortData* PoshRuntimeImpl::getMiddlewareInterface(const capro::Interfaces interface,
@@ -656,6 +770,13 @@ bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answ
     return m_ipcChannelInterface.sendRequestToRouDi(msg, answer);
 }
 
+bool PoshRuntimeImpl::sendRequestToRouDi(const IpcBinaryMessage& msg, IpcBinaryMessage& answer) noexcept
+{
+    // runtime must be thread safe
+    std::lock_guard<posix::mutex> g(m_appIpcRequestMutex);
+    return m_ipcChannelInterface.sendRequestToRouDi(msg, answer);
+}
+
 // this is the callback for the m_keepAliveTimer
 void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
 {
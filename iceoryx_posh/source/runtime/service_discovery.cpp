@@ -29,8 +29,31 @@ void ServiceDiscovery::update()
 {
     // allows us to use update and hence findService concurrently
     std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    bool hasChanges{true};
+    while (hasChanges)
+    {
+        m_serviceRegistryChangeSubscriber.take()
+            .and_then([&](popo::Sample<const roudi::ServiceRegistry::Change>& change) {
+                // changes which are older than the local registry are already contained in it
+                if (!m_serviceRegistry->apply(*change) && change->generation > m_serviceRegistry->generation())
+                {
+                    // changes were missed; RouDi publishes the full registry often enough that the latest one
+                    // contains them
+                    updateFromLatestSnapshot();
+                    m_serviceRegistry->apply(*change);
+                }
+            })
+            .or_else([&](auto&) { hasChanges = false; });
+    }
+}
+
+void ServiceDiscovery::updateFromLatestSnapshot()
+{
     m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
+        if (serviceRegistrySample->generation() > m_serviceRegistry->generation())
+        {
+            *m_serviceRegistry = *serviceRegistrySample;
+        }
     });
 }
 
@@ -80,7 +103,7 @@ void ServiceDiscovery::enableEvent(popo::TriggerHandle&& triggerHandle, const Se
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryChangeSubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -97,7 +120,7 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryChangeSubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -110,13 +133,13 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
 
 void ServiceDiscovery::invalidateTrigger(const uint64_t uniqueTriggerId)
 {
-    m_serviceRegistrySubscriber.invalidateTrigger(uniqueTriggerId);
+    m_serviceRegistryChangeSubscriber.invalidateTrigger(uniqueTriggerId);
 }
 
 popo::WaitSetIsConditionSatisfiedCallback
 ServiceDiscovery::getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state)
 {
-    return m_serviceRegistrySubscriber.getCallbackForIsStateConditionSatisfied(state);
+    return m_serviceRegistryChangeSubscriber.getCallbackForIsStateConditionSatisfied(state);
 }
 
 } // namespace runtime
@@ -0,0 +1,109 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_posh/iceoryx_posh_config.hpp"
+#include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/publisher.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/mocks/numa_topology_mock.hpp"
+#include "iceoryx_posh/testing/roudi_environment/roudi_environment.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi;
+
+constexpr uint32_t NUMBER_OF_NUMA_NODES{2U};
+
+/// @brief RouDi is started with one segment per NUMA node for the group of the test process, the fake topology
+/// provides the nodes on machines with a single node
+class NumaSegments_test : public Test
+{
+  public:
+    static RouDiConfig_t createConfig()
+    {
+        mepoo::MePooConfig mempoolConfig;
+        mempoolConfig.addMemPool({128U, 10U});
+
+        RouDiConfig_t config;
+        config.setDefaults();
+        config.m_sharedMemorySegments.clear();
+        const auto groupName = posix::PosixGroup::getGroupOfCurrentProcess().getName();
+        for (uint32_t node = 0U; node < NUMBER_OF_NUMA_NODES; ++node)
+        {
+            config.m_sharedMemorySegments.push_back(
+                {groupName, groupName, mempoolConfig, mepoo::MemoryInfo::numaNode(node)});
+        }
+        return config;
+    }
+
+    /// @brief returns the id of the segment the chunk of a sample from the publisher is located in
+    static uint64_t segmentIdOfLoanedChunk(const uint32_t numaNode)
+    {
+        popo::PublisherOptions options;
+        options.numaNode = numaNode;
+        popo::Publisher<uint64_t> publisher({"Numa", "Segment", "Selection"}, options);
+        auto sample = publisher.loan();
+        EXPECT_FALSE(sample.has_error());
+        return UntypedRelativePointer::searchId(sample.value().get());
+    }
+
+    FakeNumaTopology m_numaTopology{NUMBER_OF_NUMA_NODES};
+    RouDiEnvironment m_roudiEnv{createConfig()};
+};
+
+TEST_F(NumaSegments_test, SegmentsAreBoundToTheirNumaNodes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "95810519-f3fe-40c0-b4e7-2096b11f104f");
+    ASSERT_THAT(m_numaTopology.memoryBindings.size(), Eq(NUMBER_OF_NUMA_NODES));
+    for (uint32_t node = 0U; node < NUMBER_OF_NUMA_NODES; ++node)
+    {
+        EXPECT_THAT(m_numaTopology.memoryBindings[node].node, Eq(node));
+        EXPECT_THAT(m_numaTopology.memoryBindings[node].size, Gt(0U));
+    }
+    // the memory of RouDi's thread is only bound while a segment is created
+    EXPECT_THAT(m_numaTopology.threadBindings, ElementsAre(0U, 1U));
+    EXPECT_FALSE(m_numaTopology.isThreadMemoryBound);
+}
+
+TEST_F(NumaSegments_test, PublisherLoansChunksFromTheSegmentOfTheRequestedNumaNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a11781af-29c1-4df0-a5b2-75003409ebef");
+    runtime::PoshRuntime::initRuntime("numa_app");
+
+    const auto segmentIdOfNode0 = segmentIdOfLoanedChunk(0U);
+    const auto segmentIdOfNode1 = segmentIdOfLoanedChunk(1U);
+
+    EXPECT_THAT(segmentIdOfNode0, Ne(segmentIdOfNode1));
+}
+
+TEST_F(NumaSegments_test, PublisherWithoutOrWithUnavailableNumaNodeUsesTheFirstSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9806cb51-5a1e-4632-bf8e-8377a88e789c");
+    runtime::PoshRuntime::initRuntime("numa_app");
+
+    const auto segmentIdOfNode0 = segmentIdOfLoanedChunk(0U);
+
+    EXPECT_THAT(segmentIdOfLoanedChunk(mepoo::MemoryInfo::NO_NUMA_NODE), Eq(segmentIdOfNode0));
+    EXPECT_THAT(segmentIdOfLoanedChunk(NUMBER_OF_NUMA_NODES), Eq(segmentIdOfNode0));
+}
+
+} // namespace
@@ -19,8 +19,11 @@
 #include "iceoryx_hoofs/cxx/list.hpp"
 #include "iceoryx_hoofs/testing/barrier.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/mepoo/chunk_chain.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_posh/testing/roudi_gtest.hpp"
 #include "iox/optional.hpp"
@@ -738,4 +741,51 @@ TEST_F(PublisherSubscriberCommunication_test, PublisherUniqueIdMatchesReceivedSa
     }
 }
 
+TEST_F(PublisherSubscriberCommunication_test, ChunkChainLargerThanTheLargestMempoolChunkIsReceivedCompletely)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "912a0ca8-ce74-4119-8f3f-dd346418b755");
+    // larger than the largest chunk of the default mempools
+    constexpr uint64_t CHAIN_PAYLOAD_SIZE{16U * 1024U * 1024U + 123U};
+    constexpr uint32_t LINK_PAYLOAD_SIZE{128U * 1024U - 64U};
+
+    UntypedPublisher publisher{m_serviceDescription};
+    this->InterOpWait();
+    UntypedSubscriber subscriber{m_serviceDescription};
+    this->InterOpWait();
+
+    ASSERT_FALSE(publisher.loanChain(CHAIN_PAYLOAD_SIZE, LINK_PAYLOAD_SIZE)
+                     .and_then([&](auto& userPayload) {
+                         auto chain = mepoo::ChunkChain::fromUserPayload(userPayload);
+                         ASSERT_TRUE(chain.has_value());
+                         uint64_t position{0U};
+                         for (auto link : *chain)
+                         {
+                             for (auto& byte : link)
+                             {
+                                 byte = static_cast<uint8_t>(position++ % 251U);
+                             }
+                         }
+                         publisher.publish(userPayload);
+                     })
+                     .has_error());
+
+    auto result = subscriber.take();
+    ASSERT_FALSE(result.has_error());
+    auto chain = mepoo::ConstChunkChain::fromUserPayload(result.value());
+    ASSERT_TRUE(chain.has_value());
+    EXPECT_THAT(chain->size(), Eq(CHAIN_PAYLOAD_SIZE));
+    uint64_t position{0U};
+    uint64_t numberOfMismatches{0U};
+    for (auto link : *chain)
+    {
+        for (const auto byte : link)
+        {
+            numberOfMismatches += (byte == static_cast<uint8_t>(position++ % 251U)) ? 0U : 1U;
+        }
+    }
+    EXPECT_THAT(position, Eq(CHAIN_PAYLOAD_SIZE));
+    EXPECT_THAT(numberOfMismatches, Eq(0U));
+    subscriber.release(result.value());
+}
+
 } // namespace
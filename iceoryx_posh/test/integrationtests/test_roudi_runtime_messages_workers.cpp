@@ -0,0 +1,145 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/barrier.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/popo/publisher.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+constexpr uint32_t NUMBER_OF_RUNTIMES{8U};
+constexpr uint32_t NUMBER_OF_PORTS_PER_RUNTIME{4U};
+constexpr std::chrono::seconds RECEIVE_TIMEOUT{10};
+
+/// @brief the RouDi of the RouDi_GTest is started with the default number of runtime messages workers, i.e. the
+/// requests of the runtimes in this test are processed concurrently
+class RouDiRuntimeMessagesWorkers_test : public RouDi_GTest
+{
+  public:
+    void SetUp() override
+    {
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    static capro::ServiceDescription serviceOfRuntime(const uint32_t runtimeIndex, const uint32_t eventIndex)
+    {
+        return {"Worker",
+                into<lossy<capro::IdString_t>>("Runtime" + std::to_string(runtimeIndex)),
+                into<lossy<capro::IdString_t>>("Event" + std::to_string(eventIndex))};
+    }
+
+    /// @brief registers a runtime, offers its own services and subscribes to the services of the next runtime;
+    /// returns true when every subscriber received a sample
+    bool runRuntime(const uint32_t runtimeIndex)
+    {
+        runtime::PoshRuntime::initRuntime(into<lossy<RuntimeName_t>>("runtime_" + std::to_string(runtimeIndex)));
+
+        PublisherOptions publisherOptions;
+        publisherOptions.historyCapacity = 1U;
+        SubscriberOptions subscriberOptions;
+        subscriberOptions.historyRequest = 1U;
+
+        std::vector<std::unique_ptr<Publisher<uint64_t>>> publishers;
+        std::vector<std::unique_ptr<Subscriber<uint64_t>>> subscribers;
+        const auto otherRuntimeIndex = (runtimeIndex + 1U) % NUMBER_OF_RUNTIMES;
+        for (uint32_t i = 0U; i < NUMBER_OF_PORTS_PER_RUNTIME; ++i)
+        {
+            publishers.emplace_back(
+                std::make_unique<Publisher<uint64_t>>(serviceOfRuntime(runtimeIndex, i), publisherOptions));
+            subscribers.emplace_back(
+                std::make_unique<Subscriber<uint64_t>>(serviceOfRuntime(otherRuntimeIndex, i), subscriberOptions));
+        }
+
+        for (auto& publisher : publishers)
+        {
+            EXPECT_FALSE(publisher->publishCopyOf(runtimeIndex).has_error());
+        }
+
+        m_allRuntimesPublished.notify();
+        m_allRuntimesPublished.wait();
+
+        std::vector<bool> hasReceived(NUMBER_OF_PORTS_PER_RUNTIME, false);
+        uint32_t numberOfReceivingSubscribers{0U};
+        const auto deadline = std::chrono::steady_clock::now() + RECEIVE_TIMEOUT;
+        while (numberOfReceivingSubscribers < NUMBER_OF_PORTS_PER_RUNTIME
+               && std::chrono::steady_clock::now() < deadline)
+        {
+            for (uint32_t i = 0U; i < NUMBER_OF_PORTS_PER_RUNTIME; ++i)
+            {
+                subscribers[i]->take().and_then([&](auto& sample) {
+                    EXPECT_THAT(*sample, Eq(otherRuntimeIndex));
+                    if (!hasReceived[i])
+                    {
+                        hasReceived[i] = true;
+                        ++numberOfReceivingSubscribers;
+                    }
+                });
+            }
+            std::this_thread::yield();
+        }
+
+        m_allRuntimesReceived.notify();
+        m_allRuntimesReceived.wait();
+
+        return numberOfReceivingSubscribers == NUMBER_OF_PORTS_PER_RUNTIME;
+    }
+
+    Watchdog m_watchdog{60_s};
+    Barrier m_allRuntimesPublished{NUMBER_OF_RUNTIMES};
+    Barrier m_allRuntimesReceived{NUMBER_OF_RUNTIMES};
+};
+
+TEST_F(RouDiRuntimeMessagesWorkers_test, PortsOfConcurrentlyStartingRuntimesAreConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a0d5d6e-4a9c-4f1e-9c39-6f0e4a4d2b57");
+
+    std::atomic<uint32_t> numberOfSuccessfulRuntimes{0U};
+    std::vector<std::thread> runtimes;
+    for (uint32_t i = 0U; i < NUMBER_OF_RUNTIMES; ++i)
+    {
+        runtimes.emplace_back([&, i] {
+            if (runRuntime(i))
+            {
+                ++numberOfSuccessfulRuntimes;
+            }
+        });
+    }
+    for (auto& runtime : runtimes)
+    {
+        runtime.join();
+    }
+
+    EXPECT_THAT(numberOfSuccessfulRuntimes.load(), Eq(NUMBER_OF_RUNTIMES));
+}
+
+} // namespace
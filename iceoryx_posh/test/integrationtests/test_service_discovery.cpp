@@ -28,6 +28,7 @@
 #include "iceoryx_posh/testing/roudi_gtest.hpp"
 #include "test.hpp"
 
+#include <memory>
 #include <random>
 #include <set>
 #include <type_traits>
@@ -191,7 +192,7 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     ::testing::Test::RecordProperty("TEST_ID", "d944f32c-edef-44f5-a6eb-c19ee73c98eb");
     findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
 
-    constexpr uint32_t NUM_INTERNAL_SERVICES = 6U;
+    constexpr uint32_t NUM_INTERNAL_SERVICES = 8U;
     EXPECT_EQ(serviceContainer.size(), NUM_INTERNAL_SERVICES);
     for (auto& service : serviceContainer)
     {
@@ -251,6 +252,36 @@ TYPED_TEST(ServiceDiscovery_test, ServiceOfferedMultipleTimesCanBeFound)
     EXPECT_THAT(serviceContainer[0], Eq(SERVICE_DESCRIPTION));
 }
 
+TYPED_TEST(ServiceDiscovery_test, ServicesOfferedWhileMoreChangesThanTheChangeHistoryWereMissedCanBeFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "74243842-39e0-45ed-9be7-bb125bf5e6e0");
+    // more changes than the change queue can hold, the discovery has to fall back to the full registry
+    constexpr uint64_t NUMBER_OF_PRODUCERS{3U * iox::roudi::ServiceRegistry::CHANGE_HISTORY_CAPACITY};
+    std::vector<std::unique_ptr<typename TestFixture::CommunicationKind::Producer>> producers;
+    for (uint64_t i = 0U; i < NUMBER_OF_PRODUCERS; ++i)
+    {
+        const iox::capro::ServiceDescription serviceDescription(
+            "missed", "instance", IdString_t(iox::TruncateToCapacity, std::to_string(i).c_str()));
+        producers.emplace_back(new typename TestFixture::CommunicationKind::Producer(serviceDescription));
+    }
+
+    do
+    {
+        this->waitUntilServiceChange();
+        this->findService(IdString_t("missed"), iox::capro::Wildcard, iox::capro::Wildcard);
+    } while (serviceContainer.size() < NUMBER_OF_PRODUCERS);
+    EXPECT_THAT(serviceContainer.size(), Eq(NUMBER_OF_PRODUCERS));
+
+    producers.clear();
+    do
+    {
+        this->waitUntilServiceChange();
+        this->findService(IdString_t("missed"), iox::capro::Wildcard, iox::capro::Wildcard);
+    } while (!serviceContainer.empty());
+
+    EXPECT_TRUE(serviceContainer.empty());
+}
+
 //
 // Notification Tests
 // Check whether attaching, notification and detaching of waitset and listener works
@@ -453,10 +484,14 @@ class ReferenceDiscovery
             services.emplace(iox::roudi::IntrospectionPortService);
             services.emplace(iox::roudi::IntrospectionPortThroughputService);
             services.emplace(iox::roudi::IntrospectionSubscriberPortChangingDataService);
+            services.emplace(iox::roudi::IntrospectionSubscriberLatencyService);
             services.emplace(iox::roudi::IntrospectionProcessService);
             services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
                              iox::SERVICE_DISCOVERY_EVENT_NAME);
+            services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                             iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                             iox::SERVICE_DISCOVERY_CHANGES_EVENT_NAME);
         }
     }
 
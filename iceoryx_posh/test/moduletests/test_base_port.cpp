@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
@@ -199,4 +200,45 @@ TYPED_TEST(BasePort_test, CallingGetRuntimeNameWorks)
     EXPECT_THAT(this->sut.getRuntimeName(), Eq(expectedProcessName<PortData_t>()));
 }
 
+TYPED_TEST(BasePort_test, NewPortRequestsDiscoveryOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a56b345-1b69-4321-b394-9ee7e19067d8");
+    EXPECT_TRUE(this->sut.takeDiscoveryRequest());
+    EXPECT_FALSE(this->sut.takeDiscoveryRequest());
+}
+
+TYPED_TEST(BasePort_test, RequestDiscoveryIsTakenOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c962b860-adb8-409a-a644-23bfa10a97ea");
+    this->sut.takeDiscoveryRequest();
+
+    this->sut.requestDiscovery();
+
+    EXPECT_TRUE(this->sut.takeDiscoveryRequest());
+    EXPECT_FALSE(this->sut.takeDiscoveryRequest());
+}
+
+TYPED_TEST(BasePort_test, DestroyRequestsDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de3e39e9-91f1-40c0-8a70-1991189fd970");
+    this->sut.takeDiscoveryRequest();
+
+    this->sut.destroy();
+
+    EXPECT_TRUE(this->sut.toBeDestroyed());
+    EXPECT_TRUE(this->sut.takeDiscoveryRequest());
+}
+
+TYPED_TEST(BasePort_test, RequestDiscoveryNotifiesTheDiscoveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d397c044-0b71-4871-bd7c-e0a60eea037f");
+    ConditionVariableData discoveryConditionVariable{"RouDi"};
+    this->sutData->m_discoveryConditionVariable = &discoveryConditionVariable;
+
+    this->sut.requestDiscovery();
+
+    EXPECT_TRUE(discoveryConditionVariable.m_wasNotified.load());
+    EXPECT_TRUE(discoveryConditionVariable.isNotificationActive(BasePort::DISCOVERY_NOTIFICATION_INDEX));
+}
+
 } // namespace
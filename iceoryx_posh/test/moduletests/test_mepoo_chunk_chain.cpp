@@ -0,0 +1,233 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_chain.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+#include "test.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class ChunkChain_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({SMALL_CHUNK_PAYLOAD_SIZE, CHUNK_COUNT});
+        mempoolconf.addMemPool({LARGE_CHUNK_PAYLOAD_SIZE, CHUNK_COUNT});
+        sut.configureMemoryManager(mempoolconf, allocator, allocator);
+    }
+
+    SharedChunk getChain(const uint64_t chainPayloadSize)
+    {
+        auto chainResult = sut.getChunkChain(chainPayloadSize, linkSettings, chunkMagazine);
+        EXPECT_FALSE(chainResult.has_error());
+        return chainResult.has_error() ? SharedChunk() : chainResult.value();
+    }
+
+    uint32_t usedChunks(const uint32_t memPoolIndex) const
+    {
+        return sut.getMemPoolInfo(memPoolIndex).m_usedChunks;
+    }
+
+    static constexpr uint32_t SMALL_CHUNK_PAYLOAD_SIZE{128U};
+    static constexpr uint32_t LARGE_CHUNK_PAYLOAD_SIZE{512U};
+    static constexpr uint32_t CHUNK_COUNT{10U};
+    static constexpr uint32_t LINK_PAYLOAD_SIZE{256U};
+    static constexpr uint32_t SMALL_MEMPOOL{0U};
+    static constexpr uint32_t LARGE_MEMPOOL{1U};
+
+    static constexpr uint64_t MEMORY_SIZE{1024U * 1024U};
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
+    iox::BumpAllocator allocator{memory.get(), MEMORY_SIZE};
+    MemoryManager sut;
+    ChunkMagazine chunkMagazine{0U};
+
+    const ChunkSettings linkSettings{ChunkSettings::create(LINK_PAYLOAD_SIZE,
+                                                           iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                           sizeof(ChunkChainHeader),
+                                                           alignof(ChunkChainHeader))
+                                         .value()};
+};
+
+constexpr uint32_t ChunkChain_test::SMALL_CHUNK_PAYLOAD_SIZE;
+constexpr uint32_t ChunkChain_test::LARGE_CHUNK_PAYLOAD_SIZE;
+constexpr uint32_t ChunkChain_test::CHUNK_COUNT;
+constexpr uint32_t ChunkChain_test::LINK_PAYLOAD_SIZE;
+constexpr uint32_t ChunkChain_test::SMALL_MEMPOOL;
+constexpr uint32_t ChunkChain_test::LARGE_MEMPOOL;
+
+TEST_F(ChunkChain_test, ChainIsSplitIntoLinksOfTheLinkSizeAndAShorterLastLink)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f5f6baf-8b2e-4b04-a286-3f8aba41d824");
+    constexpr uint64_t REMAINDER{40U};
+    constexpr uint64_t CHAIN_PAYLOAD_SIZE{3U * LINK_PAYLOAD_SIZE + REMAINDER};
+
+    auto chain = getChain(CHAIN_PAYLOAD_SIZE);
+
+    auto view = ChunkChain::fromUserPayload(chain.getUserPayload());
+    ASSERT_TRUE(view.has_value());
+    EXPECT_THAT(view->size(), Eq(CHAIN_PAYLOAD_SIZE));
+    EXPECT_THAT(view->numberOfLinks(), Eq(4U));
+    std::vector<uint64_t> linkSizes;
+    for (auto link : *view)
+    {
+        linkSizes.push_back(link.size());
+    }
+    EXPECT_THAT(linkSizes, ElementsAre(LINK_PAYLOAD_SIZE, LINK_PAYLOAD_SIZE, LINK_PAYLOAD_SIZE, REMAINDER));
+}
+
+TEST_F(ChunkChain_test, ChainOccupiesOnlyTheChunksOfFittingMempools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "896fc598-ed61-441c-ab95-84099d2996fb");
+    auto chain = getChain(2U * LINK_PAYLOAD_SIZE + 1U);
+
+    EXPECT_THAT(usedChunks(LARGE_MEMPOOL), Eq(2U));
+    EXPECT_THAT(usedChunks(SMALL_MEMPOOL), Eq(1U));
+}
+
+TEST_F(ChunkChain_test, ChainWithAMultipleOfTheLinkSizeHasOnlyFullLinks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29253050-aa41-4beb-9ffd-1a0fe8e188dc");
+    auto chain = getChain(2U * LINK_PAYLOAD_SIZE);
+
+    auto view = ChunkChain::fromUserPayload(chain.getUserPayload());
+    ASSERT_TRUE(view.has_value());
+    EXPECT_THAT(view->numberOfLinks(), Eq(2U));
+    EXPECT_THAT(usedChunks(LARGE_MEMPOOL), Eq(2U));
+    EXPECT_THAT(usedChunks(SMALL_MEMPOOL), Eq(0U));
+}
+
+TEST_F(ChunkChain_test, ChainSmallerThanTheLinkSizeHasASingleLink)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf8ce7c5-2557-415b-84fc-23c91f59e821");
+    constexpr uint64_t CHAIN_PAYLOAD_SIZE{10U};
+    auto chain = getChain(CHAIN_PAYLOAD_SIZE);
+
+    auto view = ChunkChain::fromUserPayload(chain.getUserPayload());
+    ASSERT_TRUE(view.has_value());
+    EXPECT_THAT(view->numberOfLinks(), Eq(1U));
+    EXPECT_THAT((*view->begin()).size(), Eq(CHAIN_PAYLOAD_SIZE));
+    EXPECT_THAT(++view->begin(), Eq(view->end()));
+}
+
+TEST_F(ChunkChain_test, ReleasingTheFirstLinkReleasesTheWholeChain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f2070c7-3a30-4344-be1e-ffe9e70ea00d");
+    {
+        auto chain = getChain(5U * LINK_PAYLOAD_SIZE + 1U);
+        EXPECT_THAT(usedChunks(LARGE_MEMPOOL), Eq(5U));
+        EXPECT_THAT(usedChunks(SMALL_MEMPOOL), Eq(1U));
+    }
+
+    EXPECT_THAT(usedChunks(LARGE_MEMPOOL), Eq(0U));
+    EXPECT_THAT(usedChunks(SMALL_MEMPOOL), Eq(0U));
+}
+
+TEST_F(ChunkChain_test, EveryReferenceOfTheFirstLinkKeepsTheWholeChainAlive)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "841eebea-1f97-4318-ac31-d190793e39a2");
+    auto chain = getChain(3U * LINK_PAYLOAD_SIZE);
+    auto reference = chain;
+
+    chain = nullptr;
+    EXPECT_THAT(usedChunks(LARGE_MEMPOOL), Eq(3U));
+
+    reference = nullptr;
+    EXPECT_THAT(usedChunks(LARGE_MEMPOOL), Eq(0U));
+}
+
+TEST_F(ChunkChain_test, ChainWhichDoesNotFitIntoTheMempoolsIsReleasedCompletely)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "11a857c7-e3cc-46f5-87fc-9c48d2092d2e");
+    iox::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    auto chainResult = sut.getChunkChain((CHUNK_COUNT + 1U) * LINK_PAYLOAD_SIZE, linkSettings, chunkMagazine);
+
+    ASSERT_TRUE(chainResult.has_error());
+    EXPECT_THAT(chainResult.get_error(), Eq(MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS));
+    EXPECT_THAT(usedChunks(LARGE_MEMPOOL), Eq(0U));
+}
+
+TEST_F(ChunkChain_test, DataWrittenToTheLinksIsReadInTheSameOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5c6fe7b-5908-4b37-9527-036640c52ddb");
+    constexpr uint64_t CHAIN_PAYLOAD_SIZE{4U * LINK_PAYLOAD_SIZE + 7U};
+    auto chain = getChain(CHAIN_PAYLOAD_SIZE);
+
+    auto writableChain = ChunkChain::fromUserPayload(chain.getUserPayload());
+    ASSERT_TRUE(writableChain.has_value());
+    uint64_t position{0U};
+    for (auto link : *writableChain)
+    {
+        for (auto& byte : link)
+        {
+            byte = static_cast<uint8_t>(position++);
+        }
+    }
+
+    const void* receivedUserPayload = chain.getUserPayload();
+    auto readableChain = ConstChunkChain::fromUserPayload(receivedUserPayload);
+    ASSERT_TRUE(readableChain.has_value());
+    position = 0U;
+    bool isEqual{true};
+    for (auto link : *readableChain)
+    {
+        for (const auto byte : link)
+        {
+            isEqual &= (byte == static_cast<uint8_t>(position++));
+        }
+    }
+    EXPECT_TRUE(isEqual);
+    EXPECT_THAT(position, Eq(CHAIN_PAYLOAD_SIZE));
+}
+
+TEST_F(ChunkChain_test, ViewOfAChunkWithoutChainIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7471494-e75b-4500-9b41-09e2d3590513");
+    auto chunk =
+        sut.getChunk(ChunkSettings::create(LINK_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value());
+    ASSERT_FALSE(chunk.has_error());
+
+    EXPECT_FALSE(ChunkChain::fromUserPayload(chunk.value().getUserPayload()).has_value());
+    EXPECT_FALSE(ChunkChain::fromUserPayload(nullptr).has_value());
+}
+
+TEST_F(ChunkChain_test, ViewOfALinkBehindTheFirstOneIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "255b55a4-a5be-4ead-97b2-4cec9d10b755");
+    auto chain = getChain(2U * LINK_PAYLOAD_SIZE);
+    auto view = ChunkChain::fromUserPayload(chain.getUserPayload());
+    ASSERT_TRUE(view.has_value());
+
+    auto secondLink = *(++view->begin());
+
+    EXPECT_FALSE(ChunkChain::fromUserPayload(secondLink.data()).has_value());
+}
+
+} // namespace
@@ -0,0 +1,167 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_magazine.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
+#include "iox/bump_allocator.hpp"
+#include "test.hpp"
+
+#include <set>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class ChunkMagazine_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_CHUNKS{20U};
+    static constexpr uint32_t CHUNK_SIZE{128U};
+    static constexpr uint32_t MAGAZINE_CAPACITY{8U};
+    static constexpr uint64_t MEMORY_SIZE{1024U * 1024U};
+
+    ChunkMagazine_test()
+        : allocator(m_rawMemory, MEMORY_SIZE)
+        , memPool(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator)
+        , otherMemPool(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator)
+        , chunkManagementPool(sizeof(ChunkManagement), 2U * NUMBER_OF_CHUNKS, allocator, allocator)
+    {
+    }
+
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t m_rawMemory[MEMORY_SIZE];
+    iox::BumpAllocator allocator;
+    MemPool memPool;
+    MemPool otherMemPool;
+    MemPool chunkManagementPool;
+
+    ChunkMagazine sut{MAGAZINE_CAPACITY};
+};
+
+constexpr uint32_t ChunkMagazine_test::NUMBER_OF_CHUNKS;
+constexpr uint32_t ChunkMagazine_test::MAGAZINE_CAPACITY;
+
+TEST_F(ChunkMagazine_test, CapacityIsClampedToMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2ae1214d-78c4-4e7c-9396-4b9e21d26ce3");
+    ChunkMagazine sut{iox::MAX_CHUNK_MAGAZINE_CAPACITY + 1U};
+
+    EXPECT_THAT(sut.capacity(), Eq(iox::MAX_CHUNK_MAGAZINE_CAPACITY));
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(ChunkMagazine_test, TakeFromDisabledMagazineFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a3803a7-8222-4932-ae67-5dce366fcead");
+    ChunkMagazine sut{0U};
+
+    EXPECT_FALSE(sut.take(memPool, chunkManagementPool).has_value());
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkMagazine_test, FirstTakeReservesChunksWithCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7778033c-aab0-4bab-a212-114b48aecaf4");
+    auto reservedChunk = sut.take(memPool, chunkManagementPool);
+
+    ASSERT_TRUE(reservedChunk.has_value());
+    EXPECT_THAT(reservedChunk->chunk, Ne(nullptr));
+    EXPECT_THAT(reservedChunk->chunkManagement, Ne(nullptr));
+    EXPECT_THAT(sut.size(), Eq(MAGAZINE_CAPACITY - 1U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(chunkManagementPool.getUsedChunks(), Eq(MAGAZINE_CAPACITY));
+}
+
+TEST_F(ChunkMagazine_test, TakeReturnsDistinctChunksUntilTheMempoolIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1389bec4-fee5-4466-97af-83acabae6333");
+    std::set<void*> chunks;
+    std::set<void*> chunkManagements;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto reservedChunk = sut.take(memPool, chunkManagementPool);
+        ASSERT_TRUE(reservedChunk.has_value());
+        chunks.insert(reservedChunk->chunk);
+        chunkManagements.insert(reservedChunk->chunkManagement);
+    }
+
+    EXPECT_FALSE(sut.take(memPool, chunkManagementPool).has_value());
+    EXPECT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(chunkManagements.size(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(0U));
+    EXPECT_THAT(chunkManagementPool.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(ChunkMagazine_test, DrainReturnsOnlyCachedChunksToTheMempools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d11a75ef-ceba-42d9-b937-c1330d0198b0");
+    constexpr uint32_t NUMBER_OF_TAKEN_CHUNKS{3U};
+    for (uint32_t i = 0U; i < NUMBER_OF_TAKEN_CHUNKS; ++i)
+    {
+        ASSERT_TRUE(sut.take(memPool, chunkManagementPool).has_value());
+    }
+
+    sut.drain();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(NUMBER_OF_TAKEN_CHUNKS));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(0U));
+    EXPECT_THAT(chunkManagementPool.getUsedChunks(), Eq(NUMBER_OF_TAKEN_CHUNKS));
+    EXPECT_THAT(chunkManagementPool.getCachedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkMagazine_test, DrainOfUnusedMagazineDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c185a306-a293-4106-84c5-8880fd3de177");
+    sut.drain();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkMagazine_test, TakeFromOtherMempoolReturnsCachedChunksToPreviousMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70098308-bcb6-4b7f-9d8a-4d571342603e");
+    ASSERT_TRUE(sut.take(memPool, chunkManagementPool).has_value());
+
+    auto reservedChunk = sut.take(otherMemPool, chunkManagementPool);
+
+    ASSERT_TRUE(reservedChunk.has_value());
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(0U));
+    EXPECT_THAT(otherMemPool.getUsedChunks(), Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(chunkManagementPool.getUsedChunks(), Eq(MAGAZINE_CAPACITY + 1U));
+}
+
+TEST_F(ChunkMagazine_test, RefillIsLimitedByAvailableChunkManagements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c758b76-0245-4853-8b01-23dd542f1f3b");
+    constexpr uint32_t NUMBER_OF_FREE_CHUNK_MANAGEMENTS{2U};
+    for (uint32_t i = 0U; i < 2U * NUMBER_OF_CHUNKS - NUMBER_OF_FREE_CHUNK_MANAGEMENTS; ++i)
+    {
+        ASSERT_THAT(chunkManagementPool.getChunk(), Ne(nullptr));
+    }
+
+    ASSERT_TRUE(sut.take(memPool, chunkManagementPool).has_value());
+
+    EXPECT_THAT(sut.size(), Eq(NUMBER_OF_FREE_CHUNK_MANAGEMENTS - 1U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(NUMBER_OF_FREE_CHUNK_MANAGEMENTS));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(NUMBER_OF_FREE_CHUNK_MANAGEMENTS));
+}
+
+} // namespace
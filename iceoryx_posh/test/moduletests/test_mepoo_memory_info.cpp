@@ -57,4 +57,12 @@ TEST(MemoryInfo_test, ComparisonOperatorReturnsFalseWhenMemoryTypeDoesNotMatch)
     EXPECT_FALSE(info1 == info2);
     EXPECT_FALSE(info2 == info1);
 }
+
+TEST(MemoryInfo_test, NumaNodeIsProvidedForMemoryOfNumaNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "99982dff-bd9b-4ba7-beff-e9580093ec2f");
+    EXPECT_THAT(MemoryInfo::numaNode(3U).getNumaNode(), Eq(3U));
+    EXPECT_THAT(MemoryInfo::numaNode(3U).memoryType, Eq(MemoryInfo::NUMA_NODE_MEMORY_TYPE));
+    EXPECT_THAT(MemoryInfo().getNumaNode(), Eq(MemoryInfo::NO_NUMA_NODE));
+}
 } // namespace
@@ -475,6 +475,172 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     EXPECT_DEATH({ sut->configureMemoryManager(mempoolconf, *allocator, *allocator); }, ".*");
 }
 
+TEST_F(MemoryManager_test, getChunkSelectsSmallestFittingMemPoolOutOfManyMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c8d1b64-2f0e-4d4a-b07b-6e2f9c2a7d15");
+    constexpr uint32_t CHUNK_COUNT{1U};
+    const std::vector<uint32_t> chunkPayloadSizes{
+        8U, 16U, 24U, 32U, 40U, 64U, 72U, 80U, 128U, 136U, 256U, 504U, 512U, 520U, 1000U, 4096U, 8192U, 12288U, 65536U};
+    for (const auto chunkPayloadSize : chunkPayloadSizes)
+    {
+        mempoolconf.addMemPool({chunkPayloadSize, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    const uint32_t MAX_USER_PAYLOAD_SIZE{chunkPayloadSizes.back() + 64U};
+    for (uint32_t userPayloadSize = 0U; userPayloadSize < MAX_USER_PAYLOAD_SIZE; userPayloadSize += 4U)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        const auto requiredChunkSize = chunkSettingsResult.value().requiredChunkSize();
+
+        iox::optional<uint32_t> expectedChunkSize;
+        for (uint32_t i = 0U; i < sut->getNumberOfMemPools(); ++i)
+        {
+            if (sut->getMemPoolInfo(i).m_chunkSize >= requiredChunkSize)
+            {
+                expectedChunkSize.emplace(sut->getMemPoolInfo(i).m_chunkSize);
+                break;
+            }
+        }
+
+        if (!expectedChunkSize.has_value())
+        {
+            auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+                [](const iox::PoshError, const iox::ErrorLevel) {});
+            auto chunkResult = sut->getChunk(chunkSettingsResult.value());
+            ASSERT_TRUE(chunkResult.has_error());
+            EXPECT_THAT(chunkResult.get_error(),
+                        Eq(iox::mepoo::MemoryManager::Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE));
+            continue;
+        }
+
+        sut->getChunk(chunkSettingsResult.value())
+            .and_then([&](auto& chunk) { EXPECT_THAT(chunk.getChunkHeader()->chunkSize(), Eq(*expectedChunkSize)); })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkMagazineReservesChunksAndReleasesThemOnDrain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f8a64e1-d850-4804-9e47-2bee1d8302da");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t CHUNK_MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine chunkMagazine{CHUNK_MAGAZINE_CAPACITY};
+
+    auto chunkSettingsResult = ChunkSettings::create(CHUNK_SIZE_64, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    {
+        auto chunkResult = sut->getChunk(chunkSettingsResult.value(), chunkMagazine);
+        ASSERT_FALSE(chunkResult.has_error());
+        EXPECT_THAT(chunkResult.value().getChunkHeader()->userPayloadSize(), Eq(CHUNK_SIZE_64));
+        EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_MAGAZINE_CAPACITY));
+        EXPECT_THAT(sut->getMemPoolInfo(1).m_cachedChunks, Eq(CHUNK_MAGAZINE_CAPACITY));
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_MAGAZINE_CAPACITY - 1U));
+
+    chunkMagazine.drain();
+
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_cachedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithDisabledChunkMagazineDoesNotReserveChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "144cf537-2841-4401-8bef-f8c4adff52b7");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine chunkMagazine{0U};
+
+    auto chunkSettingsResult = ChunkSettings::create(CHUNK_SIZE_32, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    auto chunkResult = sut->getChunk(chunkSettingsResult.value(), chunkMagazine);
+
+    ASSERT_FALSE(chunkResult.has_error());
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_cachedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkMagazineFailsWhenMempoolIsRunningOutOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c7f1cea-cf12-47b6-a92d-8737ed398bcc");
+    constexpr uint32_t CHUNK_COUNT{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine chunkMagazine{iox::MAX_CHUNK_MAGAZINE_CAPACITY};
+
+    auto chunkSettingsResult = ChunkSettings::create(CHUNK_SIZE_32, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    ChunkStore chunkStore;
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        sut->getChunk(chunkSettingsResult.value(), chunkMagazine)
+            .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+
+    iox::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+    auto chunkResult = sut->getChunk(chunkSettingsResult.value(), chunkMagazine);
+
+    ASSERT_TRUE(chunkResult.has_error());
+    EXPECT_THAT(chunkResult.get_error(), Eq(iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS));
+}
+
+TEST(MemoryManagerSizeClass_test, SizeClassesAreOrderedAndMatchTheirLowerBounds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a6f7e0d2-6b1c-4b4e-9a55-0f6d2c1e8b3a");
+    using iox::mepoo::MemoryManager;
+
+    std::vector<uint32_t> chunkSizes;
+    for (uint32_t chunkSize = 0U; chunkSize < 4096U; ++chunkSize)
+    {
+        chunkSizes.push_back(chunkSize);
+    }
+    for (uint32_t bit = 12U; bit < 32U; ++bit)
+    {
+        const uint32_t powerOfTwo = 1U << bit;
+        chunkSizes.push_back(powerOfTwo - 1U);
+        chunkSizes.push_back(powerOfTwo);
+        chunkSizes.push_back(powerOfTwo + 1U);
+        chunkSizes.push_back(powerOfTwo + (powerOfTwo >> 1U));
+    }
+    chunkSizes.push_back(std::numeric_limits<uint32_t>::max());
+
+    uint32_t previousSizeClass{0U};
+    for (const auto chunkSize : chunkSizes)
+    {
+        const auto sizeClass = MemoryManager::sizeClassIndex(chunkSize);
+        ASSERT_THAT(sizeClass, Lt(MemoryManager::NUMBER_OF_SIZE_CLASSES));
+        EXPECT_THAT(sizeClass, Ge(previousSizeClass));
+        EXPECT_THAT(MemoryManager::sizeClassLowerBound(sizeClass), Le(chunkSize));
+        if (sizeClass + 1U < MemoryManager::NUMBER_OF_SIZE_CLASSES)
+        {
+            EXPECT_THAT(MemoryManager::sizeClassLowerBound(sizeClass + 1U), Gt(chunkSize));
+        }
+        previousSizeClass = sizeClass;
+    }
+
+    EXPECT_THAT(MemoryManager::sizeClassIndex(std::numeric_limits<uint32_t>::max()),
+                Eq(MemoryManager::NUMBER_OF_SIZE_CLASSES - 1U));
+}
+
+TEST(MemoryManagerSizeClass_test, SizeClassIndexCanBeEvaluatedAtCompileTime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f1d2c3b4-5a69-4788-9e0f-1a2b3c4d5e6f");
+    using iox::mepoo::MemoryManager;
+    constexpr uint32_t SIZE_CLASS = MemoryManager::sizeClassIndex(4096U);
+    static_assert(MemoryManager::sizeClassLowerBound(SIZE_CLASS) == 4096U, "4096 is the lower bound of its size class");
+    EXPECT_THAT(SIZE_CLASS, Eq(MemoryManager::sizeClassIndex(4096U)));
+}
+
 TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5f6c3942-0af5-4c48-b44c-7268191dbac5");
@@ -19,6 +19,8 @@
 #include "iox/bump_allocator.hpp"
 #include "test.hpp"
 
+#include <set>
+
 namespace
 {
 using namespace ::testing;
@@ -209,6 +211,90 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, ReserveChunksReservesRequestedNumberOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0284f54-4391-4b05-ba98-7d39c17e4ff7");
+    constexpr uint32_t NUMBER_OF_RESERVED_CHUNKS{10U};
+    uint32_t chunkIndices[NUMBER_OF_RESERVED_CHUNKS];
+
+    EXPECT_THAT(sut.reserveChunks(&chunkIndices[0], NUMBER_OF_RESERVED_CHUNKS), Eq(NUMBER_OF_RESERVED_CHUNKS));
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_RESERVED_CHUNKS));
+    EXPECT_THAT(sut.getCachedChunks(), Eq(NUMBER_OF_RESERVED_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_RESERVED_CHUNKS));
+    EXPECT_THAT(sut.getInfo().m_cachedChunks, Eq(NUMBER_OF_RESERVED_CHUNKS));
+}
+
+TEST_F(MemPool_test, ReserveChunksReturnsRemainingChunksWhenRunningOutOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf524f06-180f-4129-8394-7cc816348a13");
+    constexpr uint32_t NUMBER_OF_USED_CHUNKS{NUMBER_OF_CHUNKS - 3U};
+    for (uint32_t i = 0U; i < NUMBER_OF_USED_CHUNKS; ++i)
+    {
+        ASSERT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+    uint32_t chunkIndices[NUMBER_OF_CHUNKS];
+
+    EXPECT_THAT(sut.reserveChunks(&chunkIndices[0], NUMBER_OF_CHUNKS), Eq(3U));
+    EXPECT_THAT(sut.reserveChunks(&chunkIndices[0], NUMBER_OF_CHUNKS), Eq(0U));
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getCachedChunks(), Eq(3U));
+}
+
+TEST_F(MemPool_test, ReservedChunksAreDistinctAndWithinTheMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d524dc7a-5ba6-46c0-b7c0-a634045b652d");
+    uint32_t chunkIndices[NUMBER_OF_CHUNKS];
+    ASSERT_THAT(sut.reserveChunks(&chunkIndices[0], NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    std::set<void*> chunks;
+    for (const auto chunkIndex : chunkIndices)
+    {
+        auto chunk = static_cast<uint8_t*>(sut.getReservedChunk(chunkIndex));
+        EXPECT_THAT(chunk, Ge(&m_rawMemory[0]));
+        EXPECT_THAT(chunk, Lt(&m_rawMemory[0] + sizeof(m_rawMemory)));
+        chunks.insert(chunk);
+    }
+    EXPECT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, MarkReservedChunksAsUsedKeepsChunksInUse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ba99dea-e7ce-42be-9c79-873f52b82817");
+    constexpr uint32_t NUMBER_OF_RESERVED_CHUNKS{8U};
+    constexpr uint32_t NUMBER_OF_TAKEN_CHUNKS{5U};
+    uint32_t chunkIndices[NUMBER_OF_RESERVED_CHUNKS];
+    ASSERT_THAT(sut.reserveChunks(&chunkIndices[0], NUMBER_OF_RESERVED_CHUNKS), Eq(NUMBER_OF_RESERVED_CHUNKS));
+
+    sut.markReservedChunksAsUsed(NUMBER_OF_TAKEN_CHUNKS);
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_RESERVED_CHUNKS));
+    EXPECT_THAT(sut.getCachedChunks(), Eq(NUMBER_OF_RESERVED_CHUNKS - NUMBER_OF_TAKEN_CHUNKS));
+
+    sut.freeChunk(sut.getReservedChunk(chunkIndices[0]));
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_RESERVED_CHUNKS - 1U));
+}
+
+TEST_F(MemPool_test, ReleaseReservedChunksReturnsChunksToTheMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9bd45dd5-e887-47fa-a471-1621494cd877");
+    uint32_t chunkIndices[NUMBER_OF_CHUNKS];
+    ASSERT_THAT(sut.reserveChunks(&chunkIndices[0], NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    sut.releaseReservedChunks(&chunkIndices[0], NUMBER_OF_CHUNKS);
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getCachedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getMinFree(), Eq(0U));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
@@ -0,0 +1,61 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/numa_topology.hpp"
+#include "iceoryx_posh/testing/mocks/numa_topology_mock.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+TEST(NumaTopology_test, SystemHasAtLeastOneNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "acf8a2ee-6036-45f3-a6cb-d692f8525330");
+    EXPECT_THAT(NumaTopology::getInstance().numberOfNodes(), Ge(1U));
+}
+
+TEST(NumaTopology_test, BindingToUnavailableNodeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e8a7ddc-0161-463a-9a66-24d0c4802e12");
+    auto& sut = NumaTopology::getInstance();
+    const auto unavailableNode = sut.numberOfNodes();
+    uint64_t memory{0U};
+
+    auto threadResult = sut.bindThreadMemoryToNode(unavailableNode);
+    auto memoryResult = sut.bindMemoryToNode(&memory, sizeof(memory), unavailableNode);
+
+    ASSERT_TRUE(threadResult.has_error());
+    EXPECT_THAT(threadResult.get_error(), Eq(NumaTopologyError::INVALID_NODE));
+    ASSERT_TRUE(memoryResult.has_error());
+    EXPECT_THAT(memoryResult.get_error(), Eq(NumaTopologyError::INVALID_NODE));
+}
+
+TEST(NumaTopology_test, FakeTopologyReplacesSystemTopologyWhileAlive)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e908bf46-d285-409e-866f-52f36dde0658");
+    auto& systemTopology = NumaTopology::getInstance();
+    {
+        FakeNumaTopology fakeTopology{4U};
+        EXPECT_THAT(&NumaTopology::getInstance(), Eq(&fakeTopology));
+        EXPECT_THAT(NumaTopology::getInstance().numberOfNodes(), Eq(4U));
+    }
+    EXPECT_THAT(&NumaTopology::getInstance(), Eq(&systemTopology));
+}
+
+} // namespace
@@ -23,6 +23,7 @@
 #include "iceoryx_platform/types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
+#include "iceoryx_posh/testing/mocks/numa_topology_mock.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
 #include "test.hpp"
@@ -92,6 +93,7 @@ class MePooSegment_test : public Test
         char memory[MEM_SIZE];
         int filehandle;
         static createFct createVerificator;
+        static SegmentMemoryOptions createdWithMemoryOptions;
     };
 
     class SharedMemoryObject_MOCKBuilder
@@ -108,9 +110,18 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::access_rights, permissions, iox::perms::none)
 
+        IOX_BUILDER_PARAMETER(bool, hugePages, false)
+
+        IOX_BUILDER_PARAMETER(bool, prefault, false)
+
+        IOX_BUILDER_PARAMETER(bool, lockInMemory, false)
+
       public:
         iox::expected<SharedMemoryObject_MOCK, SharedMemoryObjectError> create() noexcept
         {
+            SharedMemoryObject_MOCK::createdWithMemoryOptions.hugePages = m_hugePages;
+            SharedMemoryObject_MOCK::createdWithMemoryOptions.prefault = m_prefault;
+            SharedMemoryObject_MOCK::createdWithMemoryOptions.lockInMemory = m_lockInMemory;
             return iox::success<SharedMemoryObject_MOCK>(
                 SharedMemoryObject_MOCK(m_name,
                                         m_memorySizeInBytes,
@@ -142,6 +153,7 @@ class MePooSegment_test : public Test
     }
 };
 MePooSegment_test::SharedMemoryObject_MOCK::createFct MePooSegment_test::SharedMemoryObject_MOCK::createVerificator;
+SegmentMemoryOptions MePooSegment_test::SharedMemoryObject_MOCK::createdWithMemoryOptions;
 
 TEST_F(MePooSegment_test, SharedMemoryFileHandleRightsAfterConstructor)
 {
@@ -169,6 +181,80 @@ TEST_F(MePooSegment_test, SharedMemoryCreationParameter)
         MePooSegment_test::SharedMemoryObject_MOCK::createFct();
 }
 
+TEST_F(MePooSegment_test, SharedMemoryIsCreatedWithMemoryOptions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d4a61121-8de1-43e8-8efe-9d7d87c4a669");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SegmentMemoryOptions memoryOptions;
+    memoryOptions.hugePages = true;
+    memoryOptions.prefault = true;
+    memoryOptions.lockInMemory = true;
+    SUT sut{mepooConfig,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            iox::mepoo::MemoryInfo(),
+            memoryOptions};
+
+    EXPECT_TRUE(SharedMemoryObject_MOCK::createdWithMemoryOptions.hugePages);
+    EXPECT_TRUE(SharedMemoryObject_MOCK::createdWithMemoryOptions.prefault);
+    EXPECT_TRUE(SharedMemoryObject_MOCK::createdWithMemoryOptions.lockInMemory);
+}
+
+TEST_F(MePooSegment_test, SegmentWithNumaNodeIsBoundToTheNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "079daa79-56ae-447b-a7c2-be0f28294618");
+    FakeNumaTopology numaTopology{2U};
+    const auto group = PosixGroup::getGroupOfCurrentProcess();
+
+    SUT sut{mepooConfig, m_managementAllocator, group, group, MemoryInfo::numaNode(1U)};
+
+    EXPECT_THAT(numaTopology.threadBindings, ElementsAre(1U));
+    EXPECT_FALSE(numaTopology.isThreadMemoryBound);
+    ASSERT_THAT(numaTopology.memoryBindings.size(), Eq(1U));
+    EXPECT_THAT(numaTopology.memoryBindings[0U].node, Eq(1U));
+    EXPECT_THAT(numaTopology.memoryBindings[0U].size, Eq(MemoryManager::requiredChunkMemorySize(mepooConfig)));
+    EXPECT_THAT(sut.getMemoryInfo().getNumaNode(), Eq(1U));
+    EXPECT_THAT(sut.getSharedMemoryName(),
+                Eq(iox::ShmName_t(iox::TruncateToCapacity, (std::string(group.getName().c_str()) + "_numa1").c_str())));
+}
+
+TEST_F(MePooSegment_test, SegmentWithoutNumaNodeIsNotBound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65486ecb-951f-4136-bafd-f5559216d93e");
+    FakeNumaTopology numaTopology{2U};
+    const auto group = PosixGroup::getGroupOfCurrentProcess();
+
+    SUT sut{mepooConfig, m_managementAllocator, group, group};
+
+    EXPECT_TRUE(numaTopology.threadBindings.empty());
+    EXPECT_TRUE(numaTopology.memoryBindings.empty());
+    EXPECT_THAT(sut.getMemoryInfo().getNumaNode(), Eq(MemoryInfo::NO_NUMA_NODE));
+    EXPECT_THAT(sut.getSharedMemoryName(), Eq(iox::ShmName_t(iox::TruncateToCapacity, group.getName().c_str())));
+}
+
+TEST_F(MePooSegment_test, SegmentWithUnavailableNumaNodeIsNotBoundAndReportsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fbeb1619-b425-455f-9844-992a55a1533b");
+    FakeNumaTopology numaTopology{1U};
+    const auto group = PosixGroup::getGroupOfCurrentProcess();
+
+    iox::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::SEVERE));
+        });
+
+    SUT sut{mepooConfig, m_managementAllocator, group, group, MemoryInfo::numaNode(1U)};
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::MEPOO__SEGMENT_NUMA_NODE_NOT_AVAILABLE));
+    EXPECT_TRUE(numaTopology.threadBindings.empty());
+    EXPECT_TRUE(numaTopology.memoryBindings.empty());
+}
+
 TEST_F(MePooSegment_test, GetSharedMemoryObject)
 {
     ::testing::Test::RecordProperty("TEST_ID", "e1c12dd0-fd7d-4be3-918b-08d16a68c8e0");
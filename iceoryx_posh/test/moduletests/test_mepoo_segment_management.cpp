@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/mepoo/segment_config.hpp"
+#include "iceoryx_posh/testing/mocks/numa_topology_mock.hpp"
 #include "iox/bump_allocator.hpp"
 #include "test.hpp"
 
@@ -40,7 +41,8 @@ class MePooSegmentMock
                      iox::BumpAllocator& managementAllocator IOX_MAYBE_UNUSED,
                      const PosixGroup& readerGroup IOX_MAYBE_UNUSED,
                      const PosixGroup& writerGroup IOX_MAYBE_UNUSED,
-                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED) noexcept
+                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED,
+                     const SegmentMemoryOptions& memoryOptions IOX_MAYBE_UNUSED) noexcept
     {
     }
 };
@@ -90,6 +92,15 @@ class SegmentManager_test : public Test
         return config;
     }
 
+    SegmentConfig getSegmentConfigWithOneSegmentPerNumaNode()
+    {
+        SegmentConfig config;
+        auto group = PosixGroup::getGroupOfCurrentProcess().getName();
+        config.m_sharedMemorySegments.push_back({group, group, mepooConfig, MemoryInfo::numaNode(0U)});
+        config.m_sharedMemorySegments.push_back({group, group, mepooConfig, MemoryInfo::numaNode(1U)});
+        return config;
+    }
+
     static constexpr size_t MEM_SIZE{20000};
     char memory[MEM_SIZE];
     iox::BumpAllocator allocator{memory, MEM_SIZE};
@@ -201,6 +212,49 @@ TEST_F(SegmentManager_test, addingMoreThanOneWriterGroupFails)
     EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT));
 }
 
+TEST_F(SegmentManager_test, getSegmentMappingsWithOneWriteSegmentPerNumaNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2ffc212c-cf83-492b-92fc-04be1c2321ea");
+    FakeNumaTopology numaTopology{2U};
+    SegmentConfig segmentConfig = getSegmentConfigWithOneSegmentPerNumaNode();
+    SUT sut{segmentConfig, &allocator};
+
+    auto mapping = sut.getSegmentMappings(PosixUser::getUserOfCurrentProcess());
+
+    ASSERT_THAT(mapping.size(), Eq(2U));
+    const auto group = PosixGroup::getGroupOfCurrentProcess().getName();
+    for (uint32_t node = 0U; node < 2U; ++node)
+    {
+        EXPECT_TRUE(mapping[node].m_isWritable);
+        EXPECT_THAT(mapping[node].m_memoryInfo, Eq(MemoryInfo::numaNode(node)));
+        EXPECT_THAT(mapping[node].m_sharedMemoryName,
+                    Eq(iox::ShmName_t(iox::TruncateToCapacity,
+                                      (std::string(group.c_str()) + "_numa" + std::to_string(node)).c_str())));
+    }
+}
+
+TEST_F(SegmentManager_test, getMemoryManagerForUserWithNumaNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e5db3d1-a5db-4923-b23a-7b1c41bc85d7");
+    FakeNumaTopology numaTopology{2U};
+    SegmentConfig segmentConfig = getSegmentConfigWithOneSegmentPerNumaNode();
+    SUT sut{segmentConfig, &allocator};
+    auto user = PosixUser::getUserOfCurrentProcess();
+
+    auto defaultSegment = sut.getSegmentInformationWithWriteAccessForUser(user);
+    auto segmentOfNode0 = sut.getSegmentInformationWithWriteAccessForUser(user, MemoryInfo::numaNode(0U));
+    auto segmentOfNode1 = sut.getSegmentInformationWithWriteAccessForUser(user, MemoryInfo::numaNode(1U));
+    auto segmentOfNode2 = sut.getSegmentInformationWithWriteAccessForUser(user, MemoryInfo::numaNode(2U));
+
+    ASSERT_TRUE(defaultSegment.m_memoryManager.has_value());
+    ASSERT_TRUE(segmentOfNode0.m_memoryManager.has_value());
+    ASSERT_TRUE(segmentOfNode1.m_memoryManager.has_value());
+    EXPECT_FALSE(segmentOfNode2.m_memoryManager.has_value());
+    EXPECT_THAT(defaultSegment.m_segmentID, Eq(segmentOfNode0.m_segmentID));
+    EXPECT_THAT(segmentOfNode1.m_segmentID, Ne(segmentOfNode0.m_segmentID));
+    EXPECT_THAT(&segmentOfNode1.m_memoryManager.value().get(), Ne(&segmentOfNode0.m_memoryManager.value().get()));
+}
+
 TEST_F(SegmentManager_test, addingMaximumNumberOfSegmentsWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "79db009a-da1a-4140-b375-f174af615d54");
@@ -91,6 +91,7 @@ class ChunkDistributor_test : public Test
     struct ChunkQueueConfig
     {
         static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_NUMBER_QUEUES;
+        static constexpr bool HAS_SINGLE_PRODUCER = false;
     };
 
     using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, PolicyType>;
@@ -114,12 +115,14 @@ class ChunkDistributor_test : public Test
     }
 
     std::shared_ptr<ChunkDistributorData_t>
-    getChunkDistributorData(const ConsumerTooSlowPolicy policy = ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    getChunkDistributorData(const ConsumerTooSlowPolicy policy = ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                            const iox::units::Duration consumerTooSlowTimeout = iox::units::Duration::max())
     {
-        return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE);
+        return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE, consumerTooSlowTimeout);
     }
 
     static constexpr std::chrono::milliseconds BLOCKING_DURATION{100};
+    static constexpr iox::units::Duration BLOCKING_TIMEOUT{100_ms};
 
     static constexpr iox::units::Duration DEADLOCK_TIMEOUT{2_s};
     Watchdog deadlockWatchdog{DEADLOCK_TIMEOUT};
@@ -127,6 +130,8 @@ class ChunkDistributor_test : public Test
 template <typename PolicyType>
 constexpr std::chrono::milliseconds ChunkDistributor_test<PolicyType>::BLOCKING_DURATION;
 template <typename PolicyType>
+constexpr iox::units::Duration ChunkDistributor_test<PolicyType>::BLOCKING_TIMEOUT;
+template <typename PolicyType>
 constexpr iox::units::Duration ChunkDistributor_test<PolicyType>::DEADLOCK_TIMEOUT;
 
 TYPED_TEST(ChunkDistributor_test, AddingNullptrQueueDoesNotWork)
@@ -823,4 +828,304 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, RemovingBlockingQueueUnblocksDelivery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b24be865-093a-40da-93ff-737e2d0c3e06");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(73U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(37U)), Eq(0U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(73U));
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesDropsChunkForBlockingQueueAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0d1b3a6-52c1-4b52-9d63-2a0f6cf1c8a4");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, this->BLOCKING_TIMEOUT);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(13U)), Eq(1U));
+    EXPECT_FALSE(queue.hasLostChunks());
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(31U)), Eq(0U));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(elapsed, Ge(std::chrono::nanoseconds(this->BLOCKING_TIMEOUT.toNanoseconds())));
+    EXPECT_TRUE(queue.hasLostChunks());
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(13U));
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesDeliversAllChunksInOrderToAllQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a483ae4e-bed1-4e24-bbf5-657e5a21dbe4");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{5U};
+    iox::vector<SharedChunk, NUMBER_OF_CHUNKS> chunks;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i * 17U));
+    }
+
+    EXPECT_THAT(sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks.begin(), chunks.size())),
+                Eq(2U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+
+    for (auto& queueData : {queueData1, queueData2})
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+        ASSERT_THAT(queue.size(), Eq(NUMBER_OF_CHUNKS));
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i * 17U));
+        }
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesWithoutQueuesAddsChunksToHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6549923c-3c25-4f5d-953b-ab217696ca04");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    iox::vector<SharedChunk, NUMBER_OF_CHUNKS> chunks;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+
+    EXPECT_THAT(sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks.begin(), chunks.size())),
+                Eq(0U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesDropsRemainingChunksForBlockingQueueAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2ee0dce8-ee7e-4c62-a9ed-6055d0c9ccb5");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, this->BLOCKING_TIMEOUT);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(2U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{4U};
+    iox::vector<SharedChunk, NUMBER_OF_CHUNKS> chunks;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_THAT(sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks.begin(), chunks.size())),
+                Eq(0U));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(elapsed, Ge(std::chrono::nanoseconds(this->BLOCKING_TIMEOUT.toNanoseconds())));
+    EXPECT_TRUE(queue.hasLostChunks());
+
+    for (uint64_t i = 0U; i < 2U; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueDropsChunkForBlockingQueueAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a5c2b8e-8b0b-4f0e-bf53-0b6f6f3d0d27");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, this->BLOCKING_TIMEOUT);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(7U)).has_error());
+    EXPECT_FALSE(queue.hasLostChunks());
+
+    ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(8U)).has_error());
+    EXPECT_TRUE(queue.hasLostChunks());
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(7U));
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueBlocksUntilConsumerTakesChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c4f1f7e-6f43-4b53-8a41-0d94e0f7c3f2");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(21U)).has_error());
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        EXPECT_FALSE(
+            sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(12U)).has_error());
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(21U));
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(12U));
+    EXPECT_FALSE(queue.hasLostChunks());
+}
+
+TYPED_TEST(ChunkDistributor_test, ConcurrentAddingRemovingAndDeliveringKeepsQueuesConsistent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aae03b6d-2df1-4a9b-aa78-ba0f58ea8847");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{10000U};
+    constexpr uint64_t NUMBER_OF_TOGGLED_QUEUES{8U};
+    constexpr uint64_t QUEUE_CAPACITY{4U};
+
+    auto stableQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> stableQueue(stableQueueData.get());
+    stableQueue.setCapacity(QUEUE_CAPACITY);
+    ASSERT_FALSE(sut.tryAddQueue(stableQueueData.get()).has_error());
+
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> toggledQueueDatas;
+    for (uint64_t i = 0U; i < NUMBER_OF_TOGGLED_QUEUES; ++i)
+    {
+        toggledQueueDatas.emplace_back(this->getChunkQueueData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(toggledQueueDatas.back().get())
+            .setCapacity(QUEUE_CAPACITY);
+    }
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool isDeliveryFinished{false};
+    std::thread addingAndRemovingThread([&] {
+        isThreadStarted.notify();
+        while (!isDeliveryFinished.load())
+        {
+            for (auto& queueData : toggledQueueDatas)
+            {
+                EXPECT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+            }
+            for (auto& queueData : toggledQueueDatas)
+            {
+                EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+            }
+        }
+    });
+
+    isThreadStarted.wait();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(i)), Ge(1U));
+    }
+
+    isDeliveryFinished = true;
+    addingAndRemovingThread.join();
+
+    EXPECT_FALSE(sut.tryRemoveQueue(stableQueueData.get()).has_error());
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+
+    for (uint64_t i = NUMBER_OF_CHUNKS - QUEUE_CAPACITY; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = stableQueue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+    EXPECT_THAT(stableQueue.tryPop().has_value(), Eq(false));
+
+    for (auto& queueData : toggledQueueDatas)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> toggledQueue(queueData.get());
+        std::vector<uint64_t> values;
+        for (auto maybeSharedChunk = toggledQueue.tryPop(); maybeSharedChunk.has_value();
+             maybeSharedChunk = toggledQueue.tryPop())
+        {
+            values.emplace_back(this->getSharedChunkValue(*maybeSharedChunk));
+        }
+        EXPECT_TRUE(std::adjacent_find(values.begin(), values.end(), std::greater_equal<uint64_t>()) == values.end());
+    }
+
+    sut.clearHistory();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
 } // namespace
@@ -28,6 +28,9 @@
 
 #include "test.hpp"
 
+#include <future>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -71,10 +74,20 @@ class ChunkQueue_testBase
     static constexpr uint32_t RESIZED_CAPACITY{5U};
 };
 
-template <typename PolicyType, iox::cxx::VariantQueueTypes VariantQueueType>
+/// @brief uses the SpscRing instead of the VariantQueue
+struct SingleProducerChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = iox::MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    static constexpr bool HAS_SINGLE_PRODUCER = true;
+};
+
+template <typename PolicyType,
+          iox::cxx::VariantQueueTypes VariantQueueType,
+          typename ChunkQueueConfig = iox::DefaultChunkQueueConfig>
 struct TypeDefinitions
 {
     using PolicyType_t = PolicyType;
+    using ChunkQueueConfig_t = ChunkQueueConfig;
     static const iox::cxx::VariantQueueTypes variantQueueType{VariantQueueType};
 };
 
@@ -82,7 +95,13 @@ using ChunkQueueSubjects =
     Types<TypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
           TypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
           TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
-          TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>>;
+          TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
+          TypeDefinitions<ThreadSafePolicy,
+                          iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
+                          SingleProducerChunkQueueConfig>,
+          TypeDefinitions<ThreadSafePolicy,
+                          iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                          SingleProducerChunkQueueConfig>>;
 
 TYPED_TEST_SUITE(ChunkQueue_test, ChunkQueueSubjects, );
 
@@ -93,7 +112,8 @@ class ChunkQueue_test : public Test, public ChunkQueue_testBase
     void SetUp() override{};
     void TearDown() override{};
 
-    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, typename TestTypes::PolicyType_t>;
+    using ChunkQueueData_t =
+        ChunkQueueData<typename TestTypes::ChunkQueueConfig_t, typename TestTypes::PolicyType_t>;
 
     iox::cxx::VariantQueueTypes m_variantQueueType{TestTypes::variantQueueType};
     ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA, m_variantQueueType};
@@ -243,6 +263,41 @@ TYPED_TEST(ChunkQueue_test, PushAndNotifyConditionVariable)
     EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true)); // shouldn't trigger a second time
 }
 
+TYPED_TEST(ChunkQueue_test, DetachConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ebf9a003-4d36-461a-aa6f-ba21e77f3198");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+    this->m_popper.unsetConditionVariable();
+
+    EXPECT_THAT(this->m_popper.isConditionVariableSet(), Eq(false));
+
+    this->m_pusher.push(this->allocateChunk());
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, PushWithoutConditionVariableDoesNotAcquireTheQueueLock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c969867-ce53-49b7-a378-d47e4e7fa24b");
+    std::promise<void> pushPromise;
+    auto pushFuture = pushPromise.get_future();
+
+    this->m_chunkData.lock();
+    std::thread pusher([&] {
+        this->m_pusher.push(this->allocateChunk());
+        pushPromise.set_value();
+    });
+
+    EXPECT_THAT(pushFuture.wait_for(std::chrono::seconds(5)), Eq(std::future_status::ready));
+    this->m_chunkData.unlock();
+    pusher.join();
+
+    EXPECT_THAT(this->m_popper.size(), Eq(1U));
+}
+
 TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "3e55346f-62e1-44bb-bfe8-cef929935edf");
@@ -264,22 +319,96 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
-/// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
-using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
+TYPED_TEST(ChunkQueue_test, PushedBatchMustBeTakenInTheSameOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9ef40c76-8d15-47da-a137-cfa0e3c4b1a2");
+    constexpr int32_t NUMBER_CHUNKS{5};
+    iox::vector<SharedChunk, NUMBER_CHUNKS> chunks;
+    for (int i = 0; i < NUMBER_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk());
+        *reinterpret_cast<int32_t*>(chunks.back().getUserPayload()) = i;
+    }
+
+    EXPECT_THAT(this->m_pusher.push(iox::span<const SharedChunk>(chunks.begin(), chunks.size()), false),
+                Eq(NUMBER_CHUNKS));
+
+    iox::vector<SharedChunk, iox::MAX_SUBSCRIBER_QUEUE_CAPACITY> takenChunks;
+    ASSERT_THAT(this->m_popper.takeAll(takenChunks), Eq(NUMBER_CHUNKS));
+    ASSERT_THAT(takenChunks.size(), Eq(NUMBER_CHUNKS));
+    for (int i = 0; i < NUMBER_CHUNKS; ++i)
+    {
+        EXPECT_THAT(*reinterpret_cast<int32_t*>(takenChunks[i].getUserPayload()), Eq(i));
+    }
+    EXPECT_THAT(this->m_popper.empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, TakeAllStopsWhenTheContainerIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64211a89-bf41-4708-a87d-cb049a4c3c26");
+    constexpr uint64_t NUMBER_CHUNKS{5U};
+    constexpr uint64_t CONTAINER_CAPACITY{3U};
+    for (uint64_t i = 0U; i < NUMBER_CHUNKS; ++i)
+    {
+        this->m_pusher.push(this->allocateChunk());
+    }
+
+    iox::vector<SharedChunk, CONTAINER_CAPACITY> takenChunks;
+    EXPECT_THAT(this->m_popper.takeAll(takenChunks), Eq(CONTAINER_CAPACITY));
+    EXPECT_THAT(this->m_popper.takeAll(takenChunks), Eq(0U));
+    takenChunks.clear();
+    EXPECT_THAT(this->m_popper.takeAll(takenChunks), Eq(NUMBER_CHUNKS - CONTAINER_CAPACITY));
+    EXPECT_THAT(this->m_popper.empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, TakeAllOnEmptyQueueTakesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1684ad6-c283-46fc-8214-aa85a3a80c86");
+    iox::vector<SharedChunk, iox::MAX_SUBSCRIBER_QUEUE_CAPACITY> takenChunks;
+    EXPECT_THAT(this->m_popper.takeAll(takenChunks), Eq(0U));
+    EXPECT_THAT(takenChunks.empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, PushBatchNotifiesConditionVariableOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b06a811e-e9df-497a-b1f3-e33869388040");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    constexpr uint64_t NUMBER_CHUNKS{5U};
+    iox::vector<SharedChunk, NUMBER_CHUNKS> chunks;
+    for (uint64_t i = 0U; i < NUMBER_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk());
+    }
+    this->m_pusher.push(iox::span<const SharedChunk>(chunks.begin(), chunks.size()), false);
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true)); // shouldn't trigger a second time
+}
+
+using ChunkQueueFiFoTestSubjects =
+    Types<TypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
+          TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
+          TypeDefinitions<ThreadSafePolicy,
+                          iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
+                          SingleProducerChunkQueueConfig>>;
 
 TYPED_TEST_SUITE(ChunkQueueFiFo_test, ChunkQueueFiFoTestSubjects, );
 
-template <typename PolicyType>
+template <typename TestTypes>
 class ChunkQueueFiFo_test : public Test, public ChunkQueue_testBase
 {
   public:
     void SetUp() override{};
     void TearDown() override{};
 
-    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, PolicyType>;
+    using ChunkQueueData_t =
+        ChunkQueueData<typename TestTypes::ChunkQueueConfig_t, typename TestTypes::PolicyType_t>;
 
-    ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA,
-                                 iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA, TestTypes::variantQueueType};
     ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
     ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
 };
@@ -328,22 +457,77 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
-/// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
-using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
+TYPED_TEST(ChunkQueueFiFo_test, PushBatchWithStopAtOverflowStopsAtFirstChunkWhichDoesNotFit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94665d5d-acd3-444d-962c-ce0e70721ba6");
+    constexpr uint64_t NUMBER_OF_FREE_SLOTS{2U};
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY - NUMBER_OF_FREE_SLOTS; ++i)
+    {
+        EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+
+    constexpr uint64_t NUMBER_CHUNKS{4U};
+    iox::vector<SharedChunk, NUMBER_CHUNKS> chunks;
+    for (uint64_t i = 0U; i < NUMBER_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk());
+    }
+
+    EXPECT_THAT(this->m_pusher.push(iox::span<const SharedChunk>(chunks.begin(), chunks.size()), true),
+                Eq(NUMBER_OF_FREE_SLOTS));
+    EXPECT_FALSE(this->m_popper.hasLostChunks());
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PushBatchWithoutStopAtOverflowReportsLostChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0119f76f-747d-471a-9c2b-73a98cf303fa");
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY - 1U; ++i)
+    {
+        EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+
+    {
+        constexpr uint64_t NUMBER_CHUNKS{3U};
+        iox::vector<SharedChunk, NUMBER_CHUNKS> chunks;
+        for (uint64_t i = 0U; i < NUMBER_CHUNKS; ++i)
+        {
+            chunks.emplace_back(this->allocateChunk());
+        }
+
+        EXPECT_THAT(this->m_pusher.push(iox::span<const SharedChunk>(chunks.begin(), chunks.size()), false),
+                    Eq(NUMBER_CHUNKS));
+    }
+    EXPECT_TRUE(this->m_popper.hasLostChunks());
+
+    // get all the chunks in the queue
+    while (this->m_popper.tryPop().has_value())
+    {
+    }
+
+    // all chunks must be released
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+using ChunkQueueSoFiSubjects =
+    Types<TypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
+          TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
+          TypeDefinitions<ThreadSafePolicy,
+                          iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                          SingleProducerChunkQueueConfig>>;
 
 TYPED_TEST_SUITE(ChunkQueueSoFi_test, ChunkQueueSoFiSubjects, );
 
-template <typename PolicyType>
+template <typename TestTypes>
 class ChunkQueueSoFi_test : public Test, public ChunkQueue_testBase
 {
   public:
     void SetUp() override{};
     void TearDown() override{};
 
-    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, PolicyType>;
+    using ChunkQueueData_t =
+        ChunkQueueData<typename TestTypes::ChunkQueueConfig_t, typename TestTypes::PolicyType_t>;
 
-    ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA,
-                                 iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer};
+    ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA, TestTypes::variantQueueType};
     ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
     ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
 };
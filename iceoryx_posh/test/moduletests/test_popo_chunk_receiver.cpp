@@ -210,6 +210,41 @@ TEST_F(ChunkReceiver_test, releaseInvalidChunk)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
 }
 
+TEST_F(ChunkReceiver_test, TakingAChunkWithSendTimestampRecordsTheLatency)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8c92304-dd9d-4fb3-8919-bbd5a0ccaf13");
+    const uint64_t sendTimestamp = iox::popo::LatencyHistogram::currentTimestamp();
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        sharedChunk.setSendTimestamp(sendTimestamp);
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    const uint64_t latencyUpperLimit = iox::popo::LatencyHistogram::currentTimestamp() - sendTimestamp;
+    m_chunkReceiver.release(*maybeChunkHeader);
+
+    iox::popo::LatencyHistogramSnapshot snapshot;
+    m_chunkReceiverData.m_latencyHistogram.collect(snapshot);
+    EXPECT_THAT(snapshot.numberOfSamples(), Eq(1U));
+    EXPECT_THAT(snapshot.maxLatency(), Le(latencyUpperLimit));
+}
+
+TEST_F(ChunkReceiver_test, TakingAChunkWithoutSendTimestampDoesNotRecordALatency)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b0094d40-5b09-4ad0-ad2e-09bd08fec1ab");
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkReceiver.release(*maybeChunkHeader);
+
+    iox::popo::LatencyHistogramSnapshot snapshot;
+    m_chunkReceiverData.m_latencyHistogram.collect(snapshot);
+    EXPECT_THAT(snapshot.numberOfSamples(), Eq(0U));
+}
+
 TEST_F(ChunkReceiver_test, Cleanup)
 {
     ::testing::Test::RecordProperty("TEST_ID", "36ed48ca-21e6-4075-b439-6353a1773733");
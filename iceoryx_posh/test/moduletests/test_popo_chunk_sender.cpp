@@ -28,13 +28,17 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
+#include "iceoryx_posh/mepoo/chunk_chain.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/scope_guard.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -94,6 +98,7 @@ class ChunkSender_test : public Test
     struct ChunkQueueConfig
     {
         static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL;
+        static constexpr bool HAS_SINGLE_PRODUCER = false;
     };
 
     using ChunkQueueData_t = iox::popo::ChunkQueueData<ChunkQueueConfig, iox::popo::ThreadSafePolicy>;
@@ -394,6 +399,60 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendBatchWithReceiverDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "527f5d7b-7c47-47c6-9938-0914b567a2eb");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{4U};
+    iox::vector<iox::mepoo::ChunkHeader*, NUMBER_OF_CHUNKS> chunkHeaders;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        auto sample = new ((*maybeChunkHeader)->userPayload()) DummySample();
+        sample->dummy = i;
+        chunkHeaders.emplace_back(*maybeChunkHeader);
+    }
+
+    auto numberOfDeliveries =
+        m_chunkSender.sendBatch(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    EXPECT_THAT(myQueue.size(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(reinterpret_cast<DummySample*>(popRet->getUserPayload())->dummy, Eq(i));
+    }
+}
+
+TEST_F(ChunkSender_test, sendBatchWithInvalidChunkTriggersTheErrorHandlerAndSendsTheValidChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9ab6b6f9-56ac-4bed-b63b-aaee7b33e4f3");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    ChunkMock<bool> myCrazyChunk;
+    iox::mepoo::ChunkHeader* chunkHeaders[] = {*maybeChunkHeader, myCrazyChunk.chunkHeader()};
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&errorHandlerCalled](const iox::PoshError, const iox::ErrorLevel) { errorHandlerCalled = true; });
+
+    EXPECT_THAT(m_chunkSender.sendBatch(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders, 2U)), Eq(1U));
+
+    EXPECT_TRUE(errorHandlerCalled);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    EXPECT_THAT(myQueue.size(), Eq(1U));
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b951495a-e216-43ff-96a0-a530b7a6455b");
@@ -725,6 +784,319 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, allocateWithChunkMagazineReservesChunksWithMagazineCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "df6a3b1c-92f4-4349-804e-04ddeab554fa");
+    constexpr uint32_t CHUNK_MAGAZINE_CAPACITY{8U};
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      iox::units::Duration::max(),
+                                      CHUNK_MAGAZINE_CAPACITY};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+
+    auto maybeChunkHeader = sut.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_MAGAZINE_CAPACITY));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_cachedChunks, Eq(CHUNK_MAGAZINE_CAPACITY));
+
+    sut.release(maybeChunkHeader.value());
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_MAGAZINE_CAPACITY - 1U));
+}
+
+TEST_F(ChunkSender_test, ReleaseAllReturnsTheChunksOfTheChunkMagazine)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61e19b0b-0e27-454d-8efe-0408a819d933");
+    constexpr uint32_t CHUNK_MAGAZINE_CAPACITY{3U};
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      iox::units::Duration::max(),
+                                      CHUNK_MAGAZINE_CAPACITY};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+
+    for (uint32_t i = 0U; i < CHUNK_MAGAZINE_CAPACITY + 1U; ++i)
+    {
+        ASSERT_FALSE(sut.tryAllocate(UniquePortId(),
+                                     sizeof(DummySample),
+                                     alignof(DummySample),
+                                     USER_HEADER_SIZE,
+                                     USER_HEADER_ALIGNMENT)
+                         .has_error());
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2U * CHUNK_MAGAZINE_CAPACITY));
+
+    sut.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_cachedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, sendWithStampSendTimeStampsTheChunkWithTheSendTime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8d1aa27-a72a-4209-8754-1ed56e01decc");
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      iox::units::Duration::max(),
+                                      0U,
+                                      true};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+    ASSERT_FALSE(sut.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = sut.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    const uint64_t timestampBeforeSend = iox::popo::LatencyHistogram::currentTimestamp();
+    sut.send(*maybeChunkHeader);
+    const uint64_t timestampAfterSend = iox::popo::LatencyHistogram::currentTimestamp();
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getSendTimestamp(), AllOf(Ge(timestampBeforeSend), Le(timestampAfterSend)));
+}
+
+TEST_F(ChunkSender_test, sendWithoutStampSendTimeDoesNotStampTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d26fe69-f40a-4e5f-b1a9-56a3160c975d");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkSender.send(*maybeChunkHeader);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getSendTimestamp(), Eq(0U));
+}
+
+TEST_F(ChunkSender_test, allocateChainOccupiesOneChunkPerLinkAndSetsTheOriginIdOfTheFirstLink)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb3f2dac-f272-4a32-815c-e8af3d285a0d");
+    const UniquePortId originId;
+    constexpr uint64_t CHAIN_PAYLOAD_SIZE{3U * SMALL_CHUNK + 10U};
+
+    auto maybeChunkHeader =
+        m_chunkSender.tryAllocateChain(originId, CHAIN_PAYLOAD_SIZE, SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->originId(), Eq(originId));
+    auto chain = iox::mepoo::ChunkChain::fromUserPayload((*maybeChunkHeader)->userPayload());
+    ASSERT_TRUE(chain.has_value());
+    EXPECT_THAT(chain->size(), Eq(CHAIN_PAYLOAD_SIZE));
+    // the links with a full user-payload need a big chunk due to the ChunkChainHeader, the last link a small one
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(3U));
+}
+
+TEST_F(ChunkSender_test, allocateChainWithInvalidSizesFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2fe70e69-90e6-497a-9aa9-fb8758a3bc0d");
+    auto withoutChainPayload = m_chunkSender.tryAllocateChain(UniquePortId(), 0U, SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT);
+    auto withoutLinkPayload = m_chunkSender.tryAllocateChain(UniquePortId(), SMALL_CHUNK, 0U, USER_PAYLOAD_ALIGNMENT);
+    auto withTooManyLinks = m_chunkSender.tryAllocateChain(
+        UniquePortId(), std::numeric_limits<uint64_t>::max(), 1U, USER_PAYLOAD_ALIGNMENT);
+
+    ASSERT_TRUE(withoutChainPayload.has_error());
+    EXPECT_THAT(withoutChainPayload.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+    ASSERT_TRUE(withoutLinkPayload.has_error());
+    EXPECT_THAT(withoutLinkPayload.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+    ASSERT_TRUE(withTooManyLinks.has_error());
+    EXPECT_THAT(withTooManyLinks.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, releaseChainReturnsAllLinks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f82d41b-7a00-4183-8ea0-69d04eb4c61d");
+    auto maybeChunkHeader =
+        m_chunkSender.tryAllocateChain(UniquePortId(), 4U * SMALL_CHUNK, SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    m_chunkSender.release(*maybeChunkHeader);
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, sendChainDeliversTheWholeChainWithTheFirstLink)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d37dfe2-878d-48bc-980a-09761e1816ac");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    constexpr uint64_t CHAIN_PAYLOAD_SIZE{2U * SMALL_CHUNK + 1U};
+    auto maybeChunkHeader =
+        m_chunkSender.tryAllocateChain(UniquePortId(), CHAIN_PAYLOAD_SIZE, SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto loanedChain = iox::mepoo::ChunkChain::fromUserPayload((*maybeChunkHeader)->userPayload());
+    ASSERT_TRUE(loanedChain.has_value());
+    uint8_t value{0U};
+    for (auto link : *loanedChain)
+    {
+        std::fill(link.begin(), link.end(), ++value);
+    }
+
+    EXPECT_THAT(m_chunkSender.send(*maybeChunkHeader), Eq(1U));
+
+    {
+        iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        const void* userPayload = popRet->getUserPayload();
+        auto chain = iox::mepoo::ConstChunkChain::fromUserPayload(userPayload);
+        ASSERT_TRUE(chain.has_value());
+        std::vector<uint8_t> firstBytes;
+        for (auto link : *chain)
+        {
+            firstBytes.push_back(link[0]);
+        }
+        EXPECT_THAT(firstBytes, ElementsAre(1U, 2U, 3U));
+    }
+
+    // the last chunk is still referenced by the sender
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(2U));
+}
+
+TEST_F(ChunkSender_test, FirstLinkOfASentChainIsNotReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e026afa5-4023-4656-b901-a6bf24908c0e");
+    auto maybeChainHeader =
+        m_chunkSender.tryAllocateChain(UniquePortId(), 2U * SMALL_CHUNK, SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(maybeChainHeader.has_error());
+    EXPECT_THAT(m_chunkSender.send(*maybeChainHeader), Eq(0U));
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(*maybeChunkHeader, Ne(*maybeChainHeader));
+    EXPECT_THAT((*maybeChunkHeader)->userHeaderId(), Eq(iox::mepoo::ChunkHeader::NO_USER_HEADER));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSender_test, resizeToASmallerSizeKeepsTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "644d1a91-f847-4555-bf7a-5d15759a6b2f");
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), BIG_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    auto maybeResizedChunkHeader = m_chunkSender.tryResize(*maybeChunkHeader, SMALL_CHUNK / 2);
+
+    ASSERT_FALSE(maybeResizedChunkHeader.has_error());
+    EXPECT_THAT(*maybeResizedChunkHeader, Eq(*maybeChunkHeader));
+    EXPECT_THAT((*maybeResizedChunkHeader)->userPayloadSize(), Eq(SMALL_CHUNK / 2));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSender_test, resizeToALargerSizeWhichFitsIntoTheChunkKeepsTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1583570e-74ab-44cf-9c86-9d5b6b33a83f");
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), SMALL_CHUNK / 2, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    auto maybeResizedChunkHeader = m_chunkSender.tryResize(*maybeChunkHeader, SMALL_CHUNK);
+
+    ASSERT_FALSE(maybeResizedChunkHeader.has_error());
+    EXPECT_THAT(*maybeResizedChunkHeader, Eq(*maybeChunkHeader));
+    EXPECT_THAT((*maybeResizedChunkHeader)->userPayloadSize(), Eq(SMALL_CHUNK));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSender_test, resizeBeyondTheChunkMovesTheUserHeaderAndUserPayloadToALargerChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ac78f5d5-9809-4831-9df7-66ad41fb1936");
+    constexpr uint32_t USER_PAYLOAD_SIZE{SMALL_CHUNK / 2};
+    const UniquePortId originId;
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        originId, USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    *static_cast<uint64_t*>((*maybeChunkHeader)->userHeader()) = 0xC0FFEE;
+    auto userPayload = static_cast<uint8_t*>((*maybeChunkHeader)->userPayload());
+    for (uint32_t i = 0U; i < USER_PAYLOAD_SIZE; ++i)
+    {
+        userPayload[i] = static_cast<uint8_t>(i);
+    }
+
+    auto maybeResizedChunkHeader = m_chunkSender.tryResize(*maybeChunkHeader, BIG_CHUNK / 2 + SMALL_CHUNK / 4);
+
+    ASSERT_FALSE(maybeResizedChunkHeader.has_error());
+    auto resizedChunkHeader = *maybeResizedChunkHeader;
+    EXPECT_THAT(resizedChunkHeader, Ne(*maybeChunkHeader));
+    EXPECT_THAT(resizedChunkHeader->originId(), Eq(originId));
+    EXPECT_THAT(resizedChunkHeader->userPayloadSize(), Eq(BIG_CHUNK / 2 + SMALL_CHUNK / 4));
+    EXPECT_THAT(*static_cast<uint64_t*>(resizedChunkHeader->userHeader()), Eq(0xC0FFEEU));
+    auto resizedUserPayload = static_cast<uint8_t*>(resizedChunkHeader->userPayload());
+    EXPECT_TRUE(std::equal(resizedUserPayload, resizedUserPayload + USER_PAYLOAD_SIZE, userPayload));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(1U));
+
+    m_chunkSender.release(resizedChunkHeader);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, resizeBeyondTheLargestMempoolFailsAndKeepsTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "33b962af-0f55-4022-ae7a-04c3af055e7a");
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+
+    auto maybeResizedChunkHeader = m_chunkSender.tryResize(*maybeChunkHeader, 2U * BIG_CHUNK);
+
+    ASSERT_TRUE(maybeResizedChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->userPayloadSize(), Eq(SMALL_CHUNK));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    m_chunkSender.release(*maybeChunkHeader);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, resizeOfAChunkWhichIsNotInUseTriggersTheErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6214b766-e9a7-417b-b5f0-aa210792a4c2");
+    iox::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    ChunkMock<bool> myCrazyChunk;
+    auto maybeResizedChunkHeader = m_chunkSender.tryResize(myCrazyChunk.chunkHeader(), SMALL_CHUNK);
+
+    EXPECT_TRUE(maybeResizedChunkHeader.has_error());
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_RESIZE_FROM_USER));
+}
+
+TEST_F(ChunkSender_test, resizeOfAChainFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "08df2709-b147-4f23-ae04-af491f7cfd2d");
+    auto maybeChainHeader =
+        m_chunkSender.tryAllocateChain(UniquePortId(), 2U * SMALL_CHUNK, SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(maybeChainHeader.has_error());
+
+    auto maybeResizedChunkHeader = m_chunkSender.tryResize(*maybeChainHeader, SMALL_CHUNK / 2);
+
+    ASSERT_TRUE(maybeResizedChunkHeader.has_error());
+    EXPECT_THAT(maybeResizedChunkHeader.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+    EXPECT_THAT(iox::mepoo::ChunkChain::fromUserPayload((*maybeChainHeader)->userPayload())->size(),
+                Eq(2U * SMALL_CHUNK));
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
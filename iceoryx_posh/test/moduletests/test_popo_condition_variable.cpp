@@ -135,9 +135,9 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER; i++)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(sut.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -150,9 +150,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER; i++)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -166,15 +166,66 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     }
 }
 
+TEST_F(ConditionVariable_test, NotifyDoesNotPostSemaphoreWhenNoListenerIsWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f6ae94b3-3b38-4de9-9b2b-8775d7c8c809");
+    m_signaler.notify();
+
+    EXPECT_TRUE(m_condVarData.isNotificationActive(0U));
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, NotifyPostsSemaphoreWhenListenerIsWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4db7bb24-5ff5-4f51-b2b3-9a1f8716f553");
+    m_condVarData.m_numberOfWaiters.store(1U);
+    m_signaler.notify();
+
+    EXPECT_TRUE(m_condVarData.m_semaphore->tryWait().value());
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, RepeatedNotifyOfPendingNotificationPostsSemaphoreOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8591004-616b-4e2e-80c5-f3101edac4b1");
+    m_condVarData.m_numberOfWaiters.store(1U);
+    m_signaler.notify();
+    m_signaler.notify();
+    m_signaler.notify();
+
+    EXPECT_TRUE(m_condVarData.m_semaphore->tryWait().value());
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, NotifyOfIndicesInDifferentWordsIsCollectedInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9780927f-5bd6-44f0-973b-b2f426225db2");
+    constexpr Type_t LAST_EVENT_INDEX = iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER - 1U;
+    constexpr Type_t WORD_BOUNDARY_INDEX = ConditionVariableData::NOTIFICATIONS_PER_WORD;
+    ConditionNotifier(m_condVarData, LAST_EVENT_INDEX).notify();
+    ConditionNotifier(m_condVarData, WORD_BOUNDARY_INDEX).notify();
+    ConditionNotifier(m_condVarData, WORD_BOUNDARY_INDEX - 1U).notify();
+    ConditionNotifier(m_condVarData, 0U).notify();
+
+    auto activeNotifications = m_waiter.timedWait(m_timingTestTime);
+
+    ASSERT_THAT(activeNotifications.size(), Eq(4U));
+    EXPECT_THAT(activeNotifications[0], Eq(0U));
+    EXPECT_THAT(activeNotifications[1], Eq(WORD_BOUNDARY_INDEX - 1U));
+    EXPECT_THAT(activeNotifications[2], Eq(WORD_BOUNDARY_INDEX));
+    EXPECT_THAT(activeNotifications[3], Eq(LAST_EVENT_INDEX));
+    EXPECT_FALSE(m_waiter.wasNotified());
+}
+
 TEST_F(ConditionVariable_test, TimedWaitWithZeroTimeoutWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "582f0b1c-c717-410e-8143-61459db672ad");
@@ -313,6 +364,101 @@ TEST_F(ConditionVariable_test, DestroyWakesUpWaitWhichReturnsEmptyVector)
     waiter.join();
 }
 
+void spinningWaitReturnsNotificationWhichArrivesWhileWaiting(ConditionVariable_test& test,
+                                                             const WaitStrategy waitStrategy)
+{
+    ConditionListener sut(test.m_condVarData, waitStrategy);
+    constexpr uint64_t EVENT_INDEX{7U};
+
+    ConditionVariable_test::NotificationVector_t activeNotifications;
+    std::thread waiter([&] { activeNotifications = sut.wait(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    test.m_notifiers[EVENT_INDEX].notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(EVENT_INDEX));
+}
+
+TEST_F(ConditionVariable_test, SpinningWaitReturnsNotificationWhichArrivesWhileWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f27ebd85-f224-40a5-9248-c315e2db5a4e");
+    spinningWaitReturnsNotificationWhichArrivesWhileWaiting(*this, WaitStrategy{WaitStrategyType::SPIN, 0U});
+}
+
+TEST_F(ConditionVariable_test, SpinThenYieldWaitReturnsNotificationWhichArrivesWhileWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab847373-56ea-4b52-b4b3-1f7c86b63968");
+    spinningWaitReturnsNotificationWhichArrivesWhileWaiting(*this,
+                                                            WaitStrategy{WaitStrategyType::SPIN_THEN_YIELD, 100U});
+}
+
+TEST_F(ConditionVariable_test, SpinThenBlockWaitReturnsNotificationWhichArrivesWhileWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3fe53199-8ff4-41f3-b811-ffe2d7be4571");
+    spinningWaitReturnsNotificationWhichArrivesWhileWaiting(*this,
+                                                            WaitStrategy{WaitStrategyType::SPIN_THEN_BLOCK, 100U});
+}
+
+TEST_F(ConditionVariable_test, SpinningWaitDoesNotRegisterAsWaiter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "34489dfc-6bbc-434e-a19a-ea6940a17bf5");
+    ConditionListener sut(m_condVarData, WaitStrategy{WaitStrategyType::SPIN, 0U});
+
+    std::thread waiter([&] { sut.wait(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_THAT(m_condVarData.m_numberOfWaiters.load(), Eq(0U));
+    m_signaler.notify();
+    waiter.join();
+
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, SpinThenBlockWaitRegistersAsWaiterWhenTheSpinBudgetIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ee89bb86-8a53-426e-942a-0ae40da14eae");
+    ConditionListener sut(m_condVarData, WaitStrategy{WaitStrategyType::SPIN_THEN_BLOCK, 1U});
+
+    std::thread waiter([&] { sut.wait(); });
+
+    while (m_condVarData.m_numberOfWaiters.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+    m_signaler.notify();
+    waiter.join();
+
+    EXPECT_THAT(m_condVarData.m_numberOfWaiters.load(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, SpinningTimedWaitWithoutNotificationReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d56e89f3-5a46-437b-9011-79b3702e5fc6");
+    for (const auto type :
+         {WaitStrategyType::SPIN, WaitStrategyType::SPIN_THEN_YIELD, WaitStrategyType::SPIN_THEN_BLOCK})
+    {
+        ConditionListener sut(m_condVarData, WaitStrategy{type, 10U});
+        EXPECT_TRUE(sut.timedWait(1_ms).empty());
+    }
+}
+
+TEST_F(ConditionVariable_test, DestroyWakesUpSpinningWaitWhichReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c7be520-729d-4bed-8064-24ad1fae9e53");
+    ConditionListener sut(m_condVarData, WaitStrategy{WaitStrategyType::SPIN, 0U});
+
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] { activeNotifications = sut.wait(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    sut.destroy();
+    waiter.join();
+
+    EXPECT_TRUE(activeNotifications.empty());
+}
+
 TEST_F(ConditionVariable_test, GetCorrectNotificationVectorAfterNotifyAndWait)
 {
     ::testing::Test::RecordProperty("TEST_ID", "41a25c52-a358-4e94-b4a5-f315fb5124cd");
@@ -420,9 +566,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER; i++)
         {
-            EXPECT_THAT(notification, Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     });
 
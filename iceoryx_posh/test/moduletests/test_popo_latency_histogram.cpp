@@ -0,0 +1,151 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+#include "test.hpp"
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::popo::LatencyHistogram;
+using iox::popo::LatencyHistogramSnapshot;
+
+class LatencyHistogram_test : public Test
+{
+  public:
+    LatencyHistogram sut;
+    LatencyHistogramSnapshot snapshot;
+};
+
+TEST_F(LatencyHistogram_test, SmallLatenciesHaveTheirOwnBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c348c7a-3d42-44d8-adfd-a9e53e3faf0b");
+    for (uint64_t latency = 0U; latency < LatencyHistogram::SUB_BUCKETS_PER_RANGE; ++latency)
+    {
+        EXPECT_THAT(LatencyHistogram::bucketIndex(latency), Eq(latency));
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(latency), Eq(latency));
+    }
+}
+
+TEST_F(LatencyHistogram_test, BucketsAreContiguousAndContainTheirUpperBound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d22050fc-7b4a-45ee-ae6d-ccf101771fa7");
+    for (uint64_t index = 1U; index < LatencyHistogram::NUMBER_OF_BUCKETS; ++index)
+    {
+        const uint64_t lowerBound = LatencyHistogram::bucketUpperBound(index - 1U) + 1U;
+        const uint64_t upperBound = LatencyHistogram::bucketUpperBound(index);
+        EXPECT_THAT(LatencyHistogram::bucketIndex(lowerBound), Eq(index));
+        EXPECT_THAT(LatencyHistogram::bucketIndex(upperBound), Eq(index));
+    }
+}
+
+TEST_F(LatencyHistogram_test, BucketWidthIsLimitedRelativeToTheLowerBound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "31946439-35a5-4773-bb14-13556dcc8842");
+    for (uint64_t index = LatencyHistogram::SUB_BUCKETS_PER_RANGE; index < LatencyHistogram::NUMBER_OF_BUCKETS;
+         ++index)
+    {
+        const uint64_t lowerBound = LatencyHistogram::bucketUpperBound(index - 1U) + 1U;
+        const uint64_t width = LatencyHistogram::bucketUpperBound(index) - lowerBound + 1U;
+        EXPECT_THAT(width * LatencyHistogram::SUB_BUCKETS_PER_RANGE, Le(lowerBound));
+    }
+}
+
+TEST_F(LatencyHistogram_test, LargeLatenciesAreCountedInTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0b17f27-bfc5-4bdb-a2b6-4969eb659e2d");
+    constexpr uint64_t LAST_BUCKET{LatencyHistogram::NUMBER_OF_BUCKETS - 1U};
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1ULL << LatencyHistogram::NUMBER_OF_RANGES), Eq(LAST_BUCKET));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(std::numeric_limits<uint64_t>::max()), Eq(LAST_BUCKET));
+}
+
+TEST_F(LatencyHistogram_test, EmptySnapshotHasNoSamplesAndZeroPercentiles)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4b901ae-d635-465e-8486-4dcbae590718");
+    sut.collect(snapshot);
+
+    EXPECT_THAT(snapshot.numberOfSamples(), Eq(0U));
+    EXPECT_THAT(snapshot.maxLatency(), Eq(0U));
+    EXPECT_THAT(snapshot.percentile(0.5), Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, PercentilesAreUpperBoundsOfTheBucketsLimitedToTheMaxLatency)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5419dd92-5fe7-4f57-8d8c-e0908b89acd2");
+    constexpr uint64_t NUMBER_OF_SAMPLES{1000U};
+    for (uint64_t latency = 1U; latency <= NUMBER_OF_SAMPLES; ++latency)
+    {
+        sut.record(latency);
+    }
+    sut.collect(snapshot);
+
+    EXPECT_THAT(snapshot.numberOfSamples(), Eq(NUMBER_OF_SAMPLES));
+    EXPECT_THAT(snapshot.maxLatency(), Eq(NUMBER_OF_SAMPLES));
+    EXPECT_THAT(snapshot.percentile(0.0), Eq(1U));
+    EXPECT_THAT(snapshot.percentile(0.5), Eq(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(500U))));
+    EXPECT_THAT(snapshot.percentile(0.999), Eq(NUMBER_OF_SAMPLES));
+    EXPECT_THAT(snapshot.percentile(1.0), Eq(NUMBER_OF_SAMPLES));
+}
+
+TEST_F(LatencyHistogram_test, CollectResetsTheHistogramAndAccumulatesInTheSnapshot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d1f0d65-bfca-4703-a39b-f2e087d7ce8f");
+    sut.record(100U);
+    sut.record(200U);
+    sut.collect(snapshot);
+    sut.record(50U);
+    sut.collect(snapshot);
+
+    EXPECT_THAT(snapshot.numberOfSamples(), Eq(3U));
+    EXPECT_THAT(snapshot.maxLatency(), Eq(200U));
+
+    LatencyHistogramSnapshot emptySnapshot;
+    sut.collect(emptySnapshot);
+    EXPECT_THAT(emptySnapshot.numberOfSamples(), Eq(0U));
+    EXPECT_THAT(emptySnapshot.maxLatency(), Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, ConcurrentRecordsAreAllCounted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70451988-9ddb-4e0c-89ad-3edb4e7de4b9");
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    constexpr uint64_t RECORDS_PER_THREAD{10000U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (uint64_t i = 0U; i < RECORDS_PER_THREAD; ++i)
+            {
+                sut.record(t * RECORDS_PER_THREAD + i);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    sut.collect(snapshot);
+
+    EXPECT_THAT(snapshot.numberOfSamples(), Eq(NUMBER_OF_THREADS * RECORDS_PER_THREAD));
+    EXPECT_THAT(snapshot.maxLatency(), Eq(NUMBER_OF_THREADS * RECORDS_PER_THREAD - 1U));
+}
+
+} // namespace
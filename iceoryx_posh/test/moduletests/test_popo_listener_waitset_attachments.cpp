@@ -222,7 +222,14 @@ TEST_F(ListenerWaitsetAttachments_test, ServiceDiscoveryDestructorCallsTriggerRe
                                       RUNTIME_NAME,
                                       VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
                                       SubscriberOptions());
-    EXPECT_CALL(*this->runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&subscriberData));
+    SubscriberPortData changeSubscriberData({SERVICE, INSTANCE, EVENT},
+                                            RUNTIME_NAME,
+                                            VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                                            SubscriberOptions());
+    // the service discovery subscribes to the full service registry and to its changes
+    EXPECT_CALL(*this->runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&subscriberData))
+        .WillOnce(Return(&changeSubscriberData));
 
     optional<iox::runtime::ServiceDiscovery> serviceDiscovery;
     serviceDiscovery.emplace();
@@ -275,6 +275,31 @@ TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, PublishingABatchSendsAllUnderlyingMemoryChunksOnPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf9aa87e-911a-430b-9ce2-f00891e06057");
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::success<iox::mepoo::ChunkHeader*>(secondChunkMock.chunkHeader()))));
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_))
+        .WillOnce(Invoke([&](const iox::span<iox::mepoo::ChunkHeader* const> chunkHeaders) {
+            sentChunkHeaders.assign(chunkHeaders.begin(), chunkHeaders.end());
+        }));
+    std::vector<iox::popo::Sample<DummyData>> samples;
+    sut.loan().and_then([&](auto& sample) { samples.emplace_back(std::move(sample)); });
+    sut.loan().and_then([&](auto& sample) { samples.emplace_back(std::move(sample)); });
+    ASSERT_THAT(samples.size(), Eq(2U));
+    // ===== Test ===== //
+    sut.publishBatch(iox::span<iox::popo::Sample<DummyData>>(samples.data(), samples.size()));
+    // ===== Verify ===== //
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(2U));
+    EXPECT_THAT(sentChunkHeaders[0], Eq(chunkMock.chunkHeader()));
+    EXPECT_THAT(sentChunkHeaders[1], Eq(secondChunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(PublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -32,6 +32,10 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.subscriberTooSlowTimeout = iox::units::Duration::fromMilliseconds(1337);
+    testOptions.chunkMagazineCapacity = 13;
+    testOptions.stampSendTime = true;
+    testOptions.numaNode = 1;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +50,30 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.subscriberTooSlowTimeout, Ne(defaultOptions.subscriberTooSlowTimeout));
+            EXPECT_THAT(roundTripOptions.subscriberTooSlowTimeout, Eq(testOptions.subscriberTooSlowTimeout));
+
+            EXPECT_THAT(roundTripOptions.chunkMagazineCapacity, Ne(defaultOptions.chunkMagazineCapacity));
+            EXPECT_THAT(roundTripOptions.chunkMagazineCapacity, Eq(testOptions.chunkMagazineCapacity));
+
+            EXPECT_THAT(roundTripOptions.stampSendTime, Ne(defaultOptions.stampSendTime));
+            EXPECT_THAT(roundTripOptions.stampSendTime, Eq(testOptions.stampSendTime));
+
+            EXPECT_THAT(roundTripOptions.numaNode, Ne(defaultOptions.numaNode));
+            EXPECT_THAT(roundTripOptions.numaNode, Eq(testOptions.numaNode));
+        })
+        .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
+}
+
+TEST(PublisherOptions_test, SerializationRoundTripOfDefaultOptionsKeepsInfiniteSubscriberTooSlowTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a3be4a1-2d0c-4d0f-9a4f-1f38c8a3c6b5");
+    iox::popo::PublisherOptions defaultOptions;
+
+    iox::popo::PublisherOptions::deserialize(defaultOptions.serialize())
+        .and_then([&](auto& roundTripOptions) {
+            EXPECT_THAT(roundTripOptions.subscriberTooSlowTimeout, Eq(iox::units::Duration::max()));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,9 +94,17 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr bool HAS_SUBSCRIBER_TOO_SLOW_TIMEOUT{true};
+    constexpr uint64_t SUBSCRIBER_TOO_SLOW_TIMEOUT_NANOSECONDS{1000U};
+    constexpr uint64_t CHUNK_MAGAZINE_CAPACITY{0U};
 
-    const auto serialized =
-        iox::cxx::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::cxx::Serialization::create(HISTORY_CAPACITY,
+                                                            NODE_NAME,
+                                                            OFFER_ON_CREATE,
+                                                            SUBSCRIBER_TOO_SLOW_POLICY,
+                                                            HAS_SUBSCRIBER_TOO_SLOW_TIMEOUT,
+                                                            SUBSCRIBER_TOO_SLOW_TIMEOUT_NANOSECONDS,
+                                                            CHUNK_MAGAZINE_CAPACITY);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
@@ -94,6 +94,105 @@ TEST_F(UntypedPublisherTest, LoansChunkWithRequestedSizeAndUserHeaderWorks)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, LoanChainForwardsTheSizesToThePortAndReturnsTheUserPayloadOfTheFirstLink)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "abf09d85-6b92-4322-b68c-01414f870ce7");
+    constexpr uint64_t CHAIN_PAYLOAD_SIZE = 200U * 1024U * 1024U;
+    constexpr uint32_t LINK_PAYLOAD_SIZE = 1024U * 1024U;
+    constexpr uint32_t USER_PAYLOAD_ALIGNMENT = 64U;
+    EXPECT_CALL(portMock, tryAllocateChunkChain(CHAIN_PAYLOAD_SIZE, LINK_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT))
+        .WillOnce(Return(ByMove(iox::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = sut.loanChain(CHAIN_PAYLOAD_SIZE, LINK_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(chunkMock.chunkHeader()->userPayload(), result.value());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, LoanChainFailsIfPortCannotSatisfyAllocationRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f078d56e-4064-42d7-9d78-18c3909bc621");
+    EXPECT_CALL(portMock, tryAllocateChunkChain(_, _, _))
+        .WillOnce(
+            Return(ByMove(iox::error<iox::popo::AllocationError>(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    // ===== Test ===== //
+    auto result = sut.loanChain(1024U, 128U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.get_error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, LoanWithCapacityAllocatesTheCapacityAndShrinksToTheRequestedSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "12465146-9aef-4a82-bc08-de4401ba7e36");
+    constexpr uint32_t USER_PAYLOAD_SIZE = 64U;
+    constexpr uint32_t USER_PAYLOAD_CAPACITY = 4096U;
+    InSequence sequence;
+    EXPECT_CALL(portMock, tryAllocateChunk(USER_PAYLOAD_CAPACITY, _, _, _))
+        .WillOnce(Return(ByMove(iox::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, tryResizeChunk(chunkMock.chunkHeader(), USER_PAYLOAD_SIZE))
+        .WillOnce(Return(ByMove(iox::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = sut.loan(USER_PAYLOAD_SIZE,
+                           iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                           iox::CHUNK_NO_USER_HEADER_SIZE,
+                           iox::CHUNK_NO_USER_HEADER_ALIGNMENT,
+                           USER_PAYLOAD_CAPACITY);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(chunkMock.chunkHeader()->userPayload(), result.value());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, LoanWithCapacityBelowTheRequestedSizeDoesNotResize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd17caf7-0505-4e92-8358-7e782b4db42f");
+    constexpr uint32_t USER_PAYLOAD_SIZE = 64U;
+    EXPECT_CALL(portMock, tryAllocateChunk(USER_PAYLOAD_SIZE, _, _, _))
+        .WillOnce(Return(ByMove(iox::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, tryResizeChunk(_, _)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loan(USER_PAYLOAD_SIZE,
+                           iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                           iox::CHUNK_NO_USER_HEADER_SIZE,
+                           iox::CHUNK_NO_USER_HEADER_ALIGNMENT,
+                           USER_PAYLOAD_SIZE / 2U);
+    // ===== Verify ===== //
+    EXPECT_FALSE(result.has_error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, ResizeForwardsToThePortAndReturnsTheUserPayloadOfTheResizedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "76debd41-460d-499d-a565-8b9225ab47a7");
+    constexpr uint32_t USER_PAYLOAD_SIZE = 1024U;
+    ChunkMock<bool> resizedChunkMock;
+    EXPECT_CALL(portMock, tryResizeChunk(chunkMock.chunkHeader(), USER_PAYLOAD_SIZE))
+        .WillOnce(Return(ByMove(iox::success<iox::mepoo::ChunkHeader*>(resizedChunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = sut.resize(chunkMock.chunkHeader()->userPayload(), USER_PAYLOAD_SIZE);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(resizedChunkMock.chunkHeader()->userPayload(), result.value());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, ResizeFailsIfPortCannotResizeTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b9f6a7e-fe18-470c-a773-58d465305a1b");
+    EXPECT_CALL(portMock, tryResizeChunk(_, _))
+        .WillOnce(
+            Return(ByMove(iox::error<iox::popo::AllocationError>(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    // ===== Test ===== //
+    auto result = sut.resize(chunkMock.chunkHeader()->userPayload(), 1024U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.get_error());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(UntypedPublisherTest, LoanFailsIfPortCannotSatisfyAllocationRequest)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b609f96e-ea08-46b2-9b72-d162a8273cb5");
@@ -138,6 +237,26 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, PublishesBatchOfUserPayloadsViaUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "401818bb-cbd7-44b2-a807-cd080e5e429f");
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> secondChunkMock;
+    void* const userPayloads[] = {chunkMock.chunkHeader()->userPayload(), secondChunkMock.chunkHeader()->userPayload()};
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_))
+        .WillOnce(Invoke([&](const iox::span<iox::mepoo::ChunkHeader* const> chunkHeaders) {
+            sentChunkHeaders.assign(chunkHeaders.begin(), chunkHeaders.end());
+        }));
+    // ===== Test ===== //
+    sut.publishBatch(iox::span<void* const>(userPayloads, 2U));
+    // ===== Verify ===== //
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(2U));
+    EXPECT_THAT(sentChunkHeaders[0], Eq(chunkMock.chunkHeader()));
+    EXPECT_THAT(sentChunkHeaders[1], Eq(secondChunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -266,8 +266,9 @@ TEST_F(WaitSetHelper_test, MergeWithOverlappingOneElementNotificationVector)
 class WaitSetTest : public iox::popo::WaitSet<>
 {
   public:
-    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
-        : WaitSet(condVarData)
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData,
+                const iox::popo::WaitStrategy waitStrategy = iox::popo::WaitStrategy()) noexcept
+        : WaitSet(condVarData, waitStrategy)
     {
     }
 };
@@ -1203,6 +1204,33 @@ TEST_F(WaitSet_test, TimedWaitReturnsTheOneTriggeredCondition)
     WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->timedWait(10_ms); });
 }
 
+TEST_F(WaitSet_test, SpinningWaitReturnsTheConditionWhichIsTriggeredWhileWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c5a31bb-5637-4a06-aecd-87d6fdbb7b66");
+    m_sut.emplace(m_condVarData, WaitStrategy{WaitStrategyType::SPIN, 0U});
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0], 5U).has_error());
+
+    WaitSet<>::NotificationInfoVector triggerVector;
+    std::thread t([&] { triggerVector = m_sut->wait(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    m_simpleEvents[0].trigger();
+    t.join();
+
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_TRUE(triggerVector[0U]->doesOriginateFrom(&m_simpleEvents[0]));
+}
+
+TEST_F(WaitSet_test, SpinThenYieldTimedWaitReturnsNothingWhenNothingTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a8f083f-991e-47bd-b0e1-d40fcae06da6");
+    m_sut.emplace(m_condVarData, WaitStrategy{WaitStrategyType::SPIN_THEN_YIELD, 100U});
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0], 5U).has_error());
+
+    auto triggerVector = m_sut->timedWait(10_ms);
+    EXPECT_THAT(triggerVector.size(), Eq(0U));
+}
+
 void WaitReturnsAllTriggeredConditionWhenMultipleAreTriggered(
     WaitSet_test* test, const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
@@ -379,12 +379,17 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     iox::vector<iox::capro::ServiceDescription, iox::NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    const iox::capro::ServiceDescription serviceRegistryChanges{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                                iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                                iox::SERVICE_DISCOVERY_CHANGES_EVENT_NAME};
 
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryChanges);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
+    internalServices.push_back(iox::roudi::IntrospectionSubscriberLatencyService);
 
     // Added by ProcessManager
     internalServices.push_back(iox::roudi::IntrospectionMempoolService);
@@ -728,24 +733,18 @@ TEST_F(PoshRuntime_test, GetMiddlewareClientWhenMaxClientsAreUsedResultsInClient
     EXPECT_TRUE(clientOverflowDetected);
 }
 
-TEST_F(PoshRuntime_test, GetMiddlewareClientWithInvalidNodeNameLeadsToErrorHandlerCall)
+TEST_F(PoshRuntime_test, GetMiddlewareClientWithSeparatorInNodeNameIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b4433dfd-d2f8-4567-9483-aed956275ce8");
     const iox::capro::ServiceDescription sd{"great", "gig", "sky"};
     iox::popo::ClientOptions clientOptions;
     clientOptions.nodeName = m_invalidNodeName;
+    iox::runtime::PortConfigInfo defaultPortConfigInfo;
 
-    iox::optional<iox::PoshError> detectedError;
-    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
-        [&detectedError](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
-            detectedError.emplace(error);
-            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::SEVERE));
-        });
-
-    m_runtime->getMiddlewareClient(sd, clientOptions);
+    auto clientPort = m_runtime->getMiddlewareClient(sd, clientOptions);
 
-    ASSERT_THAT(detectedError.has_value(), Eq(true));
-    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_INVALID_RESPONSE));
+    ASSERT_THAT(clientPort, Ne(nullptr));
+    checkClientInitialization(clientPort, sd, clientOptions, defaultPortConfigInfo.memoryInfo);
 }
 
 TEST_F(PoshRuntime_test, GetMiddlewareServerWithDefaultArgsIsSuccessful)
@@ -839,24 +838,128 @@ TEST_F(PoshRuntime_test, GetMiddlewareServerWhenMaxServerAreUsedResultsInServerl
     EXPECT_TRUE(serverOverflowDetected);
 }
 
-TEST_F(PoshRuntime_test, GetMiddlewareServerWithInvalidNodeNameLeadsToErrorHandlerCall)
+TEST_F(PoshRuntime_test, GetMiddlewareServerWithSeparatorInNodeNameIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "95603ddc-1051-4dd7-a163-1c621f8a211a");
     const iox::capro::ServiceDescription sd{"it's", "over", "now"};
     iox::popo::ServerOptions serverOptions;
     serverOptions.nodeName = m_invalidNodeName;
+    iox::runtime::PortConfigInfo defaultPortConfigInfo;
 
-    iox::optional<iox::PoshError> detectedError;
+    auto serverPort = m_runtime->getMiddlewareServer(sd, serverOptions);
+
+    ASSERT_THAT(serverPort, Ne(nullptr));
+    checkServerInitialization(serverPort, sd, serverOptions, defaultPortConfigInfo.memoryInfo);
+}
+
+TEST_F(PoshRuntime_test, CreatePortsCreatesAllRequestedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c2c631b-0afa-4fb1-8ab1-dbc5fe0cd3ba");
+    const iox::capro::ServiceDescription sd{"echoes", "meddle", "pompeii"};
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 3U;
+    publisherOptions.nodeName = m_nodeName;
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 7U;
+    subscriberOptions.nodeName = m_nodeName;
+    iox::popo::ClientOptions clientOptions;
+    clientOptions.responseQueueCapacity = 5U;
+    clientOptions.nodeName = m_nodeName;
+    iox::popo::ServerOptions serverOptions;
+    serverOptions.requestQueueCapacity = 9U;
+    serverOptions.nodeName = m_nodeName;
+    const iox::runtime::PortConfigInfo portConfigInfo{11U, 22U, 33U};
+
+    PortCreationBatch sut;
+    auto publisherIndex = sut.addPublisher(sd, publisherOptions, portConfigInfo);
+    auto subscriberIndex = sut.addSubscriber(sd, subscriberOptions, portConfigInfo);
+    auto clientIndex = sut.addClient(sd, clientOptions, portConfigInfo);
+    auto serverIndex = sut.addServer(sd, serverOptions, portConfigInfo);
+    ASSERT_TRUE(publisherIndex.has_value());
+    ASSERT_TRUE(subscriberIndex.has_value());
+    ASSERT_TRUE(clientIndex.has_value());
+    ASSERT_TRUE(serverIndex.has_value());
+
+    m_runtime->createPorts(sut);
+
+    auto publisherPort = sut.getPublisher(publisherIndex.value());
+    ASSERT_FALSE(publisherPort.has_error());
+    EXPECT_THAT(publisherPort.value()->m_serviceDescription, Eq(sd));
+    EXPECT_THAT(publisherPort.value()->m_nodeName, Eq(m_nodeName));
+    EXPECT_THAT(publisherPort.value()->m_chunkSenderData.m_historyCapacity, Eq(publisherOptions.historyCapacity));
+
+    auto subscriberPort = sut.getSubscriber(subscriberIndex.value());
+    ASSERT_FALSE(subscriberPort.has_error());
+    EXPECT_THAT(subscriberPort.value()->m_serviceDescription, Eq(sd));
+    EXPECT_THAT(subscriberPort.value()->m_nodeName, Eq(m_nodeName));
+    EXPECT_THAT(subscriberPort.value()->m_chunkReceiverData.m_queue.capacity(), Eq(subscriberOptions.queueCapacity));
+
+    auto clientPort = sut.getClient(clientIndex.value());
+    ASSERT_FALSE(clientPort.has_error());
+    checkClientInitialization(clientPort.value(), sd, clientOptions, portConfigInfo.memoryInfo);
+
+    auto serverPort = sut.getServer(serverIndex.value());
+    ASSERT_FALSE(serverPort.has_error());
+    checkServerInitialization(serverPort.value(), sd, serverOptions, portConfigInfo.memoryInfo);
+}
+
+TEST_F(PoshRuntime_test, CreatePortsWithMoreRequestsThanFitIntoOneMessageCreatesAllPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8575abe1-9927-4277-8391-c5cc0270452f");
+    constexpr uint64_t NUMBER_OF_PORTS{80U};
+    // long service descriptions limit the number of requests per message to a few
+    const std::string longName(iox::capro::IdString_t::capacity() - 3U, 'x');
+
+    PortCreationBatch sut;
+    iox::vector<iox::capro::ServiceDescription, NUMBER_OF_PORTS> services;
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        const auto instance = longName + iox::cxx::convert::toString(i);
+        services.emplace_back(iox::capro::IdString_t(iox::TruncateToCapacity, longName.c_str(), longName.size()),
+                              iox::capro::IdString_t(iox::TruncateToCapacity, instance.c_str(), instance.size()),
+                              iox::capro::IdString_t(iox::TruncateToCapacity, longName.c_str(), longName.size()));
+        const auto index = (i % 2U == 0U) ? sut.addPublisher(services.back()) : sut.addSubscriber(services.back());
+        ASSERT_TRUE(index.has_value());
+        EXPECT_THAT(index.value(), Eq(i));
+    }
+
+    m_runtime->createPorts(sut);
+
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; i += 2U)
+    {
+        auto publisherPort = sut.getPublisher(i);
+        ASSERT_FALSE(publisherPort.has_error());
+        EXPECT_THAT(publisherPort.value()->m_serviceDescription, Eq(services[i]));
+
+        auto subscriberPort = sut.getSubscriber(i + 1U);
+        ASSERT_FALSE(subscriberPort.has_error());
+        EXPECT_THAT(subscriberPort.value()->m_serviceDescription, Eq(services[i + 1U]));
+    }
+}
+
+TEST_F(PoshRuntime_test, CreatePortsReturnsErrorOfFailedRequestAndCreatesTheOtherPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e032450a-19ce-4381-95c0-2183963aae51");
+    // RouDi reports the forbidden service description to the error handler, the runtime does not
+    bool runtimeErrorDetected{false};
     auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
-        [&detectedError](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
-            detectedError.emplace(error);
-            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::SEVERE));
+        [&runtimeErrorDetected](const iox::PoshError error, const iox::ErrorLevel) {
+            runtimeErrorDetected |= (error == iox::PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN);
         });
 
-    m_runtime->getMiddlewareServer(sd, serverOptions);
+    PortCreationBatch sut;
+    auto publisherIndex = sut.addPublisher(iox::roudi::IntrospectionPortService);
+    auto subscriberIndex = sut.addSubscriber({"shine", "on", "you"});
+    ASSERT_TRUE(publisherIndex.has_value());
+    ASSERT_TRUE(subscriberIndex.has_value());
 
-    ASSERT_THAT(detectedError.has_value(), Eq(true));
-    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE));
+    m_runtime->createPorts(sut);
+
+    auto publisherPort = sut.getPublisher(publisherIndex.value());
+    ASSERT_TRUE(publisherPort.has_error());
+    EXPECT_THAT(publisherPort.get_error(), Eq(IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN));
+    EXPECT_FALSE(sut.getSubscriber(subscriberIndex.value()).has_error());
+    EXPECT_FALSE(runtimeErrorDetected);
 }
 
 TEST_F(PoshRuntime_test, GetMiddlewareConditionVariableIsSuccessful)
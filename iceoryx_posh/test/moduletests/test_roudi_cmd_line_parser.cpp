@@ -36,7 +36,9 @@ bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
 {
     return (lhs.monitoringMode == rhs.monitoringMode) && (lhs.logLevel == rhs.logLevel)
            && (lhs.compatibilityCheckLevel == rhs.compatibilityCheckLevel)
-           && (lhs.processKillDelay == rhs.processKillDelay) && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
+           && (lhs.processKillDelay == rhs.processKillDelay)
+           && (lhs.numberOfRuntimeMessagesWorkers == rhs.numberOfRuntimeMessagesWorkers)
+           && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
            && (lhs.run == rhs.run) && (lhs.configFilePath == rhs.configFilePath);
 }
 } // namespace config
@@ -346,6 +348,70 @@ TEST_F(CmdLineParser_test, KillDelayOptionOutOfBoundsLeadsToProgrammNotRunning)
     EXPECT_FALSE(result.value().run);
 }
 
+TEST_F(CmdLineParser_test, IpcWorkersLongOptionLeadsToCorrectNumberOfWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "83b0a34b-1e11-40f6-ad02-824255943bd0");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--ipc-workers";
+    char value[] = "13";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().numberOfRuntimeMessagesWorkers, 13U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, IpcWorkersShortOptionLeadsToCorrectNumberOfWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "78fb24c8-269a-47c6-9521-14650c0c4db9");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-w";
+    char value[] = "1";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().numberOfRuntimeMessagesWorkers, 1U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, IpcWorkersOptionOutOfBoundsLeadsToProgrammNotRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "df799d34-f472-49df-b8be-999fc885cd06");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--ipc-workers";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+
+    for (auto value : {std::to_string(0U), std::to_string(iox::roudi::MAX_NUMBER_OF_RUNTIME_MESSAGES_WORKERS + 1U)})
+    {
+        SCOPED_TRACE(value);
+        args[2] = &value[0];
+        optind = 0;
+
+        CmdLineParser sut;
+        auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+        ASSERT_FALSE(result.has_error());
+        EXPECT_FALSE(result.value().run);
+    }
+}
+
 TEST_F(CmdLineParser_test, CompatibilityLevelOptionsLeadToCorrectCompatibilityLevel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "62b7d5c9-0638-4314-b4f7-c622ef101045");
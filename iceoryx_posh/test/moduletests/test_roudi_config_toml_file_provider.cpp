@@ -103,6 +103,74 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
 #endif
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSegmentMemoryOptionsIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fae698a2-9315-4ad9-9d4c-615ca1d7da50");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        huge_pages = true
+        prefault = true
+        lock_in_memory = true
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 256
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    EXPECT_TRUE(segments[0].m_memoryOptions.hugePages);
+    EXPECT_TRUE(segments[0].m_memoryOptions.prefault);
+    EXPECT_TRUE(segments[0].m_memoryOptions.lockInMemory);
+    EXPECT_FALSE(segments[1].m_memoryOptions.hugePages);
+    EXPECT_FALSE(segments[1].m_memoryOptions.prefault);
+    EXPECT_FALSE(segments[1].m_memoryOptions.lockInMemory);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSegmentNumaNodeIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e335aafb-c634-4f97-b3dd-75c3a49fc707");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        numa_node = 1
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 256
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    EXPECT_THAT(segments[0].m_memoryInfo, Eq(iox::mepoo::MemoryInfo::numaNode(1U)));
+    EXPECT_THAT(segments[0].m_memoryInfo.getNumaNode(), Eq(1U));
+    EXPECT_THAT(segments[1].m_memoryInfo, Eq(iox::mepoo::MemoryInfo()));
+    EXPECT_THAT(segments[1].m_memoryInfo.getNumaNode(), Eq(iox::mepoo::MemoryInfo::NO_NUMA_NODE));
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
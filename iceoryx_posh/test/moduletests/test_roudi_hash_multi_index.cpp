@@ -0,0 +1,267 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/hash_multi_index.hpp"
+#include "test.hpp"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::roudi::HashMultiIndex;
+
+// the key of a value is the value divided by VALUES_PER_KEY
+constexpr uint32_t VALUES_PER_KEY{100U};
+constexpr uint64_t CAPACITY{64U};
+
+class HashMultiIndex_test : public Test
+{
+  public:
+    using Index_t = HashMultiIndex<uint32_t, CAPACITY>;
+
+    static uint32_t value(const uint32_t key, const uint32_t id)
+    {
+        return key * VALUES_PER_KEY + id;
+    }
+
+    static auto hasKey(const uint32_t key)
+    {
+        return [key](const uint32_t value) { return value / VALUES_PER_KEY == key; };
+    }
+
+    /// @brief the hash is not important for the correctness, a bad one only leads to long probe sequences
+    static uint64_t hash(const uint32_t key)
+    {
+        return key;
+    }
+
+    bool insert(const uint32_t key, const uint32_t id)
+    {
+        return sut.insert(hash(key), value(key, id), hasKey(key));
+    }
+
+    bool erase(const uint32_t key, const uint32_t id)
+    {
+        return sut.erase(hash(key), value(key, id), hasKey(key));
+    }
+
+    std::vector<uint32_t> valuesOf(const uint32_t key)
+    {
+        std::vector<uint32_t> values;
+        sut.forEach(hash(key), hasKey(key), [&](const uint32_t value) { values.push_back(value); });
+        return values;
+    }
+
+    Index_t sut;
+};
+
+TEST_F(HashMultiIndex_test, NumberOfBucketsIsAPowerOfTwoWithAtLeastTwiceTheCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5dc5edd-c33f-4f3f-a229-bbbf73652f30");
+    EXPECT_THAT(Index_t::NUMBER_OF_BUCKETS, Eq(128U));
+    EXPECT_THAT((HashMultiIndex<uint32_t, 65U>::NUMBER_OF_BUCKETS), Eq(256U));
+    EXPECT_THAT((HashMultiIndex<uint32_t, 1U>::NUMBER_OF_BUCKETS), Eq(2U));
+}
+
+TEST_F(HashMultiIndex_test, EmptyIndexHasNoValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4ab6400-37be-43f8-8a7f-6047e914f59d");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(sut.count(hash(1U), hasKey(1U)), Eq(0U));
+    EXPECT_THAT(valuesOf(1U), IsEmpty());
+}
+
+TEST_F(HashMultiIndex_test, ValuesOfAKeyAreReturnedInInsertionOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b1bf129-561d-4c5e-b360-21f2a006a4c3");
+    ASSERT_TRUE(insert(7U, 3U));
+    ASSERT_TRUE(insert(7U, 1U));
+    ASSERT_TRUE(insert(7U, 2U));
+
+    EXPECT_THAT(sut.size(), Eq(3U));
+    EXPECT_THAT(sut.count(hash(7U), hasKey(7U)), Eq(3U));
+    EXPECT_THAT(valuesOf(7U), ElementsAre(value(7U, 3U), value(7U, 1U), value(7U, 2U)));
+}
+
+TEST_F(HashMultiIndex_test, ValuesOfDifferentKeysAreSeparated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b01276aa-9c7b-4cee-beee-2477c7c1856d");
+    ASSERT_TRUE(insert(1U, 1U));
+    ASSERT_TRUE(insert(2U, 1U));
+    ASSERT_TRUE(insert(1U, 2U));
+
+    EXPECT_THAT(valuesOf(1U), ElementsAre(value(1U, 1U), value(1U, 2U)));
+    EXPECT_THAT(valuesOf(2U), ElementsAre(value(2U, 1U)));
+    EXPECT_THAT(valuesOf(3U), IsEmpty());
+}
+
+TEST_F(HashMultiIndex_test, KeysWithTheSameHashAreDistinguishedByThePredicate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a1a258d-b0f2-4f9b-b0e3-4a19e01cf867");
+    constexpr uint64_t SAME_HASH{42U};
+    ASSERT_TRUE(sut.insert(SAME_HASH, value(1U, 1U), hasKey(1U)));
+    ASSERT_TRUE(sut.insert(SAME_HASH, value(2U, 1U), hasKey(2U)));
+    ASSERT_TRUE(sut.insert(SAME_HASH, value(1U, 2U), hasKey(1U)));
+
+    EXPECT_THAT(sut.count(SAME_HASH, hasKey(1U)), Eq(2U));
+    EXPECT_THAT(sut.count(SAME_HASH, hasKey(2U)), Eq(1U));
+
+    EXPECT_TRUE(sut.erase(SAME_HASH, value(1U, 1U), hasKey(1U)));
+    EXPECT_TRUE(sut.erase(SAME_HASH, value(1U, 2U), hasKey(1U)));
+    EXPECT_THAT(sut.count(SAME_HASH, hasKey(1U)), Eq(0U));
+    EXPECT_THAT(sut.count(SAME_HASH, hasKey(2U)), Eq(1U));
+}
+
+TEST_F(HashMultiIndex_test, InsertFailsWhenTheCapacityIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de049427-c431-465a-a655-cb5a5803a3c3");
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(insert(i % 5U, i));
+    }
+
+    EXPECT_FALSE(insert(0U, 99U));
+    EXPECT_FALSE(insert(77U, 0U));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+
+    EXPECT_TRUE(erase(3U, 3U));
+    EXPECT_TRUE(insert(77U, 0U));
+}
+
+TEST_F(HashMultiIndex_test, EraseRemovesOnlyTheProvidedValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c09f710a-38be-43c1-980b-54995d0a9608");
+    ASSERT_TRUE(insert(4U, 1U));
+    ASSERT_TRUE(insert(4U, 2U));
+    ASSERT_TRUE(insert(4U, 3U));
+
+    EXPECT_TRUE(erase(4U, 3U));
+    EXPECT_THAT(valuesOf(4U), ElementsAre(value(4U, 1U), value(4U, 2U)));
+
+    // the last value was removed, new values must be appended behind the remaining ones
+    ASSERT_TRUE(insert(4U, 4U));
+    EXPECT_TRUE(erase(4U, 1U));
+    EXPECT_THAT(valuesOf(4U), ElementsAre(value(4U, 2U), value(4U, 4U)));
+    EXPECT_THAT(sut.size(), Eq(2U));
+}
+
+TEST_F(HashMultiIndex_test, EraseOfAnUnknownValueFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ad9e22e2-dac4-48e5-93eb-7f5658c18de9");
+    ASSERT_TRUE(insert(4U, 1U));
+
+    EXPECT_FALSE(erase(4U, 2U));
+    EXPECT_FALSE(erase(5U, 1U));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(HashMultiIndex_test, ErasingAKeyKeepsTheCollidingKeysReachable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4fcbe9f-5184-4ccd-a654-40d0100eca0c");
+    // all keys prefer the same bucket and form one long probe sequence which wraps around at the end
+    const uint64_t lastBucket = Index_t::NUMBER_OF_BUCKETS - 1U;
+    constexpr uint32_t NUMBER_OF_KEYS{10U};
+    for (uint32_t key = 0U; key < NUMBER_OF_KEYS; ++key)
+    {
+        ASSERT_TRUE(sut.insert(lastBucket, value(key, 0U), hasKey(key)));
+    }
+
+    for (uint32_t key = 0U; key < NUMBER_OF_KEYS; key += 2U)
+    {
+        EXPECT_TRUE(sut.erase(lastBucket, value(key, 0U), hasKey(key)));
+    }
+
+    for (uint32_t key = 0U; key < NUMBER_OF_KEYS; ++key)
+    {
+        EXPECT_THAT(sut.count(lastBucket, hasKey(key)), Eq(key % 2U));
+    }
+}
+
+TEST_F(HashMultiIndex_test, RandomInsertAndEraseBehavesLikeAMultimap)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fde34477-0e19-43c3-b528-3935c18417de");
+    constexpr uint32_t NUMBER_OF_KEYS{20U};
+    constexpr uint32_t NUMBER_OF_OPERATIONS{10000U};
+    std::multimap<uint32_t, uint32_t> reference;
+    std::mt19937 randomGenerator{1337U};
+    std::uniform_int_distribution<uint32_t> keyDistribution{0U, NUMBER_OF_KEYS - 1U};
+    std::uniform_int_distribution<uint32_t> idDistribution{0U, 9U};
+    // a bad hash with many collisions stresses the probing and the backward shift deletion
+    auto badHash = [](const uint32_t key) { return static_cast<uint64_t>(key % 3U) * 61U; };
+
+    for (uint32_t i = 0U; i < NUMBER_OF_OPERATIONS; ++i)
+    {
+        const uint32_t key = keyDistribution(randomGenerator);
+        const uint32_t id = idDistribution(randomGenerator);
+        if (reference.size() < CAPACITY && (i % 3U) != 0U)
+        {
+            ASSERT_TRUE(sut.insert(badHash(key), value(key, id), hasKey(key)));
+            reference.emplace(key, value(key, id));
+        }
+        else
+        {
+            auto range = reference.equal_range(key);
+            auto iter =
+                std::find_if(range.first, range.second, [&](auto& entry) { return entry.second == value(key, id); });
+            const bool isContained = iter != range.second;
+            ASSERT_THAT(sut.erase(badHash(key), value(key, id), hasKey(key)), Eq(isContained));
+            if (isContained)
+            {
+                reference.erase(iter);
+            }
+        }
+    }
+
+    EXPECT_THAT(sut.size(), Eq(reference.size()));
+    for (uint32_t key = 0U; key < NUMBER_OF_KEYS; ++key)
+    {
+        std::vector<uint32_t> expectedValues;
+        auto range = reference.equal_range(key);
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            expectedValues.push_back(iter->second);
+        }
+        std::vector<uint32_t> values;
+        sut.forEach(badHash(key), hasKey(key), [&](const uint32_t value) { values.push_back(value); });
+        EXPECT_THAT(values, ElementsAreArray(expectedValues));
+    }
+}
+
+TEST(HashMultiIndexHash_test, EqualServiceDescriptionsHaveTheSameHash)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "514e01cb-4f51-4f90-99bd-d64200260f4a");
+    const iox::capro::ServiceDescription first{"Radar", "Front", "Objects"};
+    const iox::capro::ServiceDescription second{
+        "Radar", "Front", "Objects", {1U, 2U, 3U, 4U}, iox::capro::Interfaces::DDS};
+
+    EXPECT_THAT(iox::roudi::hashServiceDescription(first), Eq(iox::roudi::hashServiceDescription(second)));
+}
+
+TEST(HashMultiIndexHash_test, ShiftedStringsOfAServiceDescriptionHaveDifferentHashes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ee1bc158-fad1-47a0-a4cd-dabde24a89bb");
+    const iox::capro::ServiceDescription first{"ab", "c", "d"};
+    const iox::capro::ServiceDescription second{"a", "bc", "d"};
+
+    EXPECT_THAT(iox::roudi::hashServiceDescription(first), Ne(iox::roudi::hashServiceDescription(second)));
+    EXPECT_THAT(iox::roudi::hashIdString("ab"), Ne(iox::roudi::hashIdString("ba")));
+}
+
+} // namespace
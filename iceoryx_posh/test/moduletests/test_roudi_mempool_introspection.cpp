@@ -72,8 +72,14 @@ class SegmentMock
         return iox::posix::PosixGroup::getGroupOfCurrentProcess();
     }
 
+    const iox::mepoo::MemoryInfo& getMemoryInfo() const
+    {
+        return memoryInfo;
+    }
+
   private:
     MePooMemoryManager_MOCK memoryManager;
+    iox::mepoo::MemoryInfo memoryInfo;
 };
 
 class SegmentManagerMock
@@ -101,6 +107,8 @@ class MemPoolIntrospectionAccess
 
     using iox::roudi::MemPoolIntrospection<MePooMemoryManager_MOCK, SegmentManagerMock, MockPublisherPortUserAccess>::
         send;
+    using iox::roudi::MemPoolIntrospection<MePooMemoryManager_MOCK, SegmentManagerMock, MockPublisherPortUserAccess>::
+        copyMemPoolInfo;
 };
 
 class MemPoolIntrospection_test : public Test
@@ -246,6 +254,32 @@ TEST_F(MemPoolIntrospection_test, Send_withSubscribers)
     EXPECT_THAT(compareMemPoolInfo(memPoolInfoContainer, chunk.sample()->front().m_mempoolInfo), Eq(true));
 }
 
+TEST_F(MemPoolIntrospection_test, CopiedMemPoolInfoContainsNumaNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3269cb57-0953-4ad5-96a5-00342cf04028");
+    EXPECT_CALL(callChecker(), offer()).Times(1);
+
+    MemPoolIntrospectionAccess introspectionAccess(
+        m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
+    EXPECT_CALL(introspectionAccess.getPublisherPort(), stopOffer()).WillRepeatedly(Return());
+
+    constexpr uint32_t NUMA_NODE{1U};
+    MemPoolInfo memPoolInfo(0, 0, 0, 0);
+    EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Invoke([&](uint32_t index) {
+        initMemPoolInfo(index, memPoolInfo);
+        return memPoolInfo;
+    }));
+
+    MemPoolInfoContainer memPoolInfoContainer;
+    introspectionAccess.copyMemPoolInfo(m_rouDiInternalMemoryManager_mock, NUMA_NODE, memPoolInfoContainer);
+
+    ASSERT_THAT(memPoolInfoContainer.size(), Eq(m_rouDiInternalMemoryManager_mock.getNumberOfMemPools()));
+    for (const auto& info : memPoolInfoContainer)
+    {
+        EXPECT_THAT(info.m_numaNode, Eq(NUMA_NODE));
+    }
+}
+
 TIMING_TEST_F(MemPoolIntrospection_test, thread, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "7112cf26-31e6-4ca4-bc8f-43fede7e456f");
     EXPECT_CALL(callChecker(), offer()).Times(1);
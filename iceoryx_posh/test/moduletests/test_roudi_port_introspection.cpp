@@ -35,6 +35,7 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
 {
   public:
     using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendPortData;
+    using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberLatencyData;
 
     void sendThroughputData()
     {
@@ -48,6 +49,10 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
     {
         return this->m_publisherPortThroughput;
     }
+    iox::optional<PublisherPort>& getPublisherPortSubscriberLatency()
+    {
+        return this->m_publisherPortSubscriberLatency;
+    }
 };
 
 class PortIntrospection_test : public Test
@@ -64,6 +69,7 @@ class PortIntrospection_test : public Test
     void SetUp() override
     {
         ASSERT_THAT(m_introspectionAccess.registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                                std::move(m_mockPublisherPortUserIntrospection),
                                                                 std::move(m_mockPublisherPortUserIntrospection),
                                                                 std::move(m_mockPublisherPortUserIntrospection)),
                     Eq(true));
@@ -145,11 +151,13 @@ TEST_F(PortIntrospection_test, registerPublisherPort)
         new iox::roudi::PortIntrospection<MockPublisherPortUser, MockSubscriberPortUser>);
 
     EXPECT_THAT(introspection->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                     std::move(m_mockPublisherPortUserIntrospection),
                                                      std::move(m_mockPublisherPortUserIntrospection),
                                                      std::move(m_mockPublisherPortUserIntrospection)),
                 Eq(true));
 
     EXPECT_THAT(introspection->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection2),
+                                                     std::move(m_mockPublisherPortUserIntrospection2),
                                                      std::move(m_mockPublisherPortUserIntrospection2),
                                                      std::move(m_mockPublisherPortUserIntrospection2)),
                 Eq(false));
@@ -443,6 +451,62 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
 }
 
 
+TEST_F(PortIntrospection_test, SendSubscriberLatencyDataPublishesAndResetsTheRecordedLatencies)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "570c95f5-d55d-4ccb-8a74-eb7aa77e39df");
+    using Topic = iox::roudi::SubscriberLatencyIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::capro::ServiceDescription service("Hypno", "toad", "latency");
+    iox::popo::SubscriberPortData subscriberPortData{service,
+                                                     iox::RuntimeName_t("name"),
+                                                     iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                     iox::popo::SubscriberOptions()};
+    ASSERT_THAT(m_introspectionAccess.addSubscriber(subscriberPortData), Eq(true));
+
+    // latencies from 1us to 1ms
+    constexpr uint64_t NUMBER_OF_SAMPLES{1000U};
+    constexpr uint64_t LATENCY_STEP{1000U};
+    for (uint64_t i = 1U; i <= NUMBER_OF_SAMPLES; ++i)
+    {
+        subscriberPortData.m_chunkReceiverData.m_latencyHistogram.record(i * LATENCY_STEP);
+    }
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberLatency().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberLatency().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendSubscriberLatencyData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->m_latencyList.size(), Eq(1U));
+    {
+        // the percentiles are the upper bounds of the histogram buckets and therefore slightly overestimated
+        const auto& latencyData = chunk->sample()->m_latencyList[0];
+        constexpr uint64_t MAX_LATENCY{NUMBER_OF_SAMPLES * LATENCY_STEP};
+        EXPECT_THAT(latencyData.m_numberOfSamples, Eq(NUMBER_OF_SAMPLES));
+        EXPECT_THAT(latencyData.m_maxLatencyInNanoseconds, Eq(MAX_LATENCY));
+        EXPECT_THAT(latencyData.m_p50LatencyInNanoseconds, AllOf(Ge(MAX_LATENCY / 2U), Le(MAX_LATENCY * 9U / 16U)));
+        EXPECT_THAT(latencyData.m_p99LatencyInNanoseconds, AllOf(Ge(MAX_LATENCY * 99U / 100U), Le(MAX_LATENCY)));
+        EXPECT_THAT(latencyData.m_p999LatencyInNanoseconds, AllOf(Ge(MAX_LATENCY * 999U / 1000U), Le(MAX_LATENCY)));
+    }
+
+    chunkWasSent = false;
+    m_introspectionAccess.sendSubscriberLatencyData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->m_latencyList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_latencyList[0].m_numberOfSamples, Eq(0U));
+    EXPECT_THAT(chunk->sample()->m_latencyList[0].m_maxLatencyInNanoseconds, Eq(0U));
+
+    chunk->sample()->~SubscriberLatencyIntrospectionFieldTopic();
+}
+
 TEST_F(PortIntrospection_test, Thread)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ae5b252d-0060-4bb7-a193-0c2ae0ebbb7a");
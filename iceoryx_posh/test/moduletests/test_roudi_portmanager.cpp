@@ -115,6 +115,36 @@ TEST_F(PortManager_test, DoDiscoveryWithDiscoveryLoopInBetweenCreationOfSubscrib
     EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, DoDiscoveryProcessesOnlyPortsWhichRequestedADiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ddd45548-0bfd-4b2b-afb1-769da689c5dc");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    auto subscriberPortData =
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value();
+    SubscriberPortUser subscriber(subscriberPortData);
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    publisher.offer();
+    m_portManager->doDiscovery();
+
+    // the subscribe request is not announced to RouDi and therefore not processed
+    subscriberPortData->m_subscribeRequested.store(true);
+    m_portManager->doDiscovery();
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::NOT_SUBSCRIBED));
+
+    subscriber.requestDiscovery();
+    m_portManager->doDiscovery();
+
+    EXPECT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
 TEST_F(PortManager_test, DoDiscoveryWithSubscribersCreatedBeforeAndAfterCreationOfPublisher)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b1c5bf2e-066e-4f01-b92a-edab9197a5dd");
@@ -325,6 +325,39 @@ TEST_F(PortPool_test, RemovePublisherPortIsSuccessful)
     EXPECT_EQ(publisherPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetPublisherPortDataListWithServiceDescriptionReturnsOnlyMatchingPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4cac9131-f12c-4267-95cf-5245b777c966");
+    auto firstPublisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto secondPublisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_runtimeName, m_publisherOptions);
+    const ServiceDescription otherServiceDescription{"other", "instance1", "event1"};
+    ASSERT_FALSE(
+        sut.addPublisherPort(otherServiceDescription, &m_memoryManager, m_runtimeName, m_publisherOptions).has_error());
+
+    auto publisherPortDataList = sut.getPublisherPortDataList(m_serviceDescription);
+    ASSERT_EQ(publisherPortDataList.size(), 2U);
+    EXPECT_EQ(publisherPortDataList[0], firstPublisherPort.value());
+    EXPECT_EQ(publisherPortDataList[1], secondPublisherPort.value());
+
+    sut.removePublisherPort(firstPublisherPort.value());
+    publisherPortDataList = sut.getPublisherPortDataList(m_serviceDescription);
+    ASSERT_EQ(publisherPortDataList.size(), 1U);
+    EXPECT_EQ(publisherPortDataList[0], secondPublisherPort.value());
+}
+
+TEST_F(PortPool_test, AddedPublisherPortIsConnectedToTheDiscoveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "81c414dd-3f55-4c6c-8d14-7172aff3e245");
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+
+    EXPECT_EQ(publisherPort.value()->m_discoveryConditionVariable.get(), &sut.getDiscoveryConditionVariable());
+    EXPECT_TRUE(publisherPort.value()->m_discoveryRequested.load());
+    EXPECT_TRUE(sut.getDiscoveryConditionVariable().m_wasNotified.load());
+}
+
 // END PublisherPort tests
 
 // BEGIN SubscriberPort tests
@@ -667,6 +700,25 @@ TEST_F(PortPool_test, RemoveServerPortIsSuccessful)
     EXPECT_EQ(serverPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetServerPortDataListWithServiceDescriptionReturnsOnlyMatchingPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "402035c1-cf19-49bd-aca4-74b152a1fa76");
+    auto serverPort =
+        sut.addServerPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_serverOptions, m_memoryInfo);
+    const ServiceDescription otherServiceDescription{"other", "instance1", "event1"};
+    ASSERT_FALSE(
+        sut.addServerPort(otherServiceDescription, &m_memoryManager, m_runtimeName, m_serverOptions, m_memoryInfo)
+            .has_error());
+
+    auto serverPortDataList = sut.getServerPortDataList(m_serviceDescription);
+    ASSERT_EQ(serverPortDataList.size(), 1U);
+    EXPECT_EQ(serverPortDataList[0], serverPort.value());
+    EXPECT_EQ(sut.getClientPortDataList(m_serviceDescription).size(), 0U);
+
+    sut.removeServerPort(serverPort.value());
+    EXPECT_EQ(sut.getServerPortDataList(m_serviceDescription).size(), 0U);
+}
+
 // END ServerPort tests
 
 // BEGIN InterfacePort tests
@@ -79,6 +79,28 @@ TEST_F(PosixShmMemoryProvider_Test, CreateMemory)
     EXPECT_CALL(memoryBlock1, destroy());
 }
 
+TEST_F(PosixShmMemoryProvider_Test, CreatePrefaultedMemoryWithHugePagesAndLockedInMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "004f400f-8cbd-4ae4-b271-394558f4a8d5");
+    iox::mepoo::SegmentMemoryOptions memoryOptions;
+    memoryOptions.hugePages = true;
+    memoryOptions.prefault = true;
+    memoryOptions.lockInMemory = true;
+    PosixShmMemoryProvider sut(
+        TEST_SHM_NAME, iox::posix::AccessMode::READ_WRITE, iox::posix::OpenMode::PURGE_AND_CREATE, memoryOptions);
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{4096};
+    uint64_t MEMORY_ALIGNMENT{8};
+    EXPECT_CALL(memoryBlock1, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    EXPECT_THAT(sut.create().has_error(), Eq(false));
+
+    EXPECT_THAT(shmExists(), Eq(true));
+
+    EXPECT_CALL(memoryBlock1, destroy());
+}
+
 TEST_F(PosixShmMemoryProvider_Test, DestroyMemory)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f864b99c-373d-4954-ac8b-61acc3c9c555");
@@ -23,7 +23,9 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <memory>
 #include <random>
+#include <tuple>
 #include <vector>
 
 namespace
@@ -704,4 +706,140 @@ TYPED_TEST(ServiceRegistry_test, FindWithMixOfPublishersAndServersWorks)
     EXPECT_EQ(filtered[1].serviceDescription, service3);
 }
 
+TYPED_TEST(ServiceRegistry_test, FindWithWildcardsReturnsTheMatchingEntriesAfterEntriesWereReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0b18c00-0da9-4b73-ad43-ea3d8da0b6e2");
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("a", "x", "c");
+    iox::capro::ServiceDescription service3("a", "b", "d");
+    iox::capro::ServiceDescription service4("e", "b", "c");
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+    ASSERT_FALSE(this->sut.add(service3).has_error());
+    this->sut.remove(service1);
+    // reuses the entry of service1
+    ASSERT_FALSE(this->sut.add(service4).has_error());
+
+    this->find(iox::capro::Wildcard, iox::capro::IdString_t("b"), iox::capro::IdString_t("c"));
+    ASSERT_THAT(this->searchResult.size(), Eq(1U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(service4));
+
+    this->find(iox::capro::IdString_t("a"), iox::capro::Wildcard, iox::capro::Wildcard);
+    ASSERT_THAT(this->searchResult.size(), Eq(2U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(service2));
+    EXPECT_THAT(this->searchResult[1].serviceDescription, Eq(service3));
+
+    this->find(iox::capro::IdString_t("a"), iox::capro::IdString_t("b"), iox::capro::IdString_t("c"));
+    EXPECT_THAT(this->searchResult.size(), Eq(0U));
+}
+
+TYPED_TEST(ServiceRegistry_test, CopyOfTheRegistryFindsTheSameEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d3a16f92-f646-4cde-976e-d6386551467c");
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("a", "x", "c");
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+
+    // the registry is copied into the shared memory to be published to the applications
+    std::unique_ptr<ServiceRegistry> copy{new ServiceRegistry(this->sut.registry)};
+    this->sut.registry.purge(service1);
+
+    copy->find(iox::capro::IdString_t("a"),
+               iox::capro::Wildcard,
+               iox::capro::IdString_t("c"),
+               [&](const ServiceRegistry::ServiceDescriptionEntry& entry) { this->searchResult.push_back(entry); });
+    ASSERT_THAT(this->searchResult.size(), Eq(2U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(service1));
+    EXPECT_THAT(this->searchResult[1].serviceDescription, Eq(service2));
+}
+
+TEST(ServiceRegistryChange_test, EveryModificationIncrementsTheGeneration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf288418-be41-4908-a838-c10c25f3551b");
+    std::unique_ptr<ServiceRegistry> sut{new ServiceRegistry};
+    const ServiceDescription service("a", "b", "c");
+    EXPECT_THAT(sut->generation(), Eq(0U));
+
+    ASSERT_FALSE(sut->addPublisher(service).has_error());
+    EXPECT_THAT(sut->generation(), Eq(1U));
+    ASSERT_FALSE(sut->addServer(service).has_error());
+    EXPECT_THAT(sut->generation(), Eq(2U));
+    sut->removeServer(service);
+    EXPECT_THAT(sut->generation(), Eq(3U));
+    // also a removal without an effect is a change since it has no effect on a copy either
+    sut->removeServer(service);
+    EXPECT_THAT(sut->generation(), Eq(4U));
+    sut->purge(service);
+    EXPECT_THAT(sut->generation(), Eq(5U));
+}
+
+TEST(ServiceRegistryChange_test, ApplyingTheChangesToACopyResultsInTheSameRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cc723507-6fac-48d6-b869-959d521ed141");
+    using Operation = ServiceRegistry::Change::Operation;
+    std::unique_ptr<ServiceRegistry> sut{new ServiceRegistry};
+    std::vector<ServiceRegistry::Change> changes;
+    auto record = [&](const Operation operation, const ServiceDescription& service) {
+        changes.emplace_back(sut->generation(), operation, service);
+    };
+
+    const ServiceDescription service1("a", "b", "c");
+    const ServiceDescription service2("a", "x", "c");
+    const ServiceDescription service3("e", "b", "c");
+    ASSERT_FALSE(sut->addPublisher(service1).has_error());
+    record(Operation::ADD_PUBLISHER, service1);
+    ASSERT_FALSE(sut->addServer(service2).has_error());
+    record(Operation::ADD_SERVER, service2);
+    ASSERT_FALSE(sut->addPublisher(service2).has_error());
+    record(Operation::ADD_PUBLISHER, service2);
+
+    std::unique_ptr<ServiceRegistry> copy{new ServiceRegistry(*sut)};
+
+    sut->removePublisher(service1);
+    record(Operation::REMOVE_PUBLISHER, service1);
+    ASSERT_FALSE(sut->addPublisher(service3).has_error());
+    record(Operation::ADD_PUBLISHER, service3);
+    sut->removeServer(service2);
+    record(Operation::REMOVE_SERVER, service2);
+    sut->purge(service3);
+    record(Operation::PURGE, service3);
+
+    for (const auto& change : changes)
+    {
+        // the changes which are already contained in the copy are rejected
+        EXPECT_THAT(copy->apply(change), Eq(change.generation > 3U));
+    }
+
+    auto entriesOf = [](const ServiceRegistry& registry) {
+        std::vector<std::tuple<ServiceDescription, uint64_t, uint64_t>> entries;
+        registry.forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+            entries.emplace_back(entry.serviceDescription, entry.publisherCount, entry.serverCount);
+        });
+        return entries;
+    };
+    EXPECT_THAT(copy->generation(), Eq(sut->generation()));
+    EXPECT_THAT(entriesOf(*copy), ContainerEq(entriesOf(*sut)));
+}
+
+TEST(ServiceRegistryChange_test, ApplyRejectsAChangeWhichDoesNotFollowTheCurrentGeneration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd6b6342-65c9-4f51-ac44-a72a5dc22a35");
+    std::unique_ptr<ServiceRegistry> sut{new ServiceRegistry};
+    const ServiceDescription service("a", "b", "c");
+
+    EXPECT_FALSE(sut->apply({2U, ServiceRegistry::Change::Operation::ADD_PUBLISHER, service}));
+    EXPECT_THAT(sut->generation(), Eq(0U));
+
+    EXPECT_TRUE(sut->apply({1U, ServiceRegistry::Change::Operation::ADD_PUBLISHER, service}));
+    EXPECT_THAT(sut->generation(), Eq(1U));
+
+    sut->find(IdString_t("a"), iox::nullopt, iox::nullopt, [&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+        EXPECT_THAT(entry.serviceDescription, Eq(service));
+        EXPECT_THAT(entry.publisherCount, Eq(1U));
+    });
+}
+
 } // namespace
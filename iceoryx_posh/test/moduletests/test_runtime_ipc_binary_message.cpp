@@ -0,0 +1,293 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+
+#include "test.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+using namespace iox::units::duration_literals;
+
+class IpcBinaryMessage_test : public Test
+{
+  public:
+    /// @brief transfers the message like an IPC channel would do it
+    static IpcBinaryMessage transfer(const IpcBinaryMessage& message)
+    {
+        IpcBinaryMessage receivedMessage;
+        EXPECT_TRUE(receivedMessage.setMessage(message.data(), message.size()));
+        return receivedMessage;
+    }
+
+    const RuntimeName_t m_runtimeName{"hypnotoad"};
+};
+
+TEST_F(IpcBinaryMessage_test, DefaultConstructedMessageIsInvalid)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f740bf9-e446-4e4c-b60f-3dc4d0abee03");
+    IpcBinaryMessage sut;
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(sut.getMessageType(), Eq(IpcMessageType::NOTYPE));
+    EXPECT_THAT(sut.getNumberOfEntries(), Eq(0U));
+}
+
+TEST_F(IpcBinaryMessage_test, HeaderAndRuntimeNameAreTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "310eb34e-3697-4c3d-960f-346a518f3514");
+    IpcBinaryMessage message(IpcMessageType::CREATE_PORTS, m_runtimeName);
+    ASSERT_TRUE(message.isValid());
+
+    auto sut = transfer(message);
+
+    EXPECT_TRUE(sut.isValid());
+    EXPECT_THAT(sut.getMessageType(), Eq(IpcMessageType::CREATE_PORTS));
+    EXPECT_THAT(sut.getProtocolVersion(), Eq(IpcBinaryMessage::PROTOCOL_VERSION));
+    EXPECT_THAT(sut.getRuntimeName(), Eq(m_runtimeName));
+    EXPECT_THAT(sut.getNumberOfEntries(), Eq(0U));
+}
+
+TEST_F(IpcBinaryMessage_test, ArithmeticValuesAndEnumsAreTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a0f0dcb-55a3-480a-8218-9b640a47a935");
+    IpcBinaryMessage message(IpcMessageType::CREATE_PORTS, m_runtimeName);
+    message << uint8_t{13U} << int64_t{-42} << true << 0.25 << IpcMessageErrorType::PUBLISHER_LIST_FULL;
+
+    auto sut = transfer(message);
+    uint8_t smallValue{0U};
+    int64_t negativeValue{0};
+    bool flag{false};
+    double floatingPoint{0.0};
+    IpcMessageErrorType errorType{IpcMessageErrorType::NOTYPE};
+    sut >> smallValue >> negativeValue >> flag >> floatingPoint >> errorType;
+
+    EXPECT_TRUE(sut.isValid());
+    EXPECT_THAT(smallValue, Eq(13U));
+    EXPECT_THAT(negativeValue, Eq(-42));
+    EXPECT_TRUE(flag);
+    EXPECT_THAT(floatingPoint, DoubleEq(0.25));
+    EXPECT_THAT(errorType, Eq(IpcMessageErrorType::PUBLISHER_LIST_FULL));
+}
+
+TEST_F(IpcBinaryMessage_test, StringsWithSeparatorsAreTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d46e5957-3643-4aa5-94a9-7a1d19109128");
+    IpcBinaryMessage message(IpcMessageType::CREATE_PORTS, m_runtimeName);
+    message << NodeName_t("all, the, commas") << NodeName_t("");
+
+    auto sut = transfer(message);
+    NodeName_t first;
+    NodeName_t second{"not empty"};
+    sut >> first >> second;
+
+    EXPECT_TRUE(sut.isValid());
+    EXPECT_THAT(first, Eq(NodeName_t("all, the, commas")));
+    EXPECT_TRUE(second.empty());
+}
+
+TEST_F(IpcBinaryMessage_test, StringWhichDoesNotFitIntoTheTargetInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b06ca326-9b38-4522-90b4-52a1cd5f2f09");
+    IpcBinaryMessage message(IpcMessageType::CREATE_PORTS, m_runtimeName);
+    message << string<10>("0123456789");
+
+    auto sut = transfer(message);
+    string<5> tooSmall;
+    sut >> tooSmall;
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryMessage_test, PortCreationRequestIsTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6412bdc2-946f-44ad-8cfe-9a3c49d6fe10");
+    capro::ServiceDescription service{"Radar", "FrontLeft", "Objects", {1U, 2U, 3U, 4U}, capro::Interfaces::DDS};
+    service.setLocal();
+    popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 7U;
+    publisherOptions.nodeName = "node";
+    publisherOptions.offerOnCreate = false;
+    publisherOptions.subscriberTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    publisherOptions.subscriberTooSlowTimeout = 42_ms;
+    publisherOptions.chunkMagazineCapacity = 3U;
+    publisherOptions.stampSendTime = true;
+    publisherOptions.numaNode = 1U;
+    popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 11U;
+    subscriberOptions.historyRequest = 5U;
+    subscriberOptions.queueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    subscriberOptions.requiresPublisherHistorySupport = true;
+    popo::ClientOptions clientOptions;
+    clientOptions.responseQueueCapacity = 2U;
+    clientOptions.connectOnCreate = false;
+    clientOptions.serverTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    popo::ServerOptions serverOptions;
+    serverOptions.requestQueueCapacity = 9U;
+    serverOptions.requestQueueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    PortConfigInfo portConfigInfo{1U, 2U, 3U};
+
+    IpcBinaryMessage message(IpcMessageType::CREATE_PORTS, m_runtimeName);
+    message.addEntry(IpcMessageType::CREATE_PUBLISHER) << service << publisherOptions << portConfigInfo;
+    message.addEntry(IpcMessageType::CREATE_SUBSCRIBER) << service << subscriberOptions << portConfigInfo;
+    message.addEntry(IpcMessageType::CREATE_CLIENT) << service << clientOptions << portConfigInfo;
+    message.addEntry(IpcMessageType::CREATE_SERVER) << service << serverOptions << portConfigInfo;
+    ASSERT_TRUE(message.isValid());
+
+    auto sut = transfer(message);
+    ASSERT_THAT(sut.getNumberOfEntries(), Eq(4U));
+
+    IpcMessageType entryType{IpcMessageType::NOTYPE};
+    capro::ServiceDescription receivedService;
+    popo::PublisherOptions receivedPublisherOptions;
+    popo::SubscriberOptions receivedSubscriberOptions;
+    popo::ClientOptions receivedClientOptions;
+    popo::ServerOptions receivedServerOptions;
+    PortConfigInfo receivedPortConfigInfo;
+
+    sut >> entryType >> receivedService >> receivedPublisherOptions >> receivedPortConfigInfo;
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(entryType, Eq(IpcMessageType::CREATE_PUBLISHER));
+    EXPECT_THAT(receivedService, Eq(service));
+    EXPECT_THAT(receivedService.getClassHash(), Eq(service.getClassHash()));
+    EXPECT_THAT(receivedService.getScope(), Eq(capro::Scope::LOCAL));
+    EXPECT_THAT(receivedService.getSourceInterface(), Eq(capro::Interfaces::DDS));
+    EXPECT_THAT(receivedPublisherOptions.historyCapacity, Eq(publisherOptions.historyCapacity));
+    EXPECT_THAT(receivedPublisherOptions.nodeName, Eq(publisherOptions.nodeName));
+    EXPECT_THAT(receivedPublisherOptions.offerOnCreate, Eq(publisherOptions.offerOnCreate));
+    EXPECT_THAT(receivedPublisherOptions.subscriberTooSlowPolicy, Eq(publisherOptions.subscriberTooSlowPolicy));
+    EXPECT_THAT(receivedPublisherOptions.subscriberTooSlowTimeout, Eq(publisherOptions.subscriberTooSlowTimeout));
+    EXPECT_THAT(receivedPublisherOptions.chunkMagazineCapacity, Eq(publisherOptions.chunkMagazineCapacity));
+    EXPECT_THAT(receivedPublisherOptions.stampSendTime, Eq(publisherOptions.stampSendTime));
+    EXPECT_THAT(receivedPublisherOptions.numaNode, Eq(publisherOptions.numaNode));
+    EXPECT_THAT(receivedPortConfigInfo, Eq(portConfigInfo));
+
+    sut >> entryType >> receivedService >> receivedSubscriberOptions >> receivedPortConfigInfo;
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(entryType, Eq(IpcMessageType::CREATE_SUBSCRIBER));
+    EXPECT_THAT(receivedSubscriberOptions.queueCapacity, Eq(subscriberOptions.queueCapacity));
+    EXPECT_THAT(receivedSubscriberOptions.historyRequest, Eq(subscriberOptions.historyRequest));
+    EXPECT_THAT(receivedSubscriberOptions.queueFullPolicy, Eq(subscriberOptions.queueFullPolicy));
+    EXPECT_THAT(receivedSubscriberOptions.requiresPublisherHistorySupport,
+                Eq(subscriberOptions.requiresPublisherHistorySupport));
+
+    sut >> entryType >> receivedService >> receivedClientOptions >> receivedPortConfigInfo;
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(entryType, Eq(IpcMessageType::CREATE_CLIENT));
+    EXPECT_THAT(receivedClientOptions, Eq(clientOptions));
+
+    sut >> entryType >> receivedService >> receivedServerOptions >> receivedPortConfigInfo;
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(entryType, Eq(IpcMessageType::CREATE_SERVER));
+    EXPECT_THAT(receivedServerOptions, Eq(serverOptions));
+}
+
+TEST_F(IpcBinaryMessage_test, InfiniteTimeoutOfPublisherOptionsIsTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4138f982-2cd2-4849-a3e2-63f0c4d045ca");
+    IpcBinaryMessage message(IpcMessageType::CREATE_PORTS, m_runtimeName);
+    message << popo::PublisherOptions();
+
+    auto sut = transfer(message);
+    popo::PublisherOptions receivedPublisherOptions;
+    receivedPublisherOptions.subscriberTooSlowTimeout = 1_s;
+    sut >> receivedPublisherOptions;
+
+    EXPECT_TRUE(sut.isValid());
+    EXPECT_THAT(receivedPublisherOptions.subscriberTooSlowTimeout, Eq(units::Duration::max()));
+}
+
+TEST_F(IpcBinaryMessage_test, ExceedingTheCapacityInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6870dd7c-5ed3-4946-852c-cb76d5bf657a");
+    IpcBinaryMessage sut(IpcMessageType::CREATE_PORTS, m_runtimeName);
+
+    while (sut.getFreeCapacity() >= sizeof(uint64_t))
+    {
+        sut << uint64_t{1U};
+        ASSERT_TRUE(sut.isValid());
+    }
+    sut << uint64_t{1U};
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_THAT(sut.size(), Le(IpcBinaryMessage::CAPACITY));
+}
+
+TEST_F(IpcBinaryMessage_test, ReadingMoreThanWasWrittenInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d2705b6f-0039-4553-b3d4-ecbad2a2dd57");
+    IpcBinaryMessage message(IpcMessageType::CREATE_PORTS, m_runtimeName);
+    message << uint32_t{1U};
+
+    auto sut = transfer(message);
+    uint64_t value{0U};
+    sut >> value;
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryMessage_test, ServiceDescriptionWithInvalidScopeInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "337be721-0c75-48bc-978c-7e6ffa614e6d");
+    IpcBinaryMessage message(IpcMessageType::CREATE_PORTS, m_runtimeName);
+    message << capro::IdString_t("a") << capro::IdString_t("b") << capro::IdString_t("c") << uint32_t{0U}
+            << uint32_t{0U} << uint32_t{0U} << uint32_t{0U} << capro::Scope::INVALID << capro::Interfaces::INTERNAL;
+
+    auto sut = transfer(message);
+    capro::ServiceDescription service;
+    sut >> service;
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryMessage_test, SetMessageWithTextMessageFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1637923-dd85-4bcd-9f31-e02880f4a3c1");
+    constexpr const char TEXT_MESSAGE[] = "1,hypnotoad,";
+    IpcBinaryMessage sut;
+
+    EXPECT_FALSE(IpcBinaryMessage::isBinaryMessage(TEXT_MESSAGE, sizeof(TEXT_MESSAGE)));
+    EXPECT_FALSE(sut.setMessage(TEXT_MESSAGE, sizeof(TEXT_MESSAGE)));
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryMessage_test, MessageWithOtherProtocolVersionIsInvalidButProvidesTheHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5fdd3352-a3ec-44e4-9d36-65fc64173edb");
+    IpcBinaryMessage message(IpcMessageType::CREATE_PORTS, m_runtimeName);
+    message << uint64_t{1U};
+    std::vector<char> rawMessage(message.data(), message.data() + message.size());
+    constexpr uint64_t VERSION_POSITION{sizeof(IpcBinaryMessage::MAGIC)};
+    const uint16_t otherVersion = IpcBinaryMessage::PROTOCOL_VERSION + 1U;
+    std::memcpy(&rawMessage[VERSION_POSITION], &otherVersion, sizeof(otherVersion));
+
+    IpcBinaryMessage sut;
+    EXPECT_TRUE(sut.setMessage(rawMessage.data(), rawMessage.size()));
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_THAT(sut.getProtocolVersion(), Eq(otherVersion));
+    EXPECT_THAT(sut.getMessageType(), Eq(IpcMessageType::CREATE_PORTS));
+    EXPECT_THAT(sut.getRuntimeName(), Eq(m_runtimeName));
+}
+
+} // namespace
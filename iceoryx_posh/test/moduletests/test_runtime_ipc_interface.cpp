@@ -20,6 +20,7 @@
 #include "iceoryx_dust/posix_wrapper/named_pipe.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/unix_domain_socket.hpp"
 #include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
 
 #include "test.hpp"
@@ -337,4 +338,76 @@ TYPED_TEST(IpcInterface_test, TimedReceiveWorks)
     auto timeDiff = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
     EXPECT_GE(into<units::Duration>(timeDiff), timeout);
 }
+
+TYPED_TEST(IpcInterface_test, SendAndReceiveBinaryMessageWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd19e8fb-e26f-4e05-8e48-38ac8c7daca2");
+
+    runtime::IpcBinaryMessage message(runtime::IpcMessageType::CREATE_PORTS, "binary_runtime");
+    // the zeros of the values must not truncate the message
+    message.addEntry(runtime::IpcMessageType::CREATE_PUBLISHER) << uint64_t{0U} << uint64_t{42U};
+    ASSERT_TRUE(this->client->send(message));
+
+    runtime::IpcBinaryMessage receivedMessage;
+    ASSERT_TRUE(this->server->receive(receivedMessage));
+
+    EXPECT_THAT(receivedMessage.getMessageType(), Eq(runtime::IpcMessageType::CREATE_PORTS));
+    EXPECT_THAT(receivedMessage.getRuntimeName(), Eq(RuntimeName_t("binary_runtime")));
+    EXPECT_THAT(receivedMessage.getNumberOfEntries(), Eq(1U));
+    runtime::IpcMessageType entryType{runtime::IpcMessageType::NOTYPE};
+    uint64_t first{1U};
+    uint64_t second{0U};
+    receivedMessage >> entryType >> first >> second;
+    EXPECT_TRUE(receivedMessage.isValid());
+    EXPECT_THAT(entryType, Eq(runtime::IpcMessageType::CREATE_PUBLISHER));
+    EXPECT_THAT(first, Eq(0U));
+    EXPECT_THAT(second, Eq(42U));
+}
+
+TYPED_TEST(IpcInterface_test, TimedReceiveOfTextOrBinaryMessageReturnsTheEncoding)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e599029-0e40-4579-848f-9381fdc844f5");
+
+    runtime::IpcMessage textMessage;
+    textMessage << "text"
+                << "message";
+    ASSERT_TRUE(this->client->send(textMessage));
+    runtime::IpcBinaryMessage binaryMessage(runtime::IpcMessageType::CREATE_PORTS, "binary_runtime");
+    ASSERT_TRUE(this->client->send(binaryMessage));
+
+    runtime::IpcMessage receivedTextMessage;
+    runtime::IpcBinaryMessage receivedBinaryMessage;
+    auto encoding = this->server->timedReceive(100_ms, receivedTextMessage, receivedBinaryMessage);
+    ASSERT_TRUE(encoding.has_value());
+    EXPECT_THAT(*encoding, Eq(runtime::IpcMessageEncoding::TEXT));
+    EXPECT_THAT(receivedTextMessage, Eq(textMessage));
+
+    encoding = this->server->timedReceive(100_ms, receivedTextMessage, receivedBinaryMessage);
+    ASSERT_TRUE(encoding.has_value());
+    EXPECT_THAT(*encoding, Eq(runtime::IpcMessageEncoding::BINARY));
+    EXPECT_THAT(receivedBinaryMessage.getRuntimeName(), Eq(RuntimeName_t("binary_runtime")));
+
+    EXPECT_FALSE(this->server->timedReceive(100_ms, receivedTextMessage, receivedBinaryMessage).has_value());
+}
+
+TYPED_TEST(IpcInterface_test, ReceivingTextMessageAsBinaryMessageFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f128947b-d01e-4b3c-9a34-80690be649c8");
+
+    runtime::IpcMessage textMessage;
+    textMessage << "no binary message";
+    ASSERT_TRUE(this->client->send(textMessage));
+
+    runtime::IpcBinaryMessage receivedMessage;
+    EXPECT_FALSE(this->server->timedReceive(100_ms, receivedMessage));
+    EXPECT_FALSE(receivedMessage.isValid());
+}
+
+TYPED_TEST(IpcInterface_test, SendingInvalidBinaryMessageFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a747369e-d619-4fa3-bee6-b0b8c4846052");
+
+    runtime::IpcBinaryMessage message;
+    EXPECT_FALSE(this->client->send(message));
+}
 } // namespace
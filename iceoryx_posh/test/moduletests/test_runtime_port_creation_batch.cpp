@@ -0,0 +1,129 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_creation_batch.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+
+class PortCreationBatch_test : public Test
+{
+  public:
+    const capro::ServiceDescription m_service{"Money", "For", "Nothing"};
+    PortCreationBatch sut;
+};
+
+TEST_F(PortCreationBatch_test, NewBatchIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e32927d3-8552-4d1d-993b-5d9d66196795");
+    EXPECT_TRUE(sut.empty());
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(PortCreationBatch_test, AddedRequestsGetConsecutiveIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "91105bfe-ef33-419f-bcdb-40326457b764");
+    auto publisherIndex = sut.addPublisher(m_service);
+    auto subscriberIndex = sut.addSubscriber(m_service);
+    auto clientIndex = sut.addClient(m_service);
+    auto serverIndex = sut.addServer(m_service);
+
+    ASSERT_TRUE(publisherIndex.has_value());
+    ASSERT_TRUE(subscriberIndex.has_value());
+    ASSERT_TRUE(clientIndex.has_value());
+    ASSERT_TRUE(serverIndex.has_value());
+    EXPECT_THAT(publisherIndex.value(), Eq(0U));
+    EXPECT_THAT(subscriberIndex.value(), Eq(1U));
+    EXPECT_THAT(clientIndex.value(), Eq(2U));
+    EXPECT_THAT(serverIndex.value(), Eq(3U));
+    EXPECT_FALSE(sut.empty());
+    EXPECT_THAT(sut.size(), Eq(4U));
+}
+
+TEST_F(PortCreationBatch_test, PortsAreNotAvailableBeforeTheBatchIsSentToRouDi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f688300-5b55-45ad-9eb0-6214a3e9c905");
+    auto publisherIndex = sut.addPublisher(m_service);
+    auto subscriberIndex = sut.addSubscriber(m_service);
+    auto clientIndex = sut.addClient(m_service);
+    auto serverIndex = sut.addServer(m_service);
+
+    auto publisherPort = sut.getPublisher(publisherIndex.value());
+    auto subscriberPort = sut.getSubscriber(subscriberIndex.value());
+    auto clientPort = sut.getClient(clientIndex.value());
+    auto serverPort = sut.getServer(serverIndex.value());
+
+    ASSERT_TRUE(publisherPort.has_error());
+    ASSERT_TRUE(subscriberPort.has_error());
+    ASSERT_TRUE(clientPort.has_error());
+    ASSERT_TRUE(serverPort.has_error());
+    EXPECT_THAT(publisherPort.get_error(), Eq(IpcMessageErrorType::PORT_CREATION_NOT_REQUESTED));
+    EXPECT_THAT(subscriberPort.get_error(), Eq(IpcMessageErrorType::PORT_CREATION_NOT_REQUESTED));
+    EXPECT_THAT(clientPort.get_error(), Eq(IpcMessageErrorType::PORT_CREATION_NOT_REQUESTED));
+    EXPECT_THAT(serverPort.get_error(), Eq(IpcMessageErrorType::PORT_CREATION_NOT_REQUESTED));
+}
+
+TEST_F(PortCreationBatch_test, AddingMoreRequestsThanTheCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "abd9f7e5-3427-4dc0-9c3d-b662dc7bc034");
+    for (uint64_t i = 0U; i < PortCreationBatch::CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.addPublisher(m_service).has_value());
+    }
+
+    EXPECT_FALSE(sut.addPublisher(m_service).has_value());
+    EXPECT_FALSE(sut.addSubscriber(m_service).has_value());
+    EXPECT_FALSE(sut.addClient(m_service).has_value());
+    EXPECT_FALSE(sut.addServer(m_service).has_value());
+    EXPECT_THAT(sut.size(), Eq(PortCreationBatch::CAPACITY));
+}
+
+TEST_F(PortCreationBatch_test, ClearRemovesAllRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4c75f0b-0b72-4e86-b2fd-9759b42eb436");
+    IOX_DISCARD_RESULT(sut.addPublisher(m_service));
+    IOX_DISCARD_RESULT(sut.addServer(m_service));
+
+    sut.clear();
+
+    EXPECT_TRUE(sut.empty());
+    auto index = sut.addClient(m_service);
+    ASSERT_TRUE(index.has_value());
+    EXPECT_THAT(index.value(), Eq(0U));
+}
+
+TEST_F(PortCreationBatch_test, AcquiringPortOfOtherTypeLeadsToTermination)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "88872620-3380-44a8-97a4-eaec8ebbbffb");
+    auto publisherIndex = sut.addPublisher(m_service);
+
+    EXPECT_DEATH(IOX_DISCARD_RESULT(sut.getSubscriber(publisherIndex.value())), ".*");
+}
+
+TEST_F(PortCreationBatch_test, AcquiringPortWithInvalidIndexLeadsToTermination)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "90f0f1c1-e60a-44e9-a6bc-26a0596e129b");
+    IOX_DISCARD_RESULT(sut.addPublisher(m_service));
+
+    EXPECT_DEATH(IOX_DISCARD_RESULT(sut.getPublisher(1U)), ".*");
+}
+
+} // namespace
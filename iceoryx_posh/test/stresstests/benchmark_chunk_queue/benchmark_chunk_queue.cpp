@@ -0,0 +1,250 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+constexpr uint32_t USER_PAYLOAD_SIZE{64U};
+/// @brief more chunks than the queue capacity, i.e. producer and consumer work on different chunk management objects
+constexpr uint32_t NUMBER_OF_CHUNKS{4U * MAX_SUBSCRIBER_QUEUE_CAPACITY};
+constexpr uint64_t NUMBER_OF_TRANSFERS{20000000U};
+constexpr uint64_t MEGABYTE{1U << 20U};
+constexpr uint64_t MEMORY_SIZE{16U * MEGABYTE};
+
+/// @brief the variant queue which was used for all subscriber queues before the SpscRing was introduced
+struct VariantQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    static constexpr bool HAS_SINGLE_PRODUCER = false;
+};
+
+/// @brief the SpscRing which is used for the subscriber queues of a 1:n build
+struct SpscRingConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    static constexpr bool HAS_SINGLE_PRODUCER = true;
+};
+
+class ChunkPool
+{
+  public:
+    ChunkPool()
+    {
+        auto chunkSettings = mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                                 .expect("Valid chunk settings");
+        m_chunks.reserve(NUMBER_OF_CHUNKS);
+        for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            auto* chunkManagement = static_cast<mepoo::ChunkManagement*>(m_chunkManagementPool.getChunk());
+            auto* chunkHeader = new (m_mempool.getChunk()) mepoo::ChunkHeader(m_mempool.getChunkSize(), chunkSettings);
+            new (chunkManagement) mepoo::ChunkManagement{chunkHeader, &m_mempool, &m_chunkManagementPool};
+            m_chunks.emplace_back(chunkManagement);
+        }
+    }
+
+    const mepoo::SharedChunk& chunk(const uint64_t index) const
+    {
+        return m_chunks[index % NUMBER_OF_CHUNKS];
+    }
+
+  private:
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+    BumpAllocator m_allocator{m_memory.get(), MEMORY_SIZE};
+    mepoo::MemPool m_mempool{
+        sizeof(mepoo::ChunkHeader) + USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS, m_allocator, m_allocator};
+    mepoo::MemPool m_chunkManagementPool{128U, NUMBER_OF_CHUNKS, m_allocator, m_allocator};
+    std::vector<mepoo::SharedChunk> m_chunks;
+};
+
+ChunkPool* chunkPool{nullptr};
+
+template <typename ChunkQueueConfig, cxx::VariantQueueTypes QueueType>
+struct ChunkQueue
+{
+    using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, ThreadSafePolicy>;
+
+    ChunkQueueData_t data{QueueFullPolicy::DISCARD_OLDEST_DATA, QueueType};
+    ChunkQueuePusher<ChunkQueueData_t> pusher{&data};
+    ChunkQueuePopper<ChunkQueueData_t> popper{&data};
+    uint64_t counter{0U};
+};
+
+using VariantFiFo_t = ChunkQueue<VariantQueueConfig, cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>;
+using VariantSoFi_t = ChunkQueue<VariantQueueConfig, cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>;
+using VariantMpsc_t = ChunkQueue<VariantQueueConfig, cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer>;
+using SpscRingFiFo_t = ChunkQueue<SpscRingConfig, cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>;
+using SpscRingSoFi_t = ChunkQueue<SpscRingConfig, cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>;
+
+VariantFiFo_t* variantFiFo{nullptr};
+VariantSoFi_t* variantSoFi{nullptr};
+VariantMpsc_t* variantMpsc{nullptr};
+SpscRingFiFo_t* ringFiFo{nullptr};
+SpscRingSoFi_t* ringSoFi{nullptr};
+
+/// @brief a push followed by a pop on the same thread, i.e. the cost of the queue operations without contention
+template <typename Queue>
+void pushAndPop(Queue& queue)
+{
+    IOX_DISCARD_RESULT(queue.pusher.push(chunkPool->chunk(queue.counter++)));
+    IOX_DISCARD_RESULT(queue.popper.tryPop());
+}
+
+void variantFiFoPushAndPop()
+{
+    pushAndPop(*variantFiFo);
+}
+
+void variantSoFiPushAndPop()
+{
+    pushAndPop(*variantSoFi);
+}
+
+void variantMpscPushAndPop()
+{
+    pushAndPop(*variantMpsc);
+}
+
+void ringFiFoPushAndPop()
+{
+    pushAndPop(*ringFiFo);
+}
+
+void ringSoFiPushAndPop()
+{
+    pushAndPop(*ringSoFi);
+}
+
+struct TransferMeasurement
+{
+    double chunksPerSecond{0.0};
+    uint64_t numberOfLostChunks{0U};
+};
+
+/// @brief a producer thread pushes chunks which are popped by a consumer thread; with a FiFo the producer retries
+/// when the queue is full, with a SoFi the oldest chunk is discarded and counted as lost
+template <typename Queue>
+TransferMeasurement measureTransfer(Queue& queue, const bool retryWhenFull)
+{
+    std::atomic<bool> producerIsRunning{true};
+    std::atomic<bool> consumerIsRunning{false};
+    uint64_t numberOfReceivedChunks{0U};
+    std::thread consumer([&] {
+        consumerIsRunning = true;
+        while (producerIsRunning || !queue.popper.empty())
+        {
+            if (queue.popper.tryPop().has_value())
+            {
+                ++numberOfReceivedChunks;
+            }
+            else
+            {
+                // gives the producer a chance to run on machines with less cores than threads
+                std::this_thread::yield();
+            }
+        }
+    });
+    while (!consumerIsRunning)
+    {
+        std::this_thread::yield();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_TRANSFERS; ++i)
+    {
+        while (!queue.pusher.push(chunkPool->chunk(i)) && retryWhenFull)
+        {
+            std::this_thread::yield();
+        }
+    }
+    producerIsRunning = false;
+    consumer.join();
+    const auto end = std::chrono::steady_clock::now();
+
+    TransferMeasurement measurement;
+    measurement.chunksPerSecond =
+        static_cast<double>(numberOfReceivedChunks) / std::chrono::duration<double>(end - start).count();
+    measurement.numberOfLostChunks = NUMBER_OF_TRANSFERS - numberOfReceivedChunks;
+    return measurement;
+}
+
+template <typename Queue>
+void printTransfer(const char* name, const bool retryWhenFull)
+{
+    auto queue = std::make_unique<Queue>();
+    const auto measurement = measureTransfer(*queue, retryWhenFull);
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(16) << compiler << " [ " << NUMBER_OF_TRANSFERS << " chunks ] " << std::fixed
+              << std::setprecision(1) << std::setw(5) << measurement.chunksPerSecond / 1000000.0 << " M/s, "
+              << std::setw(9) << measurement.numberOfLostChunks << " lost : " << name << std::endl;
+}
+
+int main()
+{
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::ERROR);
+
+    ChunkPool pool;
+    chunkPool = &pool;
+
+    auto variantFiFoQueue = std::make_unique<VariantFiFo_t>();
+    auto variantSoFiQueue = std::make_unique<VariantSoFi_t>();
+    auto variantMpscQueue = std::make_unique<VariantMpsc_t>();
+    auto ringFiFoQueue = std::make_unique<SpscRingFiFo_t>();
+    auto ringSoFiQueue = std::make_unique<SpscRingSoFi_t>();
+    variantFiFo = variantFiFoQueue.get();
+    variantSoFi = variantSoFiQueue.get();
+    variantMpsc = variantMpscQueue.get();
+    ringFiFo = ringFiFoQueue.get();
+    ringSoFi = ringSoFiQueue.get();
+
+    constexpr auto DURATION = 2_s;
+    std::cout << "push and pop on a single thread, number of calls:" << std::endl;
+    BENCHMARK(variantFiFoPushAndPop, DURATION);
+    BENCHMARK(variantSoFiPushAndPop, DURATION);
+    BENCHMARK(variantMpscPushAndPop, DURATION);
+    BENCHMARK(ringFiFoPushAndPop, DURATION);
+    BENCHMARK(ringSoFiPushAndPop, DURATION);
+
+    std::cout << std::endl << "transfer from a producer to a consumer thread, chunks per second:" << std::endl;
+    printTransfer<VariantFiFo_t>("variant FiFo_SingleProducerSingleConsumer", true);
+    printTransfer<SpscRingFiFo_t>("SpscRing REJECT_NEWEST_VALUE", true);
+    printTransfer<VariantSoFi_t>("variant SoFi_SingleProducerSingleConsumer", false);
+    printTransfer<VariantMpsc_t>("variant SoFi_MultiProducerSingleConsumer", false);
+    printTransfer<SpscRingSoFi_t>("SpscRing DISCARD_OLDEST_VALUE", false);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,135 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using iox::mepoo::MemoryManager;
+
+constexpr uint32_t NUMBER_OF_REQUESTS{4096U};
+
+std::vector<uint32_t> memPoolChunkSizes;
+std::vector<uint32_t> sizeClassToMemPoolIndex;
+std::vector<uint32_t> requiredChunkSizes;
+std::vector<iox::mepoo::ChunkSettings> chunkSettings;
+MemoryManager* memoryManager{nullptr};
+uint64_t globalCounter{0U};
+
+/// @brief the lookup of the first fitting mempool like it was done before the size class table was introduced
+void linearLookup()
+{
+    const auto requiredChunkSize = requiredChunkSizes[globalCounter % NUMBER_OF_REQUESTS];
+    uint32_t memPoolIndex{0U};
+    for (const auto chunkSize : memPoolChunkSizes)
+    {
+        if (chunkSize >= requiredChunkSize)
+        {
+            break;
+        }
+        ++memPoolIndex;
+    }
+    globalCounter += memPoolIndex + 1U;
+}
+
+/// @brief the lookup of the first fitting mempool with the size class table like it is done by the MemoryManager
+void sizeClassLookup()
+{
+    const auto requiredChunkSize = requiredChunkSizes[globalCounter % NUMBER_OF_REQUESTS];
+    uint32_t memPoolIndex = sizeClassToMemPoolIndex[MemoryManager::sizeClassIndex(requiredChunkSize)];
+    while (memPoolIndex < memPoolChunkSizes.size() && memPoolChunkSizes[memPoolIndex] < requiredChunkSize)
+    {
+        ++memPoolIndex;
+    }
+    globalCounter += memPoolIndex + 1U;
+}
+
+/// @brief acquires and releases a chunk from the MemoryManager
+void getChunkFromMemoryManager()
+{
+    memoryManager->getChunk(chunkSettings[globalCounter % NUMBER_OF_REQUESTS]).and_then([](auto&) {
+        ++globalCounter;
+    });
+}
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    // 20 mempools from 128 B up to 16 MB chunk-payload size
+    constexpr uint32_t CHUNK_COUNT{2U};
+    constexpr uint32_t MIN_CHUNK_PAYLOAD_SIZE{128U};
+    constexpr uint32_t MAX_CHUNK_PAYLOAD_SIZE{16U << 20U};
+    iox::mepoo::MePooConfig mempoolConfig;
+    for (uint32_t chunkPayloadSize = MIN_CHUNK_PAYLOAD_SIZE; chunkPayloadSize <= MAX_CHUNK_PAYLOAD_SIZE;
+         chunkPayloadSize <<= 1U)
+    {
+        mempoolConfig.addMemPool({chunkPayloadSize, CHUNK_COUNT});
+        if (chunkPayloadSize == 256U || chunkPayloadSize == 4096U)
+        {
+            mempoolConfig.addMemPool({chunkPayloadSize + (chunkPayloadSize >> 1U), CHUNK_COUNT});
+        }
+    }
+
+    const uint64_t memorySize = MemoryManager::requiredFullMemorySize(mempoolConfig);
+    void* memory = malloc(memorySize);
+    iox::BumpAllocator allocator(memory, memorySize);
+    memoryManager = new MemoryManager();
+    memoryManager->configureMemoryManager(mempoolConfig, allocator, allocator);
+
+    for (uint32_t i = 0U; i < memoryManager->getNumberOfMemPools(); ++i)
+    {
+        memPoolChunkSizes.push_back(memoryManager->getMemPoolInfo(i).m_chunkSize);
+    }
+
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClass = 0U; sizeClass < MemoryManager::NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        const auto lowerBound = MemoryManager::sizeClassLowerBound(sizeClass);
+        while (memPoolIndex < memPoolChunkSizes.size() && memPoolChunkSizes[memPoolIndex] < lowerBound)
+        {
+            ++memPoolIndex;
+        }
+        sizeClassToMemPoolIndex.push_back(memPoolIndex);
+    }
+
+    // random user-payload sizes spread over all mempools; a fixed seed keeps the runs comparable
+    std::mt19937 randomGenerator{42U};
+    std::uniform_int_distribution<uint32_t> shiftDistribution{0U, 17U};
+    std::uniform_int_distribution<uint32_t> offsetDistribution{0U, MIN_CHUNK_PAYLOAD_SIZE - 1U};
+    for (uint32_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        const uint32_t userPayloadSize =
+            (MAX_CHUNK_PAYLOAD_SIZE >> shiftDistribution(randomGenerator)) - offsetDistribution(randomGenerator);
+        auto settings = iox::mepoo::ChunkSettings::create(userPayloadSize).value();
+        chunkSettings.push_back(settings);
+        requiredChunkSizes.push_back(settings.requiredChunkSize());
+    }
+
+    BENCHMARK(linearLookup, timeout);
+    BENCHMARK(sizeClassLookup, timeout);
+    BENCHMARK(getChunkFromMemoryManager, timeout);
+
+    delete memoryManager;
+    free(memory);
+}
@@ -0,0 +1,181 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_dust/cxx/convert.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/logging.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+using namespace iox::units::duration_literals;
+
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIMES{50U};
+constexpr uint32_t DEFAULT_NUMBER_OF_PUBLISHERS_PER_RUNTIME{8U};
+constexpr uint32_t NUMBER_OF_RUNTIME_MESSAGES_WORKERS[] = {1U, 2U, 4U, 8U};
+constexpr units::Duration ROUDI_WAITING_TIMEOUT{10_s};
+constexpr std::chrono::seconds CONNECTION_TIMEOUT{60};
+
+using SubscriberPortData_t = popo::SubscriberPortUser::MemberType_t;
+
+capro::ServiceDescription serviceOfRuntime(const uint32_t runtimeIndex, const uint32_t eventIndex)
+{
+    return {"Fleet",
+            into<lossy<capro::IdString_t>>("Runtime" + std::to_string(runtimeIndex)),
+            into<lossy<capro::IdString_t>>("Event" + std::to_string(eventIndex))};
+}
+
+/// @brief requests a port like the PoshRuntime does and returns the port data from the response
+void* requestPort(runtime::IpcRuntimeInterface& ipcInterface, const runtime::IpcMessage& request)
+{
+    runtime::IpcMessage response;
+    if (!ipcInterface.sendRequestToRouDi(request, response) || response.getNumberOfElements() != 3U)
+    {
+        std::cerr << "RouDi did not create the port: '" << response.getMessage() << "'" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    segment_id_underlying_t segmentId{0U};
+    cxx::convert::fromString(response.getElementAtIndex(2U).c_str(), segmentId);
+    UntypedRelativePointer::offset_t offset{0U};
+    cxx::convert::fromString(response.getElementAtIndex(1U).c_str(), offset);
+    return UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
+}
+
+/// @brief a mock runtime speaks the IPC protocol of the PoshRuntime; it registers at RouDi, creates publishers for
+/// its own services and subscribers for the services of the next runtime
+void runMockRuntime(const uint32_t runtimeIndex,
+                    const uint32_t numberOfRuntimes,
+                    const uint32_t numberOfPublishers,
+                    std::vector<SubscriberPortData_t*>& subscribers)
+{
+    const RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>("mock_runtime_" + std::to_string(runtimeIndex))};
+    runtime::IpcRuntimeInterface ipcInterface(roudi::IPC_CHANNEL_ROUDI_NAME, runtimeName, ROUDI_WAITING_TIMEOUT);
+
+    const auto portConfigInfo = static_cast<cxx::Serialization>(runtime::PortConfigInfo()).toString();
+    for (uint32_t i = 0U; i < numberOfPublishers; ++i)
+    {
+        runtime::IpcMessage request;
+        request << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER) << runtimeName
+                << static_cast<cxx::Serialization>(serviceOfRuntime(runtimeIndex, i)).toString()
+                << popo::PublisherOptions().serialize().toString() << portConfigInfo;
+        requestPort(ipcInterface, request);
+    }
+
+    const auto otherRuntimeIndex = (runtimeIndex + 1U) % numberOfRuntimes;
+    for (uint32_t i = 0U; i < numberOfPublishers; ++i)
+    {
+        runtime::IpcMessage request;
+        request << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER) << runtimeName
+                << static_cast<cxx::Serialization>(serviceOfRuntime(otherRuntimeIndex, i)).toString()
+                << popo::SubscriberOptions().serialize().toString() << portConfigInfo;
+        subscribers.push_back(static_cast<SubscriberPortData_t*>(requestPort(ipcInterface, request)));
+    }
+}
+
+bool areAllSubscribersConnected(const std::vector<std::vector<SubscriberPortData_t*>>& subscribersOfRuntimes)
+{
+    for (const auto& subscribers : subscribersOfRuntimes)
+    {
+        for (auto subscriber : subscribers)
+        {
+            if (popo::SubscriberPortUser(subscriber).getSubscriptionState() != SubscribeState::SUBSCRIBED)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/// @brief starts RouDi, launches the mock runtimes at once and measures the time until every subscriber is connected
+/// to its publisher
+std::chrono::milliseconds measureStartup(const uint32_t numberOfRuntimeMessagesWorkers,
+                                         const uint32_t numberOfRuntimes,
+                                         const uint32_t numberOfPublishers)
+{
+    roudi::IceOryxRouDiComponents roudiComponents(RouDiConfig_t().setDefaults());
+    roudi::RouDi roudi(roudiComponents.rouDiMemoryManager,
+                       roudiComponents.portManager,
+                       roudi::RouDi::RoudiStartupParameters{roudi::MonitoringMode::OFF,
+                                                            false,
+                                                            roudi::RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
+                                                            version::CompatibilityCheckLevel::PATCH,
+                                                            roudi::PROCESS_DEFAULT_KILL_DELAY,
+                                                            numberOfRuntimeMessagesWorkers});
+
+    std::vector<std::vector<SubscriberPortData_t*>> subscribersOfRuntimes(numberOfRuntimes);
+    std::vector<std::thread> runtimes;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < numberOfRuntimes; ++i)
+    {
+        runtimes.emplace_back(
+            runMockRuntime, i, numberOfRuntimes, numberOfPublishers, std::ref(subscribersOfRuntimes[i]));
+    }
+    for (auto& runtime : runtimes)
+    {
+        runtime.join();
+    }
+    while (!areAllSubscribersConnected(subscribersOfRuntimes))
+    {
+        if (std::chrono::steady_clock::now() - start > CONNECTION_TIMEOUT)
+        {
+            std::cerr << "Not all subscribers were connected within " << CONNECTION_TIMEOUT.count() << " s"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        std::this_thread::yield();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t numberOfRuntimes{DEFAULT_NUMBER_OF_RUNTIMES};
+    uint32_t numberOfPublishers{DEFAULT_NUMBER_OF_PUBLISHERS_PER_RUNTIME};
+    if ((argc > 1 && !cxx::convert::fromString(argv[1], numberOfRuntimes))
+        || (argc > 2 && !cxx::convert::fromString(argv[2], numberOfPublishers)) || numberOfRuntimes == 0U)
+    {
+        std::cerr << "Usage: " << argv[0] << " [number of runtimes] [publishers per runtime]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::ERROR);
+
+    std::cout << numberOfRuntimes << " runtimes with " << numberOfPublishers << " publishers and "
+              << numberOfPublishers << " subscribers each" << std::endl;
+    for (const auto numberOfRuntimeMessagesWorkers : NUMBER_OF_RUNTIME_MESSAGES_WORKERS)
+    {
+        const auto duration = measureStartup(numberOfRuntimeMessagesWorkers, numberOfRuntimes, numberOfPublishers);
+        std::cout << "runtime messages workers: " << numberOfRuntimeMessagesWorkers
+                  << ", time until all ports are connected: " << duration.count() << " ms" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
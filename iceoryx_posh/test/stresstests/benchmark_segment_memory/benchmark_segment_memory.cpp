@@ -0,0 +1,167 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_dust/cxx/convert.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_posh/iceoryx_posh_config.hpp"
+#include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iox/logging.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t DEFAULT_SEGMENT_SIZE_IN_MB{1024U};
+constexpr uint32_t USER_PAYLOAD_SIZE{4096U};
+constexpr uint64_t NUMBER_OF_ACCESSES{20000000U};
+constexpr uint64_t MEGABYTE{1024U * 1024U};
+
+struct Variant
+{
+    const char* name;
+    mepoo::SegmentMemoryOptions memoryOptions;
+};
+
+/// @brief the startup duration is the time to create the RouDi components, this is the part of the RouDi startup
+/// which depends on the segment size
+struct SegmentMeasurement
+{
+    std::chrono::milliseconds startupDuration{0};
+    double accessesPerSecond{0.0};
+};
+
+RouDiConfig_t createConfig(const uint64_t segmentSizeInMB, const mepoo::SegmentMemoryOptions& memoryOptions)
+{
+    const auto chunkSize = mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                               .expect("Valid chunk settings")
+                               .requiredChunkSize();
+    const auto numberOfChunks = static_cast<uint32_t>(segmentSizeInMB * MEGABYTE / chunkSize);
+
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({USER_PAYLOAD_SIZE, numberOfChunks});
+
+    RouDiConfig_t config;
+    config.setDefaults();
+    config.m_sharedMemorySegments.clear();
+    const auto groupName = posix::PosixGroup::getGroupOfCurrentProcess().getName();
+    config.m_sharedMemorySegments.push_back({groupName, groupName, mempoolConfig, mepoo::MemoryInfo(), memoryOptions});
+    return config;
+}
+
+/// @brief writes to the user payload of randomly chosen chunks, the indices are generated upfront to measure only
+/// the memory access
+double measureRandomChunkAccess(std::vector<mepoo::SharedChunk>& chunks)
+{
+    std::mt19937_64 generator{42U};
+    std::uniform_int_distribution<uint64_t> distribution{0U, chunks.size() - 1U};
+    std::vector<uint64_t*> payloads;
+    payloads.reserve(NUMBER_OF_ACCESSES);
+    for (uint64_t i = 0U; i < NUMBER_OF_ACCESSES; ++i)
+    {
+        payloads.push_back(static_cast<uint64_t*>(chunks[distribution(generator)].getUserPayload()));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto payload : payloads)
+    {
+        *payload += 1U;
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto durationInSeconds = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(NUMBER_OF_ACCESSES) / durationInSeconds;
+}
+
+SegmentMeasurement measureSegment(const uint64_t segmentSizeInMB, const mepoo::SegmentMemoryOptions& memoryOptions)
+{
+    SegmentMeasurement measurement;
+    const auto config = createConfig(segmentSizeInMB, memoryOptions);
+
+    const auto start = std::chrono::steady_clock::now();
+    roudi::IceOryxRouDiComponents roudiComponents(config);
+    const auto end = std::chrono::steady_clock::now();
+    measurement.startupDuration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+    auto segmentManager = roudiComponents.rouDiMemoryManager.segmentManager().value();
+    auto segmentInfo =
+        segmentManager->getSegmentInformationWithWriteAccessForUser(posix::PosixUser::getUserOfCurrentProcess());
+    auto& memoryManager = segmentInfo.m_memoryManager.value().get();
+
+    const auto chunkSettings =
+        mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).expect("Valid settings");
+    const auto numberOfChunks = memoryManager.getMemPoolInfo(0U).m_numChunks;
+    std::vector<mepoo::SharedChunk> chunks;
+    chunks.reserve(numberOfChunks);
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        chunks.push_back(memoryManager.getChunk(chunkSettings).expect("Enough chunks"));
+    }
+
+    measurement.accessesPerSecond = measureRandomChunkAccess(chunks);
+    return measurement;
+}
+
+std::string transparentHugePagesForSharedMemory()
+{
+    std::ifstream file{"/sys/kernel/mm/transparent_hugepage/shmem_enabled"};
+    std::string setting;
+    if (!std::getline(file, setting))
+    {
+        return "unknown";
+    }
+    return setting;
+}
+
+int main(int argc, char* argv[])
+{
+    uint64_t segmentSizeInMB{DEFAULT_SEGMENT_SIZE_IN_MB};
+    if ((argc > 1 && !cxx::convert::fromString(argv[1], segmentSizeInMB)) || segmentSizeInMB == 0U)
+    {
+        std::cerr << "Usage: " << argv[0] << " [segment size in MB]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::ERROR);
+
+    mepoo::SegmentMemoryOptions prefaulted;
+    prefaulted.prefault = true;
+    mepoo::SegmentMemoryOptions prefaultedHugePages;
+    prefaultedHugePages.prefault = true;
+    prefaultedHugePages.hugePages = true;
+    const Variant variants[] = {{"zero-filled (default)", mepoo::SegmentMemoryOptions()},
+                                {"prefaulted", prefaulted},
+                                {"prefaulted with huge pages", prefaultedHugePages}};
+
+    std::cout << "segment size: " << segmentSizeInMB << " MB, chunks with " << USER_PAYLOAD_SIZE
+              << " bytes user payload, transparent huge pages for shared memory: "
+              << transparentHugePagesForSharedMemory() << std::endl;
+    for (const auto& variant : variants)
+    {
+        const auto measurement = measureSegment(segmentSizeInMB, variant.memoryOptions);
+        std::cout << variant.name << ": startup " << measurement.startupDuration.count() << " ms, random chunk access "
+                  << static_cast<uint64_t>(measurement.accessesPerSecond / 1000000.0) << " M/s" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
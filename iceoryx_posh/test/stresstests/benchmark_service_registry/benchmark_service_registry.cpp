@@ -0,0 +1,151 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/hash_multi_index.hpp"
+
+#include "benchmark.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using iox::capro::IdString_t;
+using iox::capro::ServiceDescription;
+using iox::roudi::hashIdString;
+using iox::roudi::hashServiceDescription;
+
+constexpr uint32_t MAX_NUMBER_OF_SERVICES{10000U};
+constexpr uint32_t NUMBER_OF_INSTANCES{100U};
+constexpr uint32_t NUMBER_OF_REQUESTS{4096U};
+
+using Index_t = iox::roudi::HashMultiIndex<uint32_t, MAX_NUMBER_OF_SERVICES>;
+
+std::vector<ServiceDescription> services;
+std::vector<uint32_t> requests;
+Index_t* serviceDescriptionIndex{nullptr};
+Index_t* instanceIndex{nullptr};
+uint64_t globalCounter{0U};
+
+/// @brief the search for a service description like it was done by the ServiceRegistry before the index was
+/// introduced
+void linearFindServiceDescription()
+{
+    const auto& serviceDescription = services[requests[globalCounter % NUMBER_OF_REQUESTS]];
+    for (uint32_t i = 0U; i < services.size(); ++i)
+    {
+        if (services[i] == serviceDescription)
+        {
+            globalCounter += i + 1U;
+            return;
+        }
+    }
+}
+
+/// @brief the search for a service description with the hash index
+void hashFindServiceDescription()
+{
+    const auto& serviceDescription = services[requests[globalCounter % NUMBER_OF_REQUESTS]];
+    serviceDescriptionIndex->forEach(
+        hashServiceDescription(serviceDescription),
+        [&](const uint32_t index) { return services[index] == serviceDescription; },
+        [&](const uint32_t index) { globalCounter += index + 1U; });
+}
+
+/// @brief the search with a wildcard for the service and event string, i.e. only the instance string is compared
+void linearFindInstance()
+{
+    const auto& instance = services[requests[globalCounter % NUMBER_OF_REQUESTS]].getInstanceIDString();
+    uint64_t matches{1U};
+    for (const auto& service : services)
+    {
+        if (service.getInstanceIDString() == instance)
+        {
+            ++matches;
+        }
+    }
+    globalCounter += matches;
+}
+
+/// @brief the search with a wildcard for the service and event string with the secondary index of the instance string
+void hashFindInstance()
+{
+    const auto& instance = services[requests[globalCounter % NUMBER_OF_REQUESTS]].getInstanceIDString();
+    uint64_t matches{1U};
+    instanceIndex->forEach(
+        hashIdString(instance),
+        [&](const uint32_t index) { return services[index].getInstanceIDString() == instance; },
+        [&](const uint32_t) { ++matches; });
+    globalCounter += matches;
+}
+
+void setupServices(const uint32_t numberOfServices)
+{
+    services.clear();
+    requests.clear();
+    delete serviceDescriptionIndex;
+    delete instanceIndex;
+    serviceDescriptionIndex = new Index_t();
+    instanceIndex = new Index_t();
+
+    // the strings share a long prefix like the names of real services do, this is the worst case for the comparison
+    for (uint32_t i = 0U; i < numberOfServices; ++i)
+    {
+        const std::string service = "/vehicle/perception/sensor_fusion/service_" + std::to_string(i);
+        const std::string instance = "instance_" + std::to_string(i % NUMBER_OF_INSTANCES);
+        services.emplace_back(IdString_t(iox::TruncateToCapacity, service.c_str()),
+                              IdString_t(iox::TruncateToCapacity, instance.c_str()),
+                              IdString_t("event"));
+
+        const auto& serviceDescription = services.back();
+        serviceDescriptionIndex->insert(hashServiceDescription(serviceDescription), i, [&](const uint32_t index) {
+            return services[index] == serviceDescription;
+        });
+        instanceIndex->insert(hashIdString(serviceDescription.getInstanceIDString()), i, [&](const uint32_t index) {
+            return services[index].getInstanceIDString() == serviceDescription.getInstanceIDString();
+        });
+    }
+
+    // a fixed seed keeps the runs comparable
+    std::mt19937 randomGenerator{42U};
+    std::uniform_int_distribution<uint32_t> serviceDistribution{0U, numberOfServices - 1U};
+    for (uint32_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        requests.push_back(serviceDistribution(randomGenerator));
+    }
+}
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    for (const uint32_t numberOfServices : {100U, 1000U, MAX_NUMBER_OF_SERVICES})
+    {
+        setupServices(numberOfServices);
+        std::cout << "number of services: " << numberOfServices << std::endl;
+
+        BENCHMARK(linearFindServiceDescription, timeout);
+        BENCHMARK(hashFindServiceDescription, timeout);
+        BENCHMARK(linearFindInstance, timeout);
+        BENCHMARK(hashFindInstance, timeout);
+    }
+
+    delete serviceDescriptionIndex;
+    delete instanceIndex;
+}
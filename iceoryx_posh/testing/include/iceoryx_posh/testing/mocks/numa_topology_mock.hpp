@@ -0,0 +1,108 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MOCKS_NUMA_TOPOLOGY_MOCK_HPP
+#define IOX_POSH_MOCKS_NUMA_TOPOLOGY_MOCK_HPP
+
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_posh/mepoo/numa_topology.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/// @brief Replaces the NUMA topology of the system with a configurable number of nodes while it is alive. The
+/// bindings are only recorded and not applied, this allows to test the NUMA awareness on a machine with a single node.
+class FakeNumaTopology : public iox::mepoo::NumaTopology
+{
+  public:
+    struct MemoryBinding
+    {
+        void* address;
+        uint64_t size;
+        uint32_t node;
+    };
+
+    explicit FakeNumaTopology(const uint32_t numberOfNodes)
+        : m_numberOfNodes(numberOfNodes)
+    {
+        iox::cxx::Expects(!isActive() && "Using multiple FakeNumaTopology in parallel is not supported!");
+        isActive() = true;
+        NumaTopology::setInstance(this);
+    }
+
+    ~FakeNumaTopology() override
+    {
+        NumaTopology::setInstance(nullptr);
+        isActive() = false;
+    }
+
+    FakeNumaTopology(const FakeNumaTopology&) = delete;
+    FakeNumaTopology(FakeNumaTopology&&) = delete;
+    FakeNumaTopology& operator=(const FakeNumaTopology&) = delete;
+    FakeNumaTopology& operator=(FakeNumaTopology&&) = delete;
+
+    uint32_t numberOfNodes() const noexcept override
+    {
+        return m_numberOfNodes;
+    }
+
+    iox::expected<iox::mepoo::NumaTopologyError> bindThreadMemoryToNode(const uint32_t node) noexcept override
+    {
+        if (node >= m_numberOfNodes)
+        {
+            return iox::error<iox::mepoo::NumaTopologyError>(iox::mepoo::NumaTopologyError::INVALID_NODE);
+        }
+        threadBindings.push_back(node);
+        isThreadMemoryBound = true;
+        return iox::success<>();
+    }
+
+    iox::expected<iox::mepoo::NumaTopologyError> resetThreadMemoryBinding() noexcept override
+    {
+        isThreadMemoryBound = false;
+        return iox::success<>();
+    }
+
+    iox::expected<iox::mepoo::NumaTopologyError>
+    bindMemoryToNode(void* const address, const uint64_t size, const uint32_t node) noexcept override
+    {
+        if (node >= m_numberOfNodes)
+        {
+            return iox::error<iox::mepoo::NumaTopologyError>(iox::mepoo::NumaTopologyError::INVALID_NODE);
+        }
+        if (failMemoryBinding)
+        {
+            return iox::error<iox::mepoo::NumaTopologyError>(iox::mepoo::NumaTopologyError::BINDING_FAILED);
+        }
+        memoryBindings.push_back({address, size, node});
+        return iox::success<>();
+    }
+
+    std::vector<uint32_t> threadBindings;
+    std::vector<MemoryBinding> memoryBindings;
+    bool isThreadMemoryBound{false};
+    bool failMemoryBinding{false};
+
+  private:
+    static bool& isActive()
+    {
+        static bool active{false};
+        return active;
+    }
+
+    uint32_t m_numberOfNodes{1U};
+};
+
+#endif // IOX_POSH_MOCKS_NUMA_TOPOLOGY_MOCK_HPP
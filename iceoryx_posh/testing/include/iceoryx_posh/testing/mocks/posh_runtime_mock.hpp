@@ -72,6 +72,7 @@ class PoshRuntimeMock : public iox::runtime::PoshRuntime
                  const iox::popo::ServerOptions&,
                  const iox::runtime::PortConfigInfo&),
                 (noexcept, override));
+    MOCK_METHOD(void, createPorts, (iox::runtime::PortCreationBatch&), (noexcept, override));
     MOCK_METHOD(iox::popo::InterfacePortData*,
                 getMiddlewareInterface,
                 (const iox::capro::Interfaces, const iox::NodeName_t&),
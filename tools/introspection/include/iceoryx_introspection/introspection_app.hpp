@@ -140,10 +140,11 @@ class IntrospectionApp
     composePublisherPortData(const PortIntrospectionFieldTopic* portData,
                              const PortThroughputIntrospectionFieldTopic* throughputData);
 
-    /// @brief Prepares the subscriber port data before printing
+    /// @brief Prepares the subscriber port data before printing; the latency data is optional and can be a nullptr
     std::vector<ComposedSubscriberPortData>
     composeSubscriberPortData(const PortIntrospectionFieldTopic* portData,
-                              const SubscriberPortChangingIntrospectionFieldTopic* subscriberPortChangingData);
+                              const SubscriberPortChangingIntrospectionFieldTopic* subscriberPortChangingData,
+                              const SubscriberLatencyIntrospectionFieldTopic* subscriberLatencyData);
 
     /// @brief Print the prepared publisher and subscriber port data
     void printPortIntrospectionData(const std::vector<ComposedPublisherPortData>& publisherPortData,
@@ -60,13 +60,17 @@ struct ComposedPublisherPortData
 struct ComposedSubscriberPortData
 {
     ComposedSubscriberPortData(const SubscriberPortData& portData,
-                               const SubscriberPortChangingData& subscriberPortChangingData)
+                               const SubscriberPortChangingData& subscriberPortChangingData,
+                               const SubscriberLatencyData* latencyData = nullptr)
         : portData(&portData)
         , subscriberPortChangingData(&subscriberPortChangingData)
+        , latencyData(latencyData)
     {
     }
     const SubscriberPortData* portData;
     const SubscriberPortChangingData* subscriberPortChangingData;
+    /// @brief nullptr until the first latency introspection data is received
+    const SubscriberLatencyData* latencyData;
 };
 
 } // namespace introspection
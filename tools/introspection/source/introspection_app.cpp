@@ -273,18 +273,23 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
 
     constexpr int32_t memPoolWidth{8};
     constexpr int32_t usedchunksWidth{14};
+    constexpr int32_t cachedchunksWidth{7};
     constexpr int32_t numchunksWidth{9};
     constexpr int32_t minFreechunksWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
+    constexpr int32_t numaNodeWidth{9};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
+    wprintw(pad, "%*s |", cachedchunksWidth, "Cached");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", chunkPayloadSizeWidth, "Chunk Payload Size");
+    wprintw(pad, "%*s\n", numaNodeWidth, "NUMA Node");
+    wprintw(pad, "-----------------------------------------------------------------------------------------");
+    wprintw(pad, "------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -293,10 +298,19 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
         {
             wprintw(pad, "%*zd |", memPoolWidth, i + 1u);
             wprintw(pad, "%*d |", usedchunksWidth, info.m_usedChunks);
+            wprintw(pad, "%*d |", cachedchunksWidth, info.m_cachedChunks);
             wprintw(pad, "%*d |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*d |", minFreechunksWidth, info.m_minFreeChunks);
             wprintw(pad, "%*d |", chunkSizeWidth, info.m_chunkSize);
-            wprintw(pad, "%*d\n", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*d |", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            if (info.m_numaNode == iox::mepoo::MemoryInfo::NO_NUMA_NODE)
+            {
+                wprintw(pad, "%*s\n", numaNodeWidth, "-");
+            }
+            else
+            {
+                wprintw(pad, "%*d\n", numaNodeWidth, info.m_numaNode);
+            }
         }
     }
     wprintw(pad, "\n");
@@ -316,6 +330,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     // constexpr int32_t chunksWidth{12};
     // constexpr int32_t intervalWidth{19};
     constexpr int32_t subscriptionStateWidth{14};
+    constexpr int32_t latencyWidth{22};
     // constexpr int32_t fifoWidth{17};    // uncomment once this information is needed
     constexpr int32_t scopeWidth{12};
     constexpr int32_t interfaceSourceWidth{8};
@@ -438,6 +453,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", runtimeNameWidth, "Process");
     wprintw(pad, " %*s |", nodeNameWidth, "Node");
     wprintw(pad, " %*s |", subscriptionStateWidth, "Subscription");
+    wprintw(pad, " %*s |", latencyWidth, "Latency [us]");
     // wprintw(pad, " %*s |", fifoWidth, "FiFo"); // uncomment once this information is needed
     wprintw(pad, " %*s\n", scopeWidth, "Propagation");
 
@@ -447,11 +463,12 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", runtimeNameWidth, "");
     wprintw(pad, " %*s |", nodeNameWidth, "");
     wprintw(pad, " %*s |", subscriptionStateWidth, "State");
+    wprintw(pad, " %*s |", latencyWidth, "p50 / p99 / p99.9");
     // wprintw(pad, " %*s |", fifoWidth, "size / capacity"); // uncomment once this information is needed
     wprintw(pad, " %*s\n", scopeWidth, "scope");
 
     wprintw(pad, "---------------------------------------------------------------------------------------------------");
-    wprintw(pad, "---------------------------------------------------\n");
+    wprintw(pad, "--------------------------------------------------------------------------\n");
 
     auto subscriptionStateToString = [](iox::SubscribeState subState) -> std::string {
         switch (subState)
@@ -471,6 +488,21 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
         }
     };
 
+    auto latencyToString = [](const SubscriberLatencyData* latencyData) -> std::string {
+        if (latencyData == nullptr || latencyData->m_numberOfSamples == 0U)
+        {
+            return "n/a";
+        }
+
+        constexpr double NANOSECONDS_PER_MICROSECOND{1000.0};
+        std::stringstream stream;
+        stream << std::fixed << std::setprecision(1)
+               << static_cast<double>(latencyData->m_p50LatencyInNanoseconds) / NANOSECONDS_PER_MICROSECOND << " / "
+               << static_cast<double>(latencyData->m_p99LatencyInNanoseconds) / NANOSECONDS_PER_MICROSECOND << " / "
+               << static_cast<double>(latencyData->m_p999LatencyInNanoseconds) / NANOSECONDS_PER_MICROSECOND;
+        return stream.str();
+    };
+
     for (auto& subscriber : subscriberPortData)
     {
         currentLine = 0;
@@ -496,6 +528,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
                     printEntry(subscriptionStateWidth,
                                subscriptionStateToString(subscriber.subscriberPortChangingData->subscriptionState))
                         .c_str());
+            wprintw(pad, " %s |", printEntry(latencyWidth, latencyToString(subscriber.latencyData)).c_str());
             // uncomment once this information is needed
             // if (currentLine == 0)
             //{
@@ -526,6 +559,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
         wprintw(pad, " %*s |", runtimeNameWidth, "");
         wprintw(pad, " %*s |", nodeNameWidth, "");
         wprintw(pad, " %*s |", subscriptionStateWidth, "");
+        wprintw(pad, " %*s |", latencyWidth, "");
         // wprintw(pad, " %*s |", fifoWidth, ""); // uncomment once this information is needed
         wprintw(pad, " %*s", scopeWidth, "");
         wprintw(pad, "\n");
@@ -598,17 +632,25 @@ IntrospectionApp::composePublisherPortData(const PortIntrospectionFieldTopic* po
 
 std::vector<ComposedSubscriberPortData> IntrospectionApp::composeSubscriberPortData(
     const PortIntrospectionFieldTopic* portData,
-    const SubscriberPortChangingIntrospectionFieldTopic* subscriberPortChangingData)
+    const SubscriberPortChangingIntrospectionFieldTopic* subscriberPortChangingData,
+    const SubscriberLatencyIntrospectionFieldTopic* subscriberLatencyData)
 {
     std::vector<ComposedSubscriberPortData> subscriberPortData;
     subscriberPortData.reserve(portData->m_subscriberList.size());
 
+    // the latency data is only used if it fits to the port data
+    const bool hasLatencyData = (subscriberLatencyData != nullptr)
+                                && (portData->m_subscriberList.size() == subscriberLatencyData->m_latencyList.size());
+
     uint32_t i = 0U;
     if (portData->m_subscriberList.size() == subscriberPortChangingData->subscriberPortChangingDataList.size())
     { // should be the same, else it will be soon
         for (const auto& port : portData->m_subscriberList)
         {
-            subscriberPortData.push_back({port, subscriberPortChangingData->subscriberPortChangingDataList[i++]});
+            subscriberPortData.push_back({port,
+                                          subscriberPortChangingData->subscriberPortChangingDataList[i],
+                                          hasLatencyData ? &subscriberLatencyData->m_latencyList[i] : nullptr});
+            ++i;
         }
     }
 
@@ -671,12 +713,15 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         IntrospectionPortThroughputService, subscriberOptions);
     iox::popo::Subscriber<SubscriberPortChangingIntrospectionFieldTopic> subscriberPortChangingDataSubscriber(
         IntrospectionSubscriberPortChangingDataService, subscriberOptions);
+    iox::popo::Subscriber<SubscriberLatencyIntrospectionFieldTopic> subscriberLatencySubscriber(
+        IntrospectionSubscriberLatencyService, subscriberOptions);
 
     if (introspectionSelection.port == true)
     {
         portSubscriber.subscribe();
         portThroughputSubscriber.subscribe();
         subscriberPortChangingDataSubscriber.subscribe();
+        subscriberLatencySubscriber.subscribe();
 
         if (waitForSubscription(portSubscriber) == false)
         {
@@ -692,6 +737,11 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
             prettyPrint("Timeout while waiting for Subscription for Subscriber Port Introspection Changing Data!\n",
                         PrettyOptions::error);
         }
+        if (waitForSubscription(subscriberLatencySubscriber) == false)
+        {
+            prettyPrint("Timeout while waiting for subscription for subscriber latency introspection data!\n",
+                        PrettyOptions::error);
+        }
     }
 
     // Refresh once in case of timeout messages
@@ -702,6 +752,7 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
     optional<popo::Sample<const PortIntrospectionFieldTopic>> portSample;
     optional<popo::Sample<const PortThroughputIntrospectionFieldTopic>> portThroughputSample;
     optional<popo::Sample<const SubscriberPortChangingIntrospectionFieldTopic>> subscriberPortChangingDataSamples;
+    optional<popo::Sample<const SubscriberLatencyIntrospectionFieldTopic>> subscriberLatencySample;
 
     while (true)
     {
@@ -760,13 +811,17 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
             subscriberPortChangingDataSubscriber.take().and_then(
                 [&](auto& sample) { subscriberPortChangingDataSamples = sample; });
 
+            subscriberLatencySubscriber.take().and_then([&](auto& sample) { subscriberLatencySample = sample; });
+
             if (portSample && portThroughputSample && subscriberPortChangingDataSamples)
             {
                 prettyPrint("### Connections ###\n\n", PrettyOptions::highlight);
                 auto composedPublisherPortData =
                     composePublisherPortData(portSample.value().get(), portThroughputSample.value().get());
+                const SubscriberLatencyIntrospectionFieldTopic* subscriberLatencyData =
+                    subscriberLatencySample ? subscriberLatencySample.value().get() : nullptr;
                 auto composedSubscriberPortData = composeSubscriberPortData(
-                    portSample.value().get(), subscriberPortChangingDataSamples.value().get());
+                    portSample.value().get(), subscriberPortChangingDataSamples.value().get(), subscriberLatencyData);
 
                 printPortIntrospectionData(composedPublisherPortData, composedSubscriberPortData);
             }